@@ -612,6 +612,16 @@
 	#endif
 #endif
 
+// Most of the platform blocks above leave the byte order unset; fall back on
+// the one GCC and Clang report, so that std::endian::native is right.
+#if !defined(EA_SYSTEM_BIG_ENDIAN) && !defined(EA_SYSTEM_LITTLE_ENDIAN)
+	#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+		#define EA_SYSTEM_BIG_ENDIAN 1
+	#else
+		#define EA_SYSTEM_LITTLE_ENDIAN 1
+	#endif
+#endif
+
 // EA_PLATFORM_PTR_SIZE
 // Platform pointer size; same as sizeof(void*).
 // This is not the same as sizeof(int), as int is usually 32 bits on
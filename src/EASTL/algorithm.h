@@ -95,6 +95,7 @@
 //     +change_heap                                 Found in heap.h
 //     +change_heap<Compare>                        Found in heap.h
 //      clamp
+//     +clamp_transform
 //      copy
 //      copy_if                                     C++11
 //      copy_n                                      C++11
@@ -125,6 +126,7 @@
 //      generate_n
 //     +identical
 //     +identical<Compare>
+//     +interpolation_lower_bound
 //      iter_swap
 //      lexicographical_compare
 //      lexicographical_compare<Compare>
@@ -244,6 +246,9 @@
 #include <EASTL/internal/move_help.h>
 #include <EASTL/internal/copy_help.h>
 #include <EASTL/internal/fill_help.h>
+#include <EASTL/internal/find_help.h>
+#include <EASTL/internal/minmax_help.h>
+#include <EASTL/internal/bound_help.h>
 #include <EASTL/initializer_list.h>
 #include <EASTL/iterator.h>
 #include <EASTL/functional.h>
@@ -308,18 +313,7 @@ namespace std
 	template <typename ForwardIterator>
 	ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
 	{
-		if(first != last)
-		{
-			ForwardIterator currentMin = first;
-
-			while(++first != last)
-			{
-				if(*first < *currentMin)
-					currentMin = first;
-			}
-			return currentMin;
-		}
-		return first;
+		return std::Internal::minmax_imp<std::Internal::is_minmax_vectorizable<ForwardIterator>::value>::do_min_element(first, last);
 	}
 
 
@@ -372,18 +366,7 @@ namespace std
 	template <typename ForwardIterator>
 	ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
 	{
-		if(first != last)
-		{
-			ForwardIterator currentMax = first;
-
-			while(++first != last)
-			{
-				if(*currentMax < *first)
-					currentMax = first;
-			}
-			return currentMax;
-		}
-		return first;
+		return std::Internal::minmax_imp<std::Internal::is_minmax_vectorizable<ForwardIterator>::value>::do_max_element(first, last);
 	}
 
 
@@ -736,9 +719,7 @@ namespace std
 	std::pair<ForwardIterator, ForwardIterator>
 	minmax_element(ForwardIterator first, ForwardIterator last)
 	{
-		typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
-
-		return std::minmax_element(first, last, std::less<value_type>());
+		return std::Internal::minmax_imp<std::Internal::is_minmax_vectorizable<ForwardIterator>::value>::do_minmax_element(first, last);
 	}
 
 
@@ -966,18 +947,7 @@ namespace std
 	inline ForwardIterator
 	adjacent_find(ForwardIterator first, ForwardIterator last)
 	{
-		if(first != last)
-		{
-			ForwardIterator i = first;
-
-			for(++i; i != last; ++i)
-			{
-				if(*first == *i)
-					return first;
-				first = i;
-			}
-		}
-		return last;
+		return std::Internal::find_imp<std::Internal::is_find_vectorizable<ForwardIterator>::value>::do_adjacent_find(first, last);
 	}
 
 
@@ -1264,7 +1234,7 @@ namespace std
 	{
 		typedef typename std::iterator_traits<BidirectionalIterator1>::iterator_category IIC;
 
-		const bool canBeMemmoved = internal::can_be_memmoved_helper<BidirectionalIterator1, BidirectionalIterator2>::value;
+		const bool canBeMemmoved = Internal::can_be_memmoved_helper<BidirectionalIterator1, BidirectionalIterator2>::value;
 
 		return std::move_and_copy_backward_helper<IIC, isMove, canBeMemmoved>::move_or_copy_backward(first, last, resultEnd); // Need to chose based on the input iterator tag and not the output iterator tag, because containers accept input ranges of iterator types different than self.
 	}
@@ -1341,18 +1311,13 @@ namespace std
 	/// Note: The predicate version of count is count_if and not another variation of count.
 	/// This is because both versions would have three parameters and there could be ambiguity.
 	///
+	/// Pointer ranges of integral types are counted a vector or word at a time (see find_help.h).
+	///
 	template <typename InputIterator, typename T>
 	inline typename std::iterator_traits<InputIterator>::difference_type
 	count(InputIterator first, InputIterator last, const T& value)
 	{
-		typename std::iterator_traits<InputIterator>::difference_type result = 0;
-
-		for(; first != last; ++first)
-		{
-			if(*first == value)
-				++result;
-		}
-		return result;
+		return std::Internal::find_imp<std::Internal::is_find_vectorizable<InputIterator>::value && std::is_integral<T>::value>::do_count(first, last, value);
 	}
 
 
@@ -1415,13 +1380,14 @@ namespace std
 	/// Note: The predicate version of find is find_if and not another variation of find.
 	/// This is because both versions would have three parameters and there could be ambiguity.
 	///
+	/// Pointer ranges of integral types use memchr for bytes and compare a vector or word of
+	/// elements at a time otherwise (see find_help.h).
+	///
 	template <typename InputIterator, typename T>
 	inline InputIterator
 	find(InputIterator first, InputIterator last, const T& value)
 	{
-		while((first != last) && !(*first == value)) // Note that we always express value comparisons in terms of < or ==.
-			++first;
-		return first;
+		return std::Internal::find_imp<std::Internal::is_find_vectorizable<InputIterator>::value && std::is_integral<T>::value>::do_find(first, last, value);
 	}
 
 
@@ -1847,61 +1813,16 @@ namespace std
 	///
 	/// Complexity: At most last1 first1 applications of the corresponding predicate.
 	///
-	/// To consider: Make specializations of this for scalar types and random access
-	/// iterators that uses memcmp or some trick memory comparison function.
-	/// We should verify that such a thing results in an improvement.
+	/// Pointer ranges of the same integral, enum or pointer type (which includes
+	/// vector, array and string iterators) are compared with memcmp, except
+	/// during constant evaluation.
 	///
 	template <typename InputIterator1, typename InputIterator2>
 	EA_CPP14_CONSTEXPR inline bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 	{
-		for(; first1 != last1; ++first1, ++first2)
-		{
-			if(!(*first1 == *first2)) // Note that we always express value comparisons in terms of < or ==.
-				return false;
-		}
-		return true;
+		return std::Internal::find_imp<std::Internal::is_memcmp_comparable<InputIterator1, InputIterator2>::value>::do_equal(first1, last1, first2);
 	}
 
-	/* Enable the following if there was shown to be some benefit. A glance and Microsoft VC++ memcmp
-		shows that it is not optimized in any way, much less one that would benefit us here.
-
-	inline bool equal(const bool* first1, const bool* last1, const bool* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const char* first1, const char* last1, const char* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const unsigned char* first1, const unsigned char* last1, const unsigned char* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const signed char* first1, const signed char* last1, const signed char* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	#ifndef EA_WCHAR_T_NON_NATIVE
-		inline bool equal(const wchar_t* first1, const wchar_t* last1, const wchar_t* first2)
-			{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-	#endif
-
-	inline bool equal(const int16_t* first1, const int16_t* last1, const int16_t* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const uint16_t* first1, const uint16_t* last1, const uint16_t* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const int32_t* first1, const int32_t* last1, const int32_t* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const uint32_t* first1, const uint32_t* last1, const uint32_t* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const int64_t* first1, const int64_t* last1, const int64_t* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-
-	inline bool equal(const uint64_t* first1, const uint64_t* last1, const uint64_t* first2)
-		{ return (memcmp(first1, first2, (size_t)((uintptr_t)last1 - (uintptr_t)first1)) == 0); }
-	*/
-
-
 
 	/// equal
 	///
@@ -1990,87 +1911,17 @@ namespace std
 	/// of the sequences yields the same result as the comparison of the first
 	/// corresponding pair of elements that are not equivalent.
 	///
+	/// Pointer ranges of unsigned bytes are compared with memcmp. Other pointer
+	/// ranges of the same integral, enum or pointer type find the first
+	/// difference as mismatch does and compare just that pair.
+	///
 	template <typename InputIterator1, typename InputIterator2>
 	inline bool
 	lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
 	{
-		for(; (first1 != last1) && (first2 != last2); ++first1, ++first2)
-		{
-			if(*first1 < *first2)
-				return true;
-			if(*first2 < *first1)
-				return false;
-		}
-		return (first1 == last1) && (first2 != last2);
-	}
-
-	inline bool     // Specialization for const char*.
-	lexicographical_compare(const char* first1, const char* last1, const char* first2, const char* last2)
-	{
-		const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		return result ? (result < 0) : (n1 < n2);
-	}
-
-	inline bool     // Specialization for char*.
-	lexicographical_compare(char* first1, char* last1, char* first2, char* last2)
-	{
-		const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		return result ? (result < 0) : (n1 < n2);
-	}
-
-	inline bool     // Specialization for const unsigned char*.
-	lexicographical_compare(const unsigned char* first1, const unsigned char* last1, const unsigned char* first2, const unsigned char* last2)
-	{
-		const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		return result ? (result < 0) : (n1 < n2);
+		return std::Internal::find_imp<std::Internal::is_memcmp_comparable<InputIterator1, InputIterator2>::value>::do_lexicographical_compare(first1, last1, first2, last2);
 	}
 
-	inline bool     // Specialization for unsigned char*.
-	lexicographical_compare(unsigned char* first1, unsigned char* last1, unsigned char* first2, unsigned char* last2)
-	{
-		const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		return result ? (result < 0) : (n1 < n2);
-	}
-
-	inline bool     // Specialization for const signed char*.
-	lexicographical_compare(const signed char* first1, const signed char* last1, const signed char* first2, const signed char* last2)
-	{
-		const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		return result ? (result < 0) : (n1 < n2);
-	}
-
-	inline bool     // Specialization for signed char*.
-	lexicographical_compare(signed char* first1, signed char* last1, signed char* first2, signed char* last2)
-	{
-		const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		return result ? (result < 0) : (n1 < n2);
-	}
-
-	#if defined(_MSC_VER) // If using the VC++ compiler (and thus bool is known to be a single byte)...
-		//Not sure if this is a good idea.
-		//inline bool     // Specialization for const bool*.
-		//lexicographical_compare(const bool* first1, const bool* last1, const bool* first2, const bool* last2)
-		//{
-		//    const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		//    const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		//    return result ? (result < 0) : (n1 < n2);
-		//}
-		//
-		//inline bool     // Specialization for bool*.
-		//lexicographical_compare(bool* first1, bool* last1, bool* first2, bool* last2)
-		//{
-		//    const ptrdiff_t n1(last1 - first1), n2(last2 - first2);
-		//    const int result = memcmp(first1, first2, (size_t)std::min_alt(n1, n2));
-		//    return result ? (result < 0) : (n1 < n2);
-		//}
-	#endif
-
 
 
 	/// lexicographical_compare
@@ -2167,13 +2018,7 @@ namespace std
 	mismatch(InputIterator1 first1, InputIterator1 last1,
 			 InputIterator2 first2) // , InputIterator2 last2)
 	{
-		while((first1 != last1) && (*first1 == *first2)) // && (first2 != last2) <- C++ standard mismatch function doesn't check first2/last2.
-		{
-			++first1;
-			++first2;
-		}
-
-		return std::pair<InputIterator1, InputIterator2>(first1, first2);
+		return std::Internal::find_imp<std::Internal::is_memcmp_comparable<InputIterator1, InputIterator2>::value>::do_mismatch(first1, last1, first2);
 	}
 
 
@@ -2221,35 +2066,14 @@ namespace std
 	///
 	/// Complexity: At most 'log(last - first) + 1' comparisons.
 	///
-	/// Optimizations: We have no need to specialize this implementation for random
-	/// access iterators (e.g. contiguous array), as the code below will already
-	/// take advantage of them.
+	/// Optimizations: Pointer ranges of arithmetic values searched with operator<,
+	/// less or greater use the branchless search in internal/bound_help.h.
 	///
 	template <typename ForwardIterator, typename T>
 	ForwardIterator
 	lower_bound(ForwardIterator first, ForwardIterator last, const T& value)
 	{
-		typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
-
-		DifferenceType d = std::distance(first, last); // This will be efficient for a random access iterator such as an array.
-
-		while(d > 0)
-		{
-			ForwardIterator i  = first;
-			DifferenceType  d2 = d >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
-
-			std::advance(i, d2); // This will be efficient for a random access iterator such as an array.
-
-			if(*i < value)
-			{
-				// Disabled because std::lower_bound doesn't specify (23.3.3.3, p3) this can be done: EASTL_VALIDATE_COMPARE(!(value < *i)); // Validate that the compare function is sane.
-				first = ++i;
-				d    -= d2 + 1;
-			}
-			else
-				d = d2;
-		}
-		return first;
+		return std::Internal::bound_imp<std::Internal::is_bound_branchless<ForwardIterator, T>::value>::do_lower_bound(first, last, value);
 	}
 
 
@@ -2269,35 +2093,39 @@ namespace std
 	///
 	/// Complexity: At most 'log(last - first) + 1' comparisons.
 	///
-	/// Optimizations: We have no need to specialize this implementation for random
-	/// access iterators (e.g. contiguous array), as the code below will already
-	/// take advantage of them.
+	/// Optimizations: Pointer ranges of arithmetic values searched with operator<,
+	/// less or greater use the branchless search in internal/bound_help.h.
 	///
 	template <typename ForwardIterator, typename T, typename Compare>
 	ForwardIterator
 	lower_bound(ForwardIterator first, ForwardIterator last, const T& value, Compare compare)
 	{
-		typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
+		return std::Internal::bound_imp<std::Internal::is_bound_branchless<ForwardIterator, T, Compare>::value>::do_lower_bound(first, last, value, compare);
+	}
 
-		DifferenceType d = std::distance(first, last); // This will be efficient for a random access iterator such as an array.
 
-		while(d > 0)
-		{
-			ForwardIterator i  = first;
-			DifferenceType  d2 = d >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
 
-			std::advance(i, d2); // This will be efficient for a random access iterator such as an array.
+	/// interpolation_lower_bound
+	///
+	/// Returns the same iterator as lower_bound(first, last, value) for a range
+	/// of arithmetic values sorted by operator<. Instead of halving the range,
+	/// it probes where value would be if the values grew linearly, which for
+	/// uniformly distributed values such as hashes, timestamps or sampled
+	/// readings finds it in about log(log(last - first)) steps. Otherwise it
+	/// soon falls back to lower_bound. Each step costs a division and more
+	/// than a cache line, so this pays off for tables larger than the cache;
+	/// smaller ones are faster with lower_bound.
+	///
+	/// This is an extension to the C++ standard.
+	///
+	template <typename RandomAccessIterator, typename T>
+	inline RandomAccessIterator
+	interpolation_lower_bound(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		static_assert(std::is_arithmetic<value_type>::value && std::is_arithmetic<T>::value, "interpolation_lower_bound requires arithmetic values.");
 
-			if(compare(*i, value))
-			{
-				// Disabled because std::lower_bound doesn't specify (23.3.3.1, p3) this can be done: EASTL_VALIDATE_COMPARE(!compare(value, *i)); // Validate that the compare function is sane.
-				first = ++i;
-				d    -= d2 + 1;
-			}
-			else
-				d = d2;
-		}
-		return first;
+		return std::Internal::do_interpolation_lower_bound(first, last, value);
 	}
 
 
@@ -2316,33 +2144,13 @@ namespace std
 	///
 	/// Complexity: At most 'log(last - first) + 1' comparisons.
 	///
+	/// Optimizations: See lower_bound.
+	///
 	template <typename ForwardIterator, typename T>
 	ForwardIterator
 	upper_bound(ForwardIterator first, ForwardIterator last, const T& value)
 	{
-		typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
-
-		DifferenceType len = std::distance(first, last);
-
-		while(len > 0)
-		{
-			ForwardIterator i    = first;
-			DifferenceType  len2 = len >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
-
-			std::advance(i, len2);
-
-			if(!(value < *i)) // Note that we always express value comparisons in terms of < or ==.
-			{
-				first = ++i;
-				len -= len2 + 1;
-			}
-			else
-			{
-				// Disabled because std::upper_bound doesn't specify (23.3.3.2, p3) this can be done: EASTL_VALIDATE_COMPARE(!(*i < value)); // Validate that the compare function is sane.
-				len = len2;
-			}
-		}
-		return first;
+		return std::Internal::bound_imp<std::Internal::is_bound_branchless<ForwardIterator, T>::value>::do_upper_bound(first, last, value);
 	}
 
 
@@ -2362,33 +2170,13 @@ namespace std
 	///
 	/// Complexity: At most 'log(last - first) + 1' comparisons.
 	///
+	/// Optimizations: See lower_bound.
+	///
 	template <typename ForwardIterator, typename T, typename Compare>
 	ForwardIterator
 	upper_bound(ForwardIterator first, ForwardIterator last, const T& value, Compare compare)
 	{
-		typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
-
-		DifferenceType len = std::distance(first, last);
-
-		while(len > 0)
-		{
-			ForwardIterator i    = first;
-			DifferenceType  len2 = len >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
-
-			std::advance(i, len2);
-
-			if(!compare(value, *i))
-			{
-				first = ++i;
-				len -= len2 + 1;
-			}
-			else
-			{
-				// Disabled because std::upper_bound doesn't specify (23.3.3.2, p3) this can be done: EASTL_VALIDATE_COMPARE(!compare(*i, value)); // Validate that the compare function is sane.
-				len = len2;
-			}
-		}
-		return first;
+		return std::Internal::bound_imp<std::Internal::is_bound_branchless<ForwardIterator, T, Compare>::value>::do_upper_bound(first, last, value, compare);
 	}
 
 
@@ -4321,6 +4109,38 @@ namespace std
 
 
 
+	/// clamp_transform
+	///
+	/// Writes clamp(*i, lo, hi) for each i in [first, last) to the range
+	/// beginning at result, and returns the end of that range. result may
+	/// be equal to first. This is the bulk form of clamp, for limiting whole
+	/// buffers of samples; over pointer ranges of arithmetic types it clamps
+	/// a vector of elements at a time.
+	///
+	template <typename InputIterator, typename OutputIterator, typename Compare>
+	OutputIterator clamp_transform(InputIterator first, InputIterator last, OutputIterator result,
+	                               const typename std::iterator_traits<InputIterator>::value_type& lo,
+	                               const typename std::iterator_traits<InputIterator>::value_type& hi, Compare compare)
+	{
+		EASTL_ASSERT(!compare(hi, lo));
+
+		for(; first != last; ++first, ++result)
+			*result = std::clamp(*first, lo, hi, compare);
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator>
+	OutputIterator clamp_transform(InputIterator first, InputIterator last, OutputIterator result,
+	                               const typename std::iterator_traits<InputIterator>::value_type& lo,
+	                               const typename std::iterator_traits<InputIterator>::value_type& hi)
+	{
+		EASTL_ASSERT(!(hi < lo));
+
+		return std::Internal::minmax_imp<std::Internal::is_clamp_vectorizable<InputIterator, OutputIterator>::value>::do_clamp_transform(first, last, result, lo, hi);
+	}
+
+
+
 } // namespace std
 
 
@@ -0,0 +1,756 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// binary_oarchive and binary_iarchive write values and containers in a
+// compact binary format and read them back.
+//
+// The archives write straight to a writer and read straight from a reader,
+// in a single pass, without building an intermediate buffer. A writer is
+// anything with size_t write(const uint8_t*, size_t), so an Arduino Serial or
+// any other Print can be passed as is. A reader is anything with
+// size_t read(uint8_t*, size_t). buffer_writer, container_writer,
+// counting_writer, buffer_reader and stream_reader cover the common cases.
+//
+// Wire format:
+//     arithmetic, enum   sizeof(T) bytes in the archive byte order (little
+//                        endian unless given); bool is one byte
+//     length             unsigned LEB128 varint, 1 byte below 128
+//     sequence           length, then the elements (vector, fixed_vector,
+//                        string, deque, list, ...)
+//     associative        length, then the elements; pairs as key then value
+//                        (map, vector_map, hash_map, set, ...)
+//     array<T, N>, T[N]  the N elements, no length
+//     pair, tuple        the members in order
+//     optional           one byte 0/1, then the value if there is one
+//     variant            index as a varint, then the alternative; C++14 and
+//                        later only, as EASTL's variant needs C++14
+//     user types         whatever their serialize() writes
+//
+// Contiguous containers of arithmetic or bitwise types are written and read
+// with one write/read call for the whole array when the archive byte order is
+// the native one, and swapped through a small stack buffer otherwise.
+//
+// int, long, size_t and double are 2, 4, 2 and 4 bytes on AVR but not on
+// 32 and 64 bit hosts. Use the fixed width types (int16_t, uint32_t, float)
+// in anything exchanged between the two.
+//
+// Example usage:
+//     struct Sample
+//     {
+//         uint32_t time;
+//         float    value;
+//         fixed_string<char, 16> name;
+//
+//         template <typename Archive>
+//         void serialize(Archive& ar) { ar(time, value, name); }
+//     };
+//
+//     uint8_t frame[64];
+//     buffer_writer out(frame, sizeof(frame));
+//     binary_oarchive<buffer_writer> oa(out);
+//     oa << samples;                            // vector<Sample>
+//     Serial.write(frame, out.size());
+//
+//     buffer_reader in(frame, n);
+//     binary_iarchive<buffer_reader> ia(in);
+//     if(!(ia >> samples))
+//         ...                                   // Short or malformed input.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_ARCHIVE_H
+#define EASTL_ARCHIVE_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/utility.h>
+#include <EASTL/array.h>
+#include <EASTL/tuple.h>
+#include <EASTL/optional.h>
+#if defined(EA_COMPILER_CPP14_ENABLED)
+	#include <EASTL/variant.h>
+#endif
+#include <string.h>
+
+namespace std
+{
+	/// is_bitwise_serializable
+	///
+	/// Types for which this is true are archived as their raw bytes, and
+	/// contiguous arrays of them with a single write or read. Arithmetic types
+	/// and enums are, and are byte swapped when the archive byte order is not
+	/// the native one. Other trivially copyable types, such as a packed struct
+	/// of uint8_t fields, can opt in by specializing this; their bytes are
+	/// then never swapped.
+	///
+	template <typename T>
+	struct is_bitwise_serializable : public integral_constant<bool, is_arithmetic<T>::value || is_enum<T>::value> {};
+
+
+	/// buffer_writer
+	///
+	/// Writes into a caller supplied buffer. A write that does not fit is
+	/// refused as a whole, which fails the archive.
+	///
+	class buffer_writer
+	{
+	public:
+		buffer_writer(void* pBuffer, size_t capacity)
+			: mpBegin(static_cast<uint8_t*>(pBuffer)), mpCurrent(mpBegin), mpEnd(mpBegin + capacity) {}
+
+		size_t write(const uint8_t* p, size_t n)
+		{
+			if(n > size_t(mpEnd - mpCurrent))
+				return 0;
+			if(n) // Neither pointer may be NULL for memcpy, even with a size of 0.
+				memcpy(mpCurrent, p, n);
+			mpCurrent += n;
+			return n;
+		}
+
+		const uint8_t* data() const     { return mpBegin; }
+		size_t         size() const     { return size_t(mpCurrent - mpBegin); }
+		size_t         capacity() const { return size_t(mpEnd - mpBegin); }
+		void           clear()          { mpCurrent = mpBegin; }
+
+	protected:
+		uint8_t* mpBegin;
+		uint8_t* mpCurrent;
+		uint8_t* mpEnd;
+	};
+
+
+	/// container_writer
+	///
+	/// Appends to a container of bytes, such as a vector<uint8_t>, string or
+	/// fixed_vector, with insert(end(), first, last).
+	///
+	template <typename Container>
+	class container_writer
+	{
+	public:
+		explicit container_writer(Container& container) : mContainer(container) {}
+
+		size_t write(const uint8_t* p, size_t n)
+		{
+			mContainer.insert(mContainer.end(), p, p + n);
+			return n;
+		}
+
+		Container& container() { return mContainer; }
+
+	protected:
+		Container& mContainer;
+	};
+
+
+	/// counting_writer
+	///
+	/// Discards the data and counts it, to find the archived size of a value
+	/// before sending it.
+	///
+	class counting_writer
+	{
+	public:
+		counting_writer() : mnSize(0) {}
+
+		size_t write(const uint8_t*, size_t n) { mnSize += n; return n; }
+
+		size_t size() const { return mnSize; }
+		void   clear()      { mnSize = 0; }
+
+	protected:
+		size_t mnSize;
+	};
+
+
+	/// buffer_reader
+	///
+	/// Reads from a caller supplied buffer. remaining() lets the archive reject
+	/// a length that cannot possibly be in the input before resizing anything.
+	///
+	class buffer_reader
+	{
+	public:
+		buffer_reader(const void* pBuffer, size_t size)
+			: mpCurrent(static_cast<const uint8_t*>(pBuffer)), mpEnd(mpCurrent + size) {}
+
+		size_t read(uint8_t* p, size_t n)
+		{
+			if(n > size_t(mpEnd - mpCurrent))
+				n = size_t(mpEnd - mpCurrent);
+			if(n) // Neither pointer may be NULL for memcpy, even with a size of 0.
+				memcpy(p, mpCurrent, n);
+			mpCurrent += n;
+			return n;
+		}
+
+		const uint8_t* data() const      { return mpCurrent; }
+		size_t         remaining() const { return size_t(mpEnd - mpCurrent); }
+
+	protected:
+		const uint8_t* mpCurrent;
+		const uint8_t* mpEnd;
+	};
+
+
+	/// stream_reader
+	///
+	/// Reads from an Arduino Stream such as Serial with readBytes, so reads
+	/// wait up to the stream timeout for the data to arrive.
+	///
+	template <typename Stream>
+	class stream_reader
+	{
+	public:
+		explicit stream_reader(Stream& stream) : mStream(stream) {}
+
+		size_t read(uint8_t* p, size_t n) { return mStream.readBytes(p, n); }
+
+		Stream& stream() { return mStream; }
+
+	protected:
+		Stream& mStream;
+	};
+
+
+	namespace Internal
+	{
+		// Overloads of ArchiveSave/ArchiveLoad are ranked by these tags, highest
+		// first, so that a type that looks like several things (a user struct
+		// with a serialize member that also has begin/end) gets the most
+		// specific one.
+		template <int N> struct ArchivePriority : public ArchivePriority<N - 1> {};
+		template <>      struct ArchivePriority<0> {};
+
+		typedef ArchivePriority<7> ArchivePriorityMax;
+
+		template <typename T, endian Order>
+		struct ArchiveIsRaw : public integral_constant<bool, is_bitwise_serializable<T>::value &&
+		                                                     (Order == endian::native || sizeof(T) == 1 || !(is_arithmetic<T>::value || is_enum<T>::value))> {};
+
+		inline void ArchiveByteSwap(uint8_t* p, size_t elementSize, size_t count)
+		{
+			for(; count; --count, p += elementSize)
+			{
+				for(size_t i = 0, j = elementSize - 1; i < j; ++i, --j)
+				{
+					const uint8_t temp = p[i];
+					p[i] = p[j];
+					p[j] = temp;
+				}
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		// User hooks
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename Archive, typename T>
+		inline auto ArchiveSave(Archive& ar, const T& value, ArchivePriority<7>) -> decltype(const_cast<T&>(value).serialize(ar), void())
+			{ const_cast<T&>(value).serialize(ar); }
+
+		template <typename Archive, typename T>
+		inline auto ArchiveLoad(Archive& ar, T& value, ArchivePriority<7>) -> decltype(value.serialize(ar), void())
+			{ value.serialize(ar); }
+
+		template <typename Archive, typename T>
+		inline auto ArchiveSave(Archive& ar, const T& value, ArchivePriority<6>) -> decltype(serialize(ar, const_cast<T&>(value)), void())
+			{ serialize(ar, const_cast<T&>(value)); }
+
+		template <typename Archive, typename T>
+		inline auto ArchiveLoad(Archive& ar, T& value, ArchivePriority<6>) -> decltype(serialize(ar, value), void())
+			{ serialize(ar, value); }
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Bitwise values
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename Archive, typename T>
+		inline typename enable_if<is_same<T, bool>::value>::type
+		ArchiveSave(Archive& ar, const T& value, ArchivePriority<5>)
+			{ const uint8_t byte = value ? 1 : 0; ar.write_bytes(&byte, 1); }
+
+		template <typename Archive, typename T>
+		inline typename enable_if<is_same<T, bool>::value>::type
+		ArchiveLoad(Archive& ar, T& value, ArchivePriority<5>)
+			{ uint8_t byte = 0; if(ar.read_bytes(&byte, 1)) value = (byte != 0); }
+
+		template <typename Archive, typename T>
+		inline typename enable_if<is_bitwise_serializable<T>::value>::type
+		ArchiveSave(Archive& ar, const T& value, ArchivePriority<4>)
+			{ ar.write_array(&value, 1); }
+
+		template <typename Archive, typename T>
+		inline typename enable_if<is_bitwise_serializable<T>::value>::type
+		ArchiveLoad(Archive& ar, T& value, ArchivePriority<4>)
+			{ ar.read_array(&value, 1); }
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Fixed shape types
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename Archive, typename T1, typename T2>
+		inline void ArchiveSave(Archive& ar, const pair<T1, T2>& value, ArchivePriority<3>)
+			{ ar(value.first, value.second); }
+
+		template <typename Archive, typename T1, typename T2>
+		inline void ArchiveLoad(Archive& ar, pair<T1, T2>& value, ArchivePriority<3>)
+			{ ar(value.first, value.second); }
+
+		template <typename Archive, typename T>
+		inline void ArchiveSaveArray(Archive& ar, const T* p, size_t n, true_type)  { ar.write_array(p, n); }
+		template <typename Archive, typename T>
+		inline void ArchiveSaveArray(Archive& ar, const T* p, size_t n, false_type) { for(; n && ar; --n) ar(*p++); }
+		template <typename Archive, typename T>
+		inline void ArchiveLoadArray(Archive& ar, T* p, size_t n, true_type)        { ar.read_array(p, n); }
+		template <typename Archive, typename T>
+		inline void ArchiveLoadArray(Archive& ar, T* p, size_t n, false_type)       { for(; n && ar; --n) ar(*p++); }
+
+		template <typename T>
+		struct ArchiveIsArrayBulk : public integral_constant<bool, is_bitwise_serializable<T>::value && !is_same<T, bool>::value> {};
+
+		template <typename Archive, typename T, size_t N>
+		inline void ArchiveSave(Archive& ar, const T (&value)[N], ArchivePriority<3>)
+			{ ArchiveSaveArray(ar, value, N, ArchiveIsArrayBulk<T>()); }
+
+		template <typename Archive, typename T, size_t N>
+		inline void ArchiveLoad(Archive& ar, T (&value)[N], ArchivePriority<3>)
+			{ ArchiveLoadArray(ar, value, N, ArchiveIsArrayBulk<T>()); }
+
+		template <typename Archive, typename T, size_t N>
+		inline void ArchiveSave(Archive& ar, const array<T, N>& value, ArchivePriority<3>)
+			{ ArchiveSaveArray(ar, value.data(), N, ArchiveIsArrayBulk<T>()); }
+
+		template <typename Archive, typename T, size_t N>
+		inline void ArchiveLoad(Archive& ar, array<T, N>& value, ArchivePriority<3>)
+			{ ArchiveLoadArray(ar, value.data(), N, ArchiveIsArrayBulk<T>()); }
+
+		#if EASTL_TUPLE_ENABLED
+			template <size_t I, size_t N>
+			struct ArchiveTupleEach
+			{
+				template <typename Archive, typename Tuple>
+				static void apply(Archive& ar, Tuple& value)
+				{
+					ar(get<I>(value));
+					ArchiveTupleEach<I + 1, N>::apply(ar, value);
+				}
+			};
+
+			template <size_t N>
+			struct ArchiveTupleEach<N, N>
+			{
+				template <typename Archive, typename Tuple>
+				static void apply(Archive&, Tuple&) {}
+			};
+
+			template <typename Archive, typename... Ts>
+			inline void ArchiveSave(Archive& ar, const tuple<Ts...>& value, ArchivePriority<3>)
+				{ ArchiveTupleEach<0, sizeof...(Ts)>::apply(ar, value); }
+
+			template <typename Archive, typename... Ts>
+			inline void ArchiveLoad(Archive& ar, tuple<Ts...>& value, ArchivePriority<3>)
+				{ ArchiveTupleEach<0, sizeof...(Ts)>::apply(ar, value); }
+		#endif
+
+		#if EASTL_OPTIONAL_ENABLED
+			template <typename Archive, typename T>
+			inline void ArchiveSave(Archive& ar, const optional<T>& value, ArchivePriority<3>)
+			{
+				ar(bool(value));
+				if(value)
+					ar(*value);
+			}
+
+			template <typename Archive, typename T>
+			inline void ArchiveLoad(Archive& ar, optional<T>& value, ArchivePriority<3>)
+			{
+				uint8_t engaged = 0;
+
+				if(!ar.read_bytes(&engaged, 1))
+					return;
+				if(engaged > 1)
+					ar.set_fail();
+				else if(!engaged)
+					value.reset();
+				else
+				{
+					value.emplace();
+					ar(*value);
+				}
+			}
+		#endif
+
+		// variant.h needs C++14, so on AVR's default gnu++11 there is no variant to archive.
+		#if defined(EA_COMPILER_CPP14_ENABLED)
+			template <size_t I, size_t N>
+			struct ArchiveVariantEach
+			{
+				template <typename Archive, typename Variant>
+				static void save(Archive& ar, const Variant& value)
+				{
+					if(value.index() == I)
+						ar(get<I>(value));
+					else
+						ArchiveVariantEach<I + 1, N>::save(ar, value);
+				}
+
+				template <typename Archive, typename Variant>
+				static void load(Archive& ar, Variant& value, size_t index)
+				{
+					if(index == I)
+						ar(value.template emplace<I>());
+					else
+						ArchiveVariantEach<I + 1, N>::load(ar, value, index);
+				}
+			};
+
+			template <size_t N>
+			struct ArchiveVariantEach<N, N>
+			{
+				template <typename Archive, typename Variant>
+				static void save(Archive&, const Variant&) {}
+
+				template <typename Archive, typename Variant>
+				static void load(Archive& ar, Variant&, size_t) { ar.set_fail(); }
+			};
+
+			template <typename Archive, typename... Ts>
+			inline void ArchiveSave(Archive& ar, const variant<Ts...>& value, ArchivePriority<3>)
+			{
+				ar.write_length(value.index());
+				ArchiveVariantEach<0, sizeof...(Ts)>::save(ar, value);
+			}
+
+			template <typename Archive, typename... Ts>
+			inline void ArchiveLoad(Archive& ar, variant<Ts...>& value, ArchivePriority<3>)
+			{
+				size_t index;
+
+				if(ar.read_length(index))
+					ArchiveVariantEach<0, sizeof...(Ts)>::load(ar, value, index);
+			}
+		#endif
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Containers
+		//
+		// Everything with begin/end and size is saved as a length followed by
+		// the elements. Loading depends on the kind of container: associative
+		// ones (with a key_type) get each element inserted, contiguous ones
+		// (with data) are resized and filled in one read where possible, and
+		// other sequences are resized and filled element by element.
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename Archive, typename Container>
+		inline auto ArchiveSave(Archive& ar, const Container& c, ArchivePriority<2>)
+			-> typename enable_if<ArchiveIsArrayBulk<typename Container::value_type>::value, decltype(c.data(), void())>::type
+		{
+			ar.write_length(c.size());
+			ar.write_array(c.data(), c.size());
+		}
+
+		template <typename Archive, typename Container>
+		inline auto ArchiveSave(Archive& ar, const Container& c, ArchivePriority<1>) -> decltype(c.begin() != c.end(), c.size(), void())
+		{
+			ar.write_length(c.size());
+			for(typename Container::const_iterator it = c.begin(), itEnd = c.end(); (it != itEnd) && ar; ++it)
+				ar(*it);
+		}
+
+		// Not every container has max_size (vector doesn't); those that do,
+		// such as fixed_vector without overflow, must not be resized past it.
+		template <typename Container>
+		inline auto ArchiveMaxSize(const Container& c, int) -> decltype(size_t(c.max_size())) { return c.max_size(); }
+		template <typename Container>
+		inline size_t ArchiveMaxSize(const Container&, ...) { return size_t(-1); }
+
+		template <typename Archive, typename Container>
+		inline void ArchiveLoadElement(Archive& ar, Container& c, true_type)    // map-like
+		{
+			typename remove_const<typename Container::key_type>::type key;
+			typename Container::mapped_type                           mapped;
+
+			if(ar(key, mapped))
+				c.insert(typename Container::value_type(move(key), move(mapped)));
+		}
+
+		template <typename Archive, typename Container>
+		inline void ArchiveLoadElement(Archive& ar, Container& c, false_type)   // set-like
+		{
+			typename remove_const<typename Container::key_type>::type key;
+
+			if(ar(key))
+				c.insert(move(key));
+		}
+
+		template <typename T, typename = void>
+		struct ArchiveHasMapped : public false_type {};
+		template <typename T>
+		struct ArchiveHasMapped<T, void_t<typename T::mapped_type>> : public true_type {};
+
+		template <typename Archive, typename Container>
+		inline auto ArchiveLoad(Archive& ar, Container& c, ArchivePriority<2>) -> decltype(declval<typename Container::key_type&>(), c.insert(declval<typename Container::value_type>()), void())
+		{
+			size_t n;
+
+			c.clear();
+			if(ar.read_length(n, ArchiveMaxSize(c, 0)))
+			{
+				for(; n && ar; --n)
+					ArchiveLoadElement(ar, c, ArchiveHasMapped<Container>());
+			}
+		}
+
+		template <typename Archive, typename Container>
+		inline auto ArchiveLoad(Archive& ar, Container& c, ArchivePriority<1>) -> decltype(c.resize(size_t()), c.data(), void())
+		{
+			size_t n;
+
+			if(!ar.read_length(n, ArchiveMaxSize(c, 0)))
+				c.clear();
+			else
+			{
+				c.resize(n);
+				ArchiveLoadArray(ar, c.data(), n, ArchiveIsArrayBulk<typename Container::value_type>());
+			}
+		}
+
+		template <typename Archive, typename Container>
+		inline auto ArchiveLoad(Archive& ar, Container& c, ArchivePriority<0>) -> decltype(c.resize(size_t()), c.begin() != c.end(), void())
+		{
+			size_t n;
+
+			if(!ar.read_length(n, ArchiveMaxSize(c, 0)))
+				c.clear();
+			else
+			{
+				c.resize(n);
+				for(typename Container::iterator it = c.begin(), itEnd = c.end(); (it != itEnd) && ar; ++it)
+					ar(*it);
+			}
+		}
+	}
+
+
+	/// binary_oarchive
+	///
+	/// Writes values to a writer. Once a write comes up short the archive is
+	/// failed and writes nothing more.
+	///
+	/// A user type is archived through a member
+	///     template <typename Archive> void serialize(Archive& ar);
+	/// or a free function found by argument dependent lookup
+	///     template <typename Archive> void serialize(Archive& ar, T& value);
+	/// listing its members with ar(a, b, c). The same function is used by both
+	/// archives; Archive::is_loading tells them apart where it matters.
+	///
+	template <typename Writer, endian Order = endian::little>
+	class binary_oarchive
+	{
+	public:
+		typedef Writer writer_type;
+
+		static const bool   is_loading = false;
+		static const endian byte_order = Order;
+
+		explicit binary_oarchive(Writer& writer) : mWriter(writer), mbGood(true) {}
+
+		template <typename... Ts>
+		binary_oarchive& operator()(const Ts&... values)
+		{
+			int expand[] = { 0, (Internal::ArchiveSave(*this, values, Internal::ArchivePriorityMax()), 0)... };
+			(void)expand;
+			return *this;
+		}
+
+		template <typename T>
+		binary_oarchive& operator<<(const T& value)
+		{
+			Internal::ArchiveSave(*this, value, Internal::ArchivePriorityMax());
+			return *this;
+		}
+
+		binary_oarchive& write_bytes(const void* p, size_t n)
+		{
+			if(mbGood && n && mWriter.write(static_cast<const uint8_t*>(p), n) != n)
+				mbGood = false;
+			return *this;
+		}
+
+		binary_oarchive& write_length(size_t n)
+		{
+			uint8_t bytes[(sizeof(size_t) * 8 + 6) / 7];
+			size_t  i = 0;
+
+			for(; n >= 0x80; n >>= 7)
+				bytes[i++] = uint8_t(n | 0x80);
+			bytes[i++] = uint8_t(n);
+			return write_bytes(bytes, i);
+		}
+
+		/// Writes count elements of a bitwise serializable type, swapping
+		/// through a stack buffer when the byte order needs it.
+		template <typename T>
+		binary_oarchive& write_array(const T* p, size_t count)
+		{
+			return write_array(p, count, Internal::ArchiveIsRaw<T, Order>());
+		}
+
+		bool good() const { return mbGood; }
+		bool fail() const { return !mbGood; }
+		explicit operator bool() const { return mbGood; }
+
+		Writer& writer() { return mWriter; }
+
+	protected:
+		template <typename T>
+		binary_oarchive& write_array(const T* p, size_t count, true_type)
+		{
+			return write_bytes(p, count * sizeof(T));
+		}
+
+		template <typename T>
+		binary_oarchive& write_array(const T* p, size_t count, false_type)
+		{
+			uint8_t      chunk[sizeof(T) < 32 ? 32 - 32 % sizeof(T) : sizeof(T)];
+			const size_t perChunk = sizeof(chunk) / sizeof(T);
+
+			while(count && mbGood)
+			{
+				const size_t n = count < perChunk ? count : perChunk;
+
+				memcpy(chunk, p, n * sizeof(T));
+				Internal::ArchiveByteSwap(chunk, sizeof(T), n);
+				write_bytes(chunk, n * sizeof(T));
+				p += n;
+				count -= n;
+			}
+			return *this;
+		}
+
+		Writer& mWriter;
+		bool    mbGood;
+	};
+
+
+	/// binary_iarchive
+	///
+	/// Reads values from a reader. Short input, a length larger than the
+	/// container can hold or than the reader has remaining, an out of range
+	/// variant index or an optional flag other than 0/1 fail the archive.
+	/// Once failed it reads nothing more; values read up to that point may
+	/// have been partly assigned.
+	///
+	template <typename Reader, endian Order = endian::little>
+	class binary_iarchive
+	{
+	public:
+		typedef Reader reader_type;
+
+		static const bool   is_loading = true;
+		static const endian byte_order = Order;
+
+		explicit binary_iarchive(Reader& reader) : mReader(reader), mbGood(true) {}
+
+		template <typename... Ts>
+		binary_iarchive& operator()(Ts&... values)
+		{
+			int expand[] = { 0, (Internal::ArchiveLoad(*this, values, Internal::ArchivePriorityMax()), 0)... };
+			(void)expand;
+			return *this;
+		}
+
+		template <typename T>
+		binary_iarchive& operator>>(T& value)
+		{
+			Internal::ArchiveLoad(*this, value, Internal::ArchivePriorityMax());
+			return *this;
+		}
+
+		binary_iarchive& read_bytes(void* p, size_t n)
+		{
+			if(!mbGood)
+				return *this;
+			if(n && mReader.read(static_cast<uint8_t*>(p), n) != n)
+				mbGood = false;
+			return *this;
+		}
+
+		binary_iarchive& read_length(size_t& n)
+		{
+			n = 0;
+			for(unsigned shift = 0; mbGood; shift += 7)
+			{
+				uint8_t byte;
+
+				if(!read_bytes(&byte, 1))
+					break;
+				if(shift >= sizeof(size_t) * 8 || (shift && (size_t(byte & 0x7f) << shift >> shift) != size_t(byte & 0x7f)))
+					mbGood = false;                     // More bits than a size_t holds.
+				else
+				{
+					n |= size_t(byte & 0x7f) << shift;
+					if(!(byte & 0x80))
+						return *this;
+				}
+			}
+			n = 0;
+			return *this;
+		}
+
+		/// Reads a length for a container of at most maxSize elements, each of
+		/// which takes at least one byte of input.
+		binary_iarchive& read_length(size_t& n, size_t maxSize)
+		{
+			if(read_length(n) && (n > maxSize || n > remaining_or(n, (Reader*)0)))
+			{
+				mbGood = false;
+				n = 0;
+			}
+			return *this;
+		}
+
+		template <typename T>
+		binary_iarchive& read_array(T* p, size_t count)
+		{
+			read_bytes(p, count * sizeof(T));
+			if(!Internal::ArchiveIsRaw<T, Order>::value && mbGood)
+				Internal::ArchiveByteSwap(reinterpret_cast<uint8_t*>(p), sizeof(T), count);
+			return *this;
+		}
+
+		bool good() const { return mbGood; }
+		bool fail() const { return !mbGood; }
+		explicit operator bool() const { return mbGood; }
+
+		void set_fail() { mbGood = false; }
+
+		Reader& reader() { return mReader; }
+
+	protected:
+		template <typename R>
+		auto remaining_or(size_t, R*) -> decltype(declval<R&>().remaining()) { return mReader.remaining(); }
+		size_t remaining_or(size_t n, ...) { return n; }
+
+		Reader& mReader;
+		bool    mbGood;
+	};
+
+
+
+} // namespace std
+
+
+#endif // Header include guard
+
+
@@ -454,7 +454,7 @@ namespace std
 	///////////////////////////////////////////////////////////////////////
 	// to_array
 	///////////////////////////////////////////////////////////////////////
-	namespace internal
+	namespace Internal
 	{
 		template<class T, size_t N, size_t... I>
 		EA_CONSTEXPR auto to_array(T (&a)[N], index_sequence<I...>)
@@ -476,7 +476,7 @@ namespace std
 	{
 		static_assert(std::is_constructible<T, T&>::value, "element type T must be copy-initializable");
 		static_assert(!std::is_array<T>::value, "passing multidimensional arrays to to_array is ill-formed");
-		return internal::to_array(a, std::make_index_sequence<N>{});
+		return Internal::to_array(a, std::make_index_sequence<N>{});
 	}
 
 	template<class T, size_t N>
@@ -484,7 +484,7 @@ namespace std
 	{
 		static_assert(std::is_move_constructible<T>::value, "element type T must be move-constructible");
 		static_assert(!std::is_array<T>::value, "passing multidimensional arrays to to_array is ill-formed");
-		return internal::to_array(std::move(a), std::make_index_sequence<N>{});
+		return Internal::to_array(std::move(a), std::make_index_sequence<N>{});
 	}
 
 #if EASTL_TUPLE_ENABLED
@@ -0,0 +1,932 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// A binary log that defers formatting until there is time for it.
+//
+// EASTL_BINARY_LOG records the address of a static log_site, which holds the
+// format string literal and the argument types, the low 32 bits of a
+// steady_clock reading and the raw bytes of the arguments into a
+// fixed_ring_buffer. The text is produced later: by format_next() in idle time
+// on the device, or by binary_log_decoder on a host reading what drain()
+// sent over a serial link. Logging is a clock read and a few stores.
+//
+// When the ring is full a new record either overwrites the oldest ones
+// (log_overwrite_oldest, the default) or is dropped (log_drop_newest). Either
+// way the number lost is counted and reported in the formatted output, in
+// the place the records were lost from.
+//
+// The format string is printf style. The length modifiers in it are ignored;
+// the recorded types decide how wide an argument is. Arguments may be
+// integers, enums, floating point values, pointers and string literals
+// (const char*). Strings are recorded by address, so they must outlive the
+// record; on the host they are printed through a resolver if one is given,
+// otherwise as an address.
+//
+// Record layout, in native byte order:
+//     uint8_t    size of the arguments in bytes
+//     uintptr_t  address of the log_site
+//     uint32_t   low 32 bits of Clock::now().time_since_epoch().count()
+//     ...        the arguments, each in its recorded type
+//
+// drain() stream, the records above plus:
+//     0xFF header      uint8_t sizeof(uintptr_t), uint32_t period num, den
+//     0xFE dropped     uint32_t count of records lost
+//     0xFD descriptor  uintptr_t site, uint8_t count, count type codes,
+//                      the format string and its terminating 0
+// A site is described before its first record in each stream. A log starts a
+// new stream when it is constructed and on reset_stream().
+//
+// Example usage:
+//     binary_log<256> log;
+//
+//     EASTL_BINARY_LOG(log, "pid e=%d u=%f", error, output);    // Hot path.
+//
+//     char line[64];                                            // Idle time.
+//     while(log.format_next(line, sizeof(line)))
+//         Serial.println(line);
+//  or
+//     log.drain(Serial);           // Decoded on the host by binary_log_decoder.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_BINARY_LOG_H
+#define EASTL_BINARY_LOG_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/charconv.h>
+#include <EASTL/chrono.h>
+#include <EASTL/bonus/fixed_ring_buffer.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <stdio.h>
+#include <string.h>
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_BINARY_LOG_MAX_ARGS
+//
+// The most argument bytes a single record may carry. It bounds the stack
+// used to build and drain a record.
+//
+#ifndef EASTL_BINARY_LOG_MAX_ARGS
+	#define EASTL_BINARY_LOG_MAX_ARGS 32
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_BINARY_LOG
+//
+// EASTL_BINARY_LOG(log, format, args...) records one event. The format must
+// be a string literal. The arguments are evaluated once.
+//
+#define EASTL_BINARY_LOG(log, ...)                                                                       \
+	do                                                                                                   \
+	{                                                                                                    \
+		typedef decltype(std::Internal::LogSignatureOf(__VA_ARGS__)) EASTLBinaryLogSignature;            \
+		static std::log_site eastlBinaryLogSite = { EASTL_BINARY_LOG_FORMAT_(__VA_ARGS__, 0),            \
+		                                            EASTLBinaryLogSignature::kTypes,                     \
+		                                            EASTLBinaryLogSignature::kCount, 0 };                \
+		(log).write(eastlBinaryLogSite, __VA_ARGS__);                                                    \
+	} while(0)
+
+#define EASTL_BINARY_LOG_FORMAT_(format, ...) format
+
+
+
+namespace std
+{
+	/// log_overflow_policy
+	///
+	/// What binary_log does with a record that does not fit.
+	///
+	enum log_overflow_policy
+	{
+		log_overwrite_oldest,   // Discard the oldest records until it fits.
+		log_drop_newest         // Discard the new record.
+	};
+
+
+	/// log_site
+	///
+	/// One per EASTL_BINARY_LOG statement, in static storage. Its address is
+	/// the ID recorded with each event.
+	///
+	struct log_site
+	{
+		const char*    format;
+		const uint8_t* types;      // Type codes: kind in the high nibble, size in the low.
+		uint8_t        count;
+		uint32_t       described;  // The drain() stream last sent the descriptor, or 0.
+	};
+
+
+	namespace Internal
+	{
+		enum LogKind
+		{
+			kLogSigned,
+			kLogUnsigned,
+			kLogFloat,
+			kLogChar,
+			kLogString,
+			kLogPointer
+		};
+
+		// Numbers drain() streams, so that a site shared by two logs is described
+		// to each. 0 means none.
+		inline uint32_t LogNewStream()
+		{
+			static uint32_t nStream = 0;
+
+			if(++nStream == 0)
+				++nStream;
+			return nStream;
+		}
+
+		const uint8_t kLogHeader     = 0xFF;
+		const uint8_t kLogDropped    = 0xFE;
+		const uint8_t kLogDescriptor = 0xFD;
+
+		static_assert(EASTL_BINARY_LOG_MAX_ARGS < kLogDescriptor, "EASTL_BINARY_LOG_MAX_ARGS must leave the tag values free.");
+
+
+		// LogArg maps an argument type to the type it is recorded as.
+		template <typename T, typename Enable = void>
+		struct LogArg
+		{
+			static_assert(sizeof(T) == 0, "binary_log arguments must be arithmetic, enum, pointer or string literal types.");
+		};
+
+		template <typename T, LogKind Kind>
+		struct LogArgAs
+		{
+			typedef T stored_type;
+			static const uint8_t kCode = uint8_t((Kind << 4) | sizeof(T));
+		};
+
+		template <typename T>
+		struct LogArg<T, typename enable_if<is_integral<T>::value>::type>
+			: public LogArgAs<T, is_signed<T>::value ? kLogSigned : kLogUnsigned> {};
+
+		template <typename T>
+		struct LogArg<T, typename enable_if<is_enum<T>::value>::type>
+			: public LogArg<typename underlying_type<T>::type> {};
+
+		template <> struct LogArg<char>        : public LogArgAs<char, kLogChar> {};
+		template <> struct LogArg<bool>        : public LogArgAs<uint8_t, kLogUnsigned> {};
+		template <> struct LogArg<float>       : public LogArgAs<float, kLogFloat> {};
+		template <> struct LogArg<double>      : public LogArgAs<double, kLogFloat> {};
+		template <> struct LogArg<long double> : public LogArgAs<double, kLogFloat> {};
+		template <> struct LogArg<char*>       : public LogArgAs<const char*, kLogString> {};
+		template <> struct LogArg<const char*> : public LogArgAs<const char*, kLogString> {};
+
+		template <typename T>
+		struct LogArg<T*, void> : public LogArgAs<const void*, kLogPointer> {};
+
+
+		template <typename... Args>
+		struct LogArgsSize;
+
+		template <>
+		struct LogArgsSize<> { static const size_t value = 0; };
+
+		template <typename T, typename... Args>
+		struct LogArgsSize<T, Args...>
+		{
+			static const size_t value = sizeof(typename LogArg<T>::stored_type) + LogArgsSize<Args...>::value;
+		};
+
+
+		template <typename... Args>
+		struct LogSignature
+		{
+			static const uint8_t kTypes[];
+			static const uint8_t kCount = uint8_t(sizeof...(Args));
+			static const size_t  kSize  = LogArgsSize<Args...>::value;
+		};
+
+		template <typename... Args>
+		const uint8_t LogSignature<Args...>::kTypes[] = { LogArg<Args>::kCode..., 0 };
+
+		// Only named in decltype, so the arguments are never evaluated for it.
+		template <typename... Args>
+		LogSignature<typename decay<Args>::type...> LogSignatureOf(const char* format, const Args&... args);
+
+
+		inline void LogStore(uint8_t*) {}
+
+		template <typename T, typename... Args>
+		inline void LogStore(uint8_t* p, const T& value, const Args&... args)
+		{
+			typedef typename LogArg<typename decay<T>::type>::stored_type stored_type;
+
+			const stored_type stored = (stored_type)value;
+			memcpy(p, &stored, sizeof(stored));
+			LogStore(p + sizeof(stored), args...);
+		}
+
+
+		// Extends a 32 bit timestamp to 64 bits, given the previous one.
+		inline uint64_t LogUnwrapTime(uint64_t& last, uint32_t t)
+		{
+			uint64_t t64 = (last & ~uint64_t(0xFFFFFFFF)) | t;
+
+			if(t64 < last)
+				t64 += uint64_t(1) << 32;
+			return last = t64;
+		}
+
+		inline uint64_t LogTicksToMicroseconds(uint64_t ticks, uint32_t num, uint32_t den)
+		{
+			if(den >= 1000000)
+				return ticks * num / (den / 1000000);
+			return ticks * num * (1000000 / den);
+		}
+
+
+		// Appends to a char buffer, truncating and always 0 terminated.
+		class LogText
+		{
+		public:
+			LogText(char* p, size_t n) : mpText(p), mnSize(0), mnCapacity(n ? n - 1 : 0) { if(n) *p = 0; }
+
+			void put(char c)
+			{
+				if(mnSize < mnCapacity)
+				{
+					mpText[mnSize++] = c;
+					mpText[mnSize] = 0;
+				}
+			}
+
+			template <typename T>
+			void print(const char* spec, T value)
+			{
+				if(mnSize < mnCapacity)
+				{
+					const int n = snprintf(mpText + mnSize, mnCapacity - mnSize + 1, spec, value);
+
+					if(n > 0)
+						mnSize += ((size_t)n < mnCapacity - mnSize) ? (size_t)n : (mnCapacity - mnSize);
+				}
+			}
+
+			// Prints value as printf would for spec (flags, width and precision)
+			// and conversion, one of "fFeEgGaA", but through to_chars: avr-libc's
+			// printf prints '?' for floating point. The '#' flag keeps the point
+			// but not, for %g, the trailing zeros.
+			void print_float(const char* spec, char conversion, double value)
+			{
+				bool bLeft = false, bPlus = false, bSpace = false, bZero = false, bPoint = false;
+				int  width = 0, precision = -1;
+
+				for(++spec; *spec && strchr("-+ #0", *spec); ++spec)
+				{
+					bLeft  |= (*spec == '-');
+					bPlus  |= (*spec == '+');
+					bSpace |= (*spec == ' ');
+					bZero  |= (*spec == '0');
+					bPoint |= (*spec == '#');
+				}
+				for(; (*spec >= '0') && (*spec <= '9'); ++spec)
+					width = (width * 10) + (*spec - '0');
+				if(*spec == '.')
+				{
+					for(precision = 0, ++spec; (*spec >= '0') && (*spec <= '9'); ++spec)
+						precision = (precision * 10) + (*spec - '0');
+				}
+
+				const char         lower = char(conversion | 0x20);
+				const chars_format fmt   = (lower == 'f') ? chars_format::fixed : (lower == 'e') ? chars_format::scientific
+				                         : (lower == 'a') ? chars_format::hex   : chars_format::general;
+
+				char  buffer[64];
+				char* pEnd   = buffer + sizeof(buffer) - 1; // Room to add the point.
+				char* pValue = buffer;
+
+				to_chars_result result = to_chars(pValue, pEnd, value, fmt, precision);
+
+				if(result.ec != errc()) // Too long for the buffer, as %f of a large value can be.
+					result = to_chars(pValue, pEnd, value);
+
+				pEnd = result.ptr;
+
+				const bool bNegative = (*pValue == '-');
+				const bool bFinite   = (value == value) && (value - value == 0);
+				const bool bHex      = bFinite && (fmt == chars_format::hex); // to_chars leaves out the "0x".
+
+				if(bNegative)
+					++pValue;
+				if(bPoint && bFinite && !memchr(pValue, '.', size_t(pEnd - pValue)))
+				{
+					char* pPoint = pValue;
+
+					while((pPoint != pEnd) && (*pPoint != 'e') && (*pPoint != 'p'))
+						++pPoint;
+					memmove(pPoint + 1, pPoint, size_t(pEnd++ - pPoint));
+					*pPoint = '.';
+				}
+				if(conversion != lower)
+				{
+					for(char* p = pValue; p != pEnd; ++p)
+						*p = ((*p >= 'a') && (*p <= 'z')) ? char(*p - 0x20) : *p;
+				}
+
+				const char sign   = bNegative ? '-' : bPlus ? '+' : bSpace ? ' ' : 0;
+				const int  length = int(pEnd - pValue) + (sign ? 1 : 0) + (bHex ? 2 : 0);
+				const bool bPad   = (width > length);
+
+				if(bPad && !bLeft && !(bZero && bFinite))
+					put(' ', width - length);
+				if(sign)
+					put(sign);
+				if(bHex)
+				{
+					put('0');
+					put(char(conversion + ('x' - 'a')));
+				}
+				if(bPad && !bLeft && bZero && bFinite)
+					put('0', width - length);
+				for(const char* p = pValue; p != pEnd; ++p)
+					put(*p);
+				if(bPad && bLeft)
+					put(' ', width - length);
+			}
+
+			size_t size() const { return mnSize; }
+
+		protected:
+			void put(char c, int n)
+			{
+				while(n-- > 0)
+					put(c);
+			}
+
+			char*  mpText;
+			size_t mnSize;
+			size_t mnCapacity;
+		};
+
+		#if defined(__AVR__)
+			typedef long          LogLong;   // avr-libc printf has no %lld.
+			typedef unsigned long LogULong;
+			#define EASTL_BINARY_LOG_LONG "l"
+		#else
+			typedef long long          LogLong;
+			typedef unsigned long long LogULong;
+			#define EASTL_BINARY_LOG_LONG "ll"
+		#endif
+
+		inline LogULong LogReadUnsigned(const uint8_t* p, size_t size)
+		{
+			switch(size)
+			{
+				case 1: { uint8_t  v; memcpy(&v, p, 1); return v; }
+				case 2: { uint16_t v; memcpy(&v, p, 2); return v; }
+				case 4: { uint32_t v; memcpy(&v, p, 4); return v; }
+				default: { uint64_t v; memcpy(&v, p, 8); return (LogULong)v; }
+			}
+		}
+
+		inline LogLong LogReadSigned(const uint8_t* p, size_t size)
+		{
+			switch(size)
+			{
+				case 1: { int8_t  v; memcpy(&v, p, 1); return v; }
+				case 2: { int16_t v; memcpy(&v, p, 2); return v; }
+				case 4: { int32_t v; memcpy(&v, p, 4); return v; }
+				default: { int64_t v; memcpy(&v, p, 8); return (LogLong)v; }
+			}
+		}
+
+		inline double LogReadFloat(const uint8_t* p, size_t size)
+		{
+			if(size == sizeof(float))
+			{
+				float v;
+				memcpy(&v, p, sizeof(v));
+				return v;
+			}
+			else
+			{
+				double v;
+				memcpy(&v, p, sizeof(v));
+				return v;
+			}
+		}
+
+		// Formats one record. resolve turns a recorded string address into
+		// the string, or returns NULL to have the address printed.
+		inline size_t LogFormat(char* pText, size_t nText, const char* format, const uint8_t* types, size_t count,
+		                        const uint8_t* args, size_t nArgs, const char* (*resolve)(uint64_t))
+		{
+			LogText text(pText, nText);
+			size_t  arg = 0;
+
+			for(const char* p = format; *p; )
+			{
+				if((*p != '%') || (p[1] == '%'))
+				{
+					text.put(*p);
+					p += (*p == '%') ? 2 : 1;
+					continue;
+				}
+
+				char   spec[16] = { '%' };
+				size_t s = 1;
+
+				for(++p; *p && strchr("-+ #0123456789.", *p); ++p)
+				{
+					if(s < 10)
+						spec[s++] = *p;
+				}
+				while(*p && strchr("hlLjzt", *p))
+					++p;
+
+				const char conversion = *p ? *p++ : 's';
+
+				if((arg >= count) || ((types[arg] & 0x0F) > nArgs))
+				{
+					text.put('?');
+					continue;
+				}
+
+				const LogKind  kind = LogKind(types[arg] >> 4);
+				const size_t   size = types[arg] & 0x0F;
+				const uint8_t* pArg = args;
+
+				++arg;
+				args  += size;
+				nArgs -= size;
+
+				if((kind == kLogString) && (conversion == 's'))
+				{
+					const char* pString = resolve ? resolve(LogReadUnsigned(pArg, size)) : NULL;
+
+					if(pString)
+					{
+						strcpy(spec + s, "s");
+						text.print(spec, pString);
+						continue;
+					}
+				}
+
+				if((kind == kLogString) || (kind == kLogPointer) || (conversion == 'p') || (conversion == 's'))
+				{
+					strcpy(spec + s, EASTL_BINARY_LOG_LONG "x");
+					text.put('0');
+					text.put('x');
+					text.print(spec, LogReadUnsigned(pArg, size));
+				}
+				else if(strchr("fFeEgGaA", conversion))
+				{
+					text.print_float(spec, conversion, (kind == kLogFloat)    ? LogReadFloat(pArg, size)
+					                                 : (kind == kLogUnsigned) ? (double)LogReadUnsigned(pArg, size)
+					                                                          : (double)LogReadSigned(pArg, size));
+				}
+				else if(conversion == 'c')
+				{
+					spec[s++] = 'c';
+					text.print(spec, (int)LogReadSigned(pArg, size));
+				}
+				else if(strchr("di", conversion))
+				{
+					strcpy(spec + s, EASTL_BINARY_LOG_LONG "d");
+					text.print(spec, (kind == kLogFloat)    ? (LogLong)LogReadFloat(pArg, size)
+					               : (kind == kLogUnsigned) ? (LogLong)LogReadUnsigned(pArg, size)
+					                                        : LogReadSigned(pArg, size));
+				}
+				else // o u x X
+				{
+					strcpy(spec + s, EASTL_BINARY_LOG_LONG);
+					spec[s + sizeof(EASTL_BINARY_LOG_LONG) - 1] = strchr("ouxX", conversion) ? conversion : 'u';
+					text.print(spec, (kind == kLogFloat) ? (LogULong)LogReadFloat(pArg, size) : LogReadUnsigned(pArg, size));
+				}
+			}
+
+			return text.size();
+		}
+
+		inline const char* LogNativeString(uint64_t address)
+		{
+			return reinterpret_cast<const char*>((uintptr_t)address);
+		}
+
+		// Prints "[seconds.micros] " for a timestamp in microseconds.
+		inline void LogFormatTime(LogText& text, uint64_t us)
+		{
+			text.print("[%lu", (unsigned long)(us / 1000000));
+			text.print(".%06lu] ", (unsigned long)(us % 1000000));
+		}
+
+	} // namespace Internal
+
+
+
+	/// binary_log
+	///
+	/// A fixed size log of records written by EASTL_BINARY_LOG. N is the
+	/// capacity in bytes; a record takes 5 + sizeof(void*) bytes plus its
+	/// arguments. Not safe to write from an interrupt while the main code
+	/// writes or drains it.
+	///
+	template <size_t N, log_overflow_policy Policy = log_overwrite_oldest, typename Clock = chrono::steady_clock>
+	class binary_log
+	{
+	public:
+		typedef binary_log<N, Policy, Clock> this_type;
+		typedef Clock                        clock_type;
+
+		static const size_t kHeaderSize    = 1 + sizeof(uintptr_t) + sizeof(uint32_t);
+		static const size_t kMaxRecordSize = kHeaderSize + EASTL_BINARY_LOG_MAX_ARGS;
+
+		binary_log() : mBuffer(N), mnDropped(0), mnDropAt(0), mnLastTime(0), mnStream(Internal::LogNewStream()), mbHeaderSent(false) {}
+
+		/// Records one event for site. Called by EASTL_BINARY_LOG, which
+		/// passes the format again as the second argument.
+		template <typename... Args>
+		void write(log_site& site, const char*, const Args&... args)
+		{
+			typedef Internal::LogSignature<typename decay<Args>::type...> signature;
+
+			static_assert(signature::kSize <= EASTL_BINARY_LOG_MAX_ARGS, "binary_log record larger than EASTL_BINARY_LOG_MAX_ARGS.");
+			static_assert(kHeaderSize + signature::kSize <= N, "binary_log record larger than the log.");
+
+			uint8_t record[kHeaderSize + signature::kSize];
+
+			if(!MakeRoom(sizeof(record)))
+				return;
+
+			const uintptr_t id = reinterpret_cast<uintptr_t>(&site);
+			const uint32_t  t  = uint32_t(Clock::now().time_since_epoch().count());
+
+			record[0] = uint8_t(signature::kSize);
+			memcpy(record + 1, &id, sizeof(id));
+			memcpy(record + 1 + sizeof(id), &t, sizeof(t));
+			Internal::LogStore(record + kHeaderSize, args...);
+			mBuffer.push_back(record, sizeof(record));
+		}
+
+		/// Formats the oldest record as "[seconds.micros] text" into pText
+		/// and removes it. A count of lost records is its own line, where the
+		/// first of them was lost. Returns the length of the line, or 0 if
+		/// there was nothing.
+		size_t format_next(char* pText, size_t nText)
+		{
+			Internal::LogText text(pText, nText);
+
+			if(mnDropped && !mnDropAt)
+			{
+				text.print("(%lu records dropped)", (unsigned long)mnDropped);
+				mnDropped = 0;
+				return text.size();
+			}
+			if(mBuffer.empty())
+				return 0;
+
+			uint8_t         record[kMaxRecordSize];
+			const size_t    nRecord = Peek(record);
+			const log_site* pSite   = Site(record);
+			uint32_t        t;
+
+			memcpy(&t, record + 1 + sizeof(uintptr_t), sizeof(t));
+			Internal::LogFormatTime(text, Internal::LogTicksToMicroseconds(Internal::LogUnwrapTime(mnLastTime, t),
+			                                                               uint32_t(Clock::period::num), uint32_t(Clock::period::den)));
+			const size_t nTime = text.size();
+			const size_t nLine = Internal::LogFormat(pText + nTime, nText - nTime, pSite->format, pSite->types, pSite->count,
+			                                         record + kHeaderSize, record[0], &Internal::LogNativeString);
+			Pop(nRecord);
+			return nTime + nLine;
+		}
+
+		/// Sends the records, oldest first, to writer (anything with
+		/// size_t write(const uint8_t*, size_t), such as Serial) for
+		/// binary_log_decoder to format. Stops at the first short write,
+		/// leaving that record in the log. Returns the number of records sent.
+		template <typename Writer>
+		size_t drain(Writer& writer, size_t nMaxRecords = size_t(-1))
+		{
+			if(!mbHeaderSent)
+			{
+				uint8_t header[2 + 2 * sizeof(uint32_t)] = { Internal::kLogHeader, uint8_t(sizeof(uintptr_t)) };
+				const uint32_t num = uint32_t(Clock::period::num), den = uint32_t(Clock::period::den);
+
+				memcpy(header + 2, &num, sizeof(num));
+				memcpy(header + 2 + sizeof(num), &den, sizeof(den));
+				if(writer.write(header, sizeof(header)) != sizeof(header))
+					return 0;
+				mbHeaderSent = true;
+			}
+
+			size_t nRecords = 0;
+
+			for(;;)
+			{
+				if(mnDropped && !mnDropAt)
+				{
+					uint8_t dropped[1 + sizeof(uint32_t)] = { Internal::kLogDropped };
+					const uint32_t n = uint32_t(mnDropped);
+
+					memcpy(dropped + 1, &n, sizeof(n));
+					if(writer.write(dropped, sizeof(dropped)) != sizeof(dropped))
+						break;
+					mnDropped = 0;
+				}
+				if((nRecords == nMaxRecords) || mBuffer.empty())
+					break;
+
+				uint8_t      record[kMaxRecordSize];
+				const size_t nRecord = Peek(record);
+				log_site*    pSite   = Site(record);
+
+				if(pSite->described != mnStream)
+				{
+					uint8_t descriptor[1 + sizeof(uintptr_t) + 1] = { Internal::kLogDescriptor };
+					const size_t nFormat = strlen(pSite->format) + 1;
+
+					memcpy(descriptor + 1, record + 1, sizeof(uintptr_t));
+					descriptor[1 + sizeof(uintptr_t)] = pSite->count;
+					if((writer.write(descriptor, sizeof(descriptor)) != sizeof(descriptor)) ||
+					   (writer.write(pSite->types, pSite->count) != pSite->count) ||
+					   (writer.write(reinterpret_cast<const uint8_t*>(pSite->format), nFormat) != nFormat))
+						break;
+					pSite->described = mnStream;
+				}
+
+				if(writer.write(record, nRecord) != nRecord)
+					break;
+				Pop(nRecord);
+				++nRecords;
+			}
+
+			return nRecords;
+		}
+
+		bool   empty() const    { return mBuffer.empty(); }
+		size_t size() const     { return mBuffer.size(); }     // In bytes.
+		size_t capacity() const { return N; }
+		size_t dropped() const  { return mnDropped; }          // Records lost since last reported.
+
+		void clear()
+		{
+			mBuffer.clear();
+			mnDropped = 0;
+			mnDropAt  = 0;
+		}
+
+		/// Starts the drain() stream again, for a decoder that has just
+		/// connected or restarted: the next drain() sends the header, and
+		/// each site is described again before its next record.
+		void reset_stream()
+		{
+			mnStream     = Internal::LogNewStream();
+			mbHeaderSent = false;
+		}
+
+	protected:
+		bool MakeRoom(size_t n)
+		{
+			if(EASTL_LIKELY(N - mBuffer.size() >= n))
+				return true;
+
+			if(Policy == log_drop_newest)
+			{
+				if(!mnDropped++)
+					mnDropAt = mBuffer.size();  // The count goes after what is in the log now.
+				return false;
+			}
+
+			while(N - mBuffer.size() < n)
+			{
+				mBuffer.pop_front(kHeaderSize + mBuffer.front());
+				++mnDropped;
+			}
+			return true;
+		}
+
+		void Pop(size_t nRecord)
+		{
+			mBuffer.pop_front(nRecord);
+			mnDropAt = (mnDropAt > nRecord) ? (mnDropAt - nRecord) : 0;
+		}
+
+		// Copies the oldest record out of the ring; returns its size.
+		size_t Peek(uint8_t* pRecord) const
+		{
+			const size_t         nRecord = kHeaderSize + mBuffer.front();
+			span<const uint8_t>  one     = mBuffer.array_one();
+			const size_t         nOne    = (nRecord < one.size()) ? nRecord : one.size();
+
+			memcpy(pRecord, one.data(), nOne);
+			memcpy(pRecord + nOne, mBuffer.array_two().data(), nRecord - nOne);
+			return nRecord;
+		}
+
+		static log_site* Site(const uint8_t* pRecord)
+		{
+			uintptr_t id;
+			memcpy(&id, pRecord + 1, sizeof(id));
+			return reinterpret_cast<log_site*>(id);
+		}
+
+		fixed_ring_buffer<uint8_t, N> mBuffer;
+		size_t                        mnDropped;
+		size_t                        mnDropAt;      // Bytes to remove before mnDropped is reported.
+		uint64_t                      mnLastTime;
+		uint32_t                      mnStream;      // See Internal::LogNewStream.
+		bool                          mbHeaderSent;
+	};
+
+
+
+	/// binary_log_line
+	///
+	/// One formatted line from binary_log_decoder. text is valid until the
+	/// callback returns.
+	///
+	struct binary_log_line
+	{
+		uint64_t    time_us;    // Clock time of the record, in microseconds.
+		const char* text;       // Without the timestamp.
+		size_t      length;
+	};
+
+
+	/// binary_log_decoder
+	///
+	/// Formats the stream written by binary_log::drain(), typically on a host
+	/// reading a serial port. The stream may come from a device with a
+	/// different pointer size; the header says which. Both ends must use
+	/// the same byte order.
+	///
+	class binary_log_decoder
+	{
+	public:
+		typedef const char* (*string_resolver)(uint64_t address);
+
+		binary_log_decoder()
+			: mnIdSize(sizeof(uintptr_t)), mnNum(1), mnDen(1000000), mnLastTime(0), mnTime(0), mpResolver(NULL) {}
+
+		/// Strings are recorded by address. Given a resolver (for example one
+		/// that looks the address up in the firmware image) they are printed,
+		/// otherwise the address is.
+		void set_string_resolver(string_resolver resolver) { mpResolver = resolver; }
+
+		/// Decodes the complete records in [p, p + n), calling
+		/// function(const binary_log_line&) for each. Returns the number of
+		/// bytes used; the rest is the start of a record still to arrive.
+		template <typename Function>
+		size_t decode(const uint8_t* p, size_t n, Function function)
+		{
+			size_t nUsed = 0;
+
+			while(nUsed < n)
+			{
+				const size_t nRecord = DecodeOne(p + nUsed, n - nUsed, function);
+
+				if(!nRecord)
+					break;
+				nUsed += nRecord;
+			}
+
+			return nUsed;
+		}
+
+	protected:
+		struct Descriptor
+		{
+			uint64_t        mId;
+			string          mFormat;
+			vector<uint8_t> mTypes;
+
+			bool operator<(uint64_t id) const { return mId < id; }
+		};
+
+		// Sorted by mId. A vector rather than a hash_map, whose buckets need
+		// hashtable.cpp, and there are only as many entries as log statements.
+		typedef vector<Descriptor> DescriptorList;
+
+		Descriptor* FindDescriptor(uint64_t id)
+		{
+			DescriptorList::iterator it = lower_bound(mDescriptors.begin(), mDescriptors.end(), id);
+			return ((it != mDescriptors.end()) && (it->mId == id)) ? it : NULL;
+		}
+
+		Descriptor& InsertDescriptor(uint64_t id)
+		{
+			DescriptorList::iterator it = lower_bound(mDescriptors.begin(), mDescriptors.end(), id);
+
+			if((it == mDescriptors.end()) || (it->mId != id))
+			{
+				it = mDescriptors.insert(it, Descriptor());
+				it->mId = id;
+			}
+			return *it;
+		}
+
+		uint64_t ReadId(const uint8_t* p) const
+		{
+			return (mnIdSize == sizeof(uint16_t)) ? Internal::LogReadUnsigned(p, 2)
+			     : (mnIdSize == sizeof(uint32_t)) ? Internal::LogReadUnsigned(p, 4)
+			                                      : Internal::LogReadUnsigned(p, 8);
+		}
+
+		template <typename Function>
+		void Emit(uint64_t time, size_t length, Function& function)
+		{
+			binary_log_line line = { time, mText, length };
+			function(line);
+		}
+
+		template <typename Function>
+		size_t DecodeOne(const uint8_t* p, size_t n, Function& function)
+		{
+			switch(p[0])
+			{
+				case Internal::kLogHeader:
+				{
+					if(n < 2 + 2 * sizeof(uint32_t))
+						return 0;
+					mnIdSize = p[1];
+					memcpy(&mnNum, p + 2, sizeof(mnNum));
+					memcpy(&mnDen, p + 2 + sizeof(mnNum), sizeof(mnDen));
+					return 2 + 2 * sizeof(uint32_t);
+				}
+
+				case Internal::kLogDropped:
+				{
+					if(n < 1 + sizeof(uint32_t))
+						return 0;
+					uint32_t dropped;
+					memcpy(&dropped, p + 1, sizeof(dropped));
+					Emit(mnTime, (size_t)snprintf(mText, sizeof(mText), "(%lu records dropped)", (unsigned long)dropped), function);
+					return 1 + sizeof(uint32_t);
+				}
+
+				case Internal::kLogDescriptor:
+				{
+					const size_t nFixed = 1 + mnIdSize + 1;
+
+					if((n < nFixed) || (n < nFixed + p[nFixed - 1]))
+						return 0;
+
+					const uint8_t* pTypes  = p + nFixed;
+					const uint8_t* pFormat = pTypes + p[nFixed - 1];
+					const void*    pEnd    = memchr(pFormat, 0, n - size_t(pFormat - p));
+
+					if(!pEnd)
+						return 0;
+
+					Descriptor& descriptor = InsertDescriptor(ReadId(p + 1));
+					descriptor.mTypes.assign(pTypes, pFormat);
+					descriptor.mFormat.assign(reinterpret_cast<const char*>(pFormat));
+					return size_t(static_cast<const uint8_t*>(pEnd) - p) + 1;
+				}
+
+				default:
+				{
+					const size_t nRecord = 1 + mnIdSize + sizeof(uint32_t) + p[0];
+
+					if(n < nRecord)
+						return 0;
+
+					uint32_t t;
+					memcpy(&t, p + 1 + mnIdSize, sizeof(t));
+					mnTime = Internal::LogTicksToMicroseconds(Internal::LogUnwrapTime(mnLastTime, t), mnNum, mnDen);
+
+					const uint64_t    id          = ReadId(p + 1);
+					const Descriptor* pDescriptor = FindDescriptor(id);
+					size_t            length;
+
+					if(pDescriptor)
+						length = Internal::LogFormat(mText, sizeof(mText), pDescriptor->mFormat.c_str(), pDescriptor->mTypes.data(),
+						                             pDescriptor->mTypes.size(), p + nRecord - p[0], p[0], mpResolver);
+					else
+						length = (size_t)snprintf(mText, sizeof(mText), "(unknown site 0x%llx)", (unsigned long long)id);
+
+					Emit(mnTime, (length < sizeof(mText)) ? length : sizeof(mText) - 1, function);
+					return nRecord;
+				}
+			}
+		}
+
+		DescriptorList  mDescriptors;
+		size_t          mnIdSize;
+		uint32_t        mnNum;
+		uint32_t        mnDen;
+		uint64_t        mnLastTime;
+		uint64_t        mnTime;
+		string_resolver mpResolver;
+		char            mText[256];
+	};
+
+} // namespace std
+
+#endif // Header include guard
@@ -0,0 +1,675 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// COBS and SLIP packet framing for byte streams such as serial links.
+//
+// The encoders write a complete frame into a caller supplied buffer: the
+// payload, a CRC of it appended least significant byte first, escaped or
+// COBS encoded, and the delimiter. The payload may be written in several
+// pieces (for example both spans of a ring_buffer) between begin() and end().
+//
+// The decoders work incrementally on whatever bytes have arrived. consume()
+// reads up to and including the next delimiter, unescapes into the caller's
+// frame buffer and checks the CRC in the same pass, so received bytes are
+// never staged anywhere else. Given a ring_buffer, consume() reads straight
+// from its contiguous spans and pops what it used.
+//
+// Wire formats:
+//     COBS  Consistent Overhead Byte Stuffing; 0x00 delimits frames and
+//           never appears inside one. Overhead is 1 byte per 254 plus the
+//           delimiter.
+//     SLIP  RFC 1055; 0xC0 delimits frames, 0xC0 and 0xDB inside a frame
+//           are sent as 0xDB 0xDC and 0xDB 0xDD. Overhead is up to 2x.
+//           An empty frame looks like two delimiters in a row, so with
+//           no_crc an empty payload is never delivered.
+//
+// CRC policies: crc16_ccitt (CRC-16/CCITT-FALSE, the default), crc32
+// (IEEE 802.3, as used by zlib) and no_crc.
+//
+// Example usage:
+//     fixed_ring_buffer<uint8_t, 128> rx(128);      // Filled from Serial.
+//     uint8_t frame[64];
+//     cobs_decoder<> decoder(frame, sizeof(frame));
+//
+//     while(decoder.consume(rx) != frame_incomplete)
+//     {
+//         if(decoder.status() == frame_ok)
+//             handle(decoder.data(), decoder.size());
+//     }
+//
+//     uint8_t out[cobs_encoder<>::max_frame_size(sizeof(reading))];
+//     size_t n = cobs_encoder<>::encode(&reading, sizeof(reading), out, sizeof(out));
+//     Serial.write(out, n);
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_PACKET_FRAMING_H
+#define EASTL_PACKET_FRAMING_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <string.h>
+
+namespace std
+{
+	///////////////////////////////////////////////////////////////////////
+	// CRC policies
+	//
+	// Each has a value_type, the number of bytes it appends (kSize), and
+	// update/value/reset. They are small enough to keep by value.
+	///////////////////////////////////////////////////////////////////////
+
+	/// crc16_ccitt
+	///
+	/// CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, no
+	/// reflection or final xor. Computed a byte at a time without a table.
+	///
+	class crc16_ccitt
+	{
+	public:
+		typedef uint16_t value_type;
+		static const size_t kSize = 2;
+
+		crc16_ccitt() : mValue(0xFFFF) {}
+
+		void update(uint8_t byte)
+		{
+			uint8_t x = uint8_t((mValue >> 8) ^ byte);
+			x ^= uint8_t(x >> 4);
+			mValue = uint16_t((mValue << 8) ^ (uint16_t(x) << 12) ^ (uint16_t(x) << 5) ^ x);
+		}
+
+		void update(const uint8_t* p, size_t n)
+		{
+			while(n--)
+				update(*p++);
+		}
+
+		value_type value() const { return mValue; }
+		void       reset()       { mValue = 0xFFFF; }
+
+	protected:
+		value_type mValue;
+	};
+
+
+	/// crc32
+	///
+	/// CRC-32 as used by Ethernet, zlib and PNG: reflected polynomial
+	/// 0xEDB88320, initial value and final xor 0xFFFFFFFF. Computed a nibble
+	/// at a time with a 16 entry table, which is 64 bytes instead of 1KB.
+	///
+	class crc32
+	{
+	public:
+		typedef uint32_t value_type;
+		static const size_t kSize = 4;
+
+		crc32() : mValue(0xFFFFFFFF) {}
+
+		void update(uint8_t byte)
+		{
+			static const uint32_t kTable[16] =
+			{
+				0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+				0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+			};
+
+			mValue ^= byte;
+			mValue = (mValue >> 4) ^ kTable[mValue & 0x0F];
+			mValue = (mValue >> 4) ^ kTable[mValue & 0x0F];
+		}
+
+		void update(const uint8_t* p, size_t n)
+		{
+			while(n--)
+				update(*p++);
+		}
+
+		value_type value() const { return mValue ^ 0xFFFFFFFF; }
+		void       reset()       { mValue = 0xFFFFFFFF; }
+
+	protected:
+		value_type mValue;
+	};
+
+
+	/// no_crc
+	///
+	/// Frames without a check value, for links that have their own.
+	///
+	class no_crc
+	{
+	public:
+		typedef uint8_t value_type;
+		static const size_t kSize = 0;
+
+		void       update(uint8_t) {}
+		void       update(const uint8_t*, size_t) {}
+		value_type value() const { return 0; }
+		void       reset() {}
+	};
+
+
+	/// frame_status
+	///
+	/// What the last call to a decoder's consume() ended on. Anything other
+	/// than frame_incomplete means a delimiter was reached; the next call
+	/// starts a new frame.
+	///
+	enum frame_status
+	{
+		frame_incomplete,   // No delimiter yet; all the input was used.
+		frame_ok,           // data()/size() hold a payload whose CRC matched.
+		frame_bad_crc,      // Well formed, but the CRC did not match.
+		frame_too_long,     // The frame did not fit in the frame buffer.
+		frame_malformed     // Invalid encoding, or shorter than the CRC.
+	};
+
+
+	namespace Internal
+	{
+		/// FrameDecoderBase
+		///
+		/// The frame buffer and CRC handling shared by the decoders. The CRC
+		/// runs kSize bytes behind the output, so that when the delimiter
+		/// arrives it covers exactly the payload and the last kSize bytes are
+		/// the received CRC, without knowing the frame length in advance.
+		///
+		template <typename Crc>
+		class FrameDecoderBase
+		{
+		public:
+			const uint8_t* data() const      { return mpBuffer; }
+			size_t         size() const      { return (mStatus == frame_ok) ? (mnSize - Crc::kSize) : 0; }
+			size_t         capacity() const  { return mnCapacity; }
+			frame_status   status() const    { return mStatus; }
+
+		protected:
+			FrameDecoderBase(void* pBuffer, size_t capacity)
+				: mpBuffer(static_cast<uint8_t*>(pBuffer)), mnCapacity(capacity), mnSize(0), mStatus(frame_incomplete), mError(frame_incomplete) {}
+
+			void BeginIfDone()
+			{
+				if(mStatus != frame_incomplete)
+				{
+					mStatus = frame_incomplete;
+					mError  = frame_incomplete;
+					mnSize  = 0;
+					mCrc.reset();
+				}
+			}
+
+			void Put(uint8_t byte)
+			{
+				if(mnSize < mnCapacity)
+				{
+					mpBuffer[mnSize] = byte;
+					if(mnSize >= Crc::kSize)
+						mCrc.update(mpBuffer[mnSize - Crc::kSize]);
+					++mnSize;
+				}
+				else if(mError == frame_incomplete)
+					mError = frame_too_long;
+			}
+
+			void Put(const uint8_t* p, size_t n)
+			{
+				if(n > mnCapacity - mnSize)
+				{
+					n = mnCapacity - mnSize;
+					if(mError == frame_incomplete)
+						mError = frame_too_long;
+				}
+
+				memcpy(mpBuffer + mnSize, p, n);
+
+				const size_t crcEnd = mnSize + n;
+				size_t       i      = (mnSize >= Crc::kSize) ? (mnSize - Crc::kSize) : 0;
+
+				for(; i + Crc::kSize < crcEnd; ++i)
+					mCrc.update(mpBuffer[i]);
+				mnSize = crcEnd;
+			}
+
+			// Returns false for the nothing between back to back delimiters,
+			// which is skipped rather than reported.
+			bool Finish(bool bTruncated, bool bEmpty)
+			{
+				if(bEmpty)
+					return false;
+
+				if(mError != frame_incomplete)
+					mStatus = mError;
+				else if(bTruncated || mnSize < Crc::kSize)
+					mStatus = frame_malformed;
+				else
+				{
+					typename Crc::value_type received = 0;
+
+					for(size_t i = 0; i < Crc::kSize; ++i)
+						received |= typename Crc::value_type(mpBuffer[mnSize - Crc::kSize + i]) << (8 * i);
+					mStatus = (received == mCrc.value()) ? frame_ok : frame_bad_crc;
+				}
+				return true;
+			}
+
+			template <typename Decoder, typename RingBuffer>
+			static frame_status ConsumeRing(Decoder& decoder, RingBuffer& ringBuffer)
+			{
+				const auto one  = ringBuffer.array_one();
+				size_t     used = decoder.consume(one.data(), one.size());
+
+				if(decoder.status() == frame_incomplete)
+				{
+					const auto two = ringBuffer.array_two();
+					used += decoder.consume(two.data(), two.size());
+				}
+				ringBuffer.pop_front(used);
+				return decoder.status();
+			}
+
+			uint8_t*     mpBuffer;
+			size_t       mnCapacity;
+			size_t       mnSize;
+			frame_status mStatus;
+			frame_status mError;    // The first error seen in the current frame, reported at its delimiter.
+			Crc          mCrc;
+		};
+
+
+		/// FrameEncoderBase
+		///
+		/// The output buffer handling shared by the encoders. Running out of
+		/// room is sticky: end() then returns 0.
+		///
+		template <typename Crc>
+		class FrameEncoderBase
+		{
+		protected:
+			FrameEncoderBase() : mpBuffer(NULL), mnCapacity(0), mnSize(0), mbOverflow(false) {}
+
+			void Reset(void* pBuffer, size_t capacity)
+			{
+				mpBuffer   = static_cast<uint8_t*>(pBuffer);
+				mnCapacity = capacity;
+				mnSize     = 0;
+				mbOverflow = false;
+				mCrc.reset();
+			}
+
+			void Out(uint8_t byte)
+			{
+				if(mnSize < mnCapacity)
+					mpBuffer[mnSize++] = byte;
+				else
+					mbOverflow = true;
+			}
+
+			template <typename Encoder>
+			void WriteCrc(Encoder& encoder)
+			{
+				const typename Crc::value_type crc = mCrc.value();
+
+				for(size_t i = 0; i < Crc::kSize; ++i)
+				{
+					const uint8_t byte = uint8_t(crc >> (8 * i));
+					encoder.WritePayload(&byte, 1);
+				}
+			}
+
+			uint8_t* mpBuffer;
+			size_t   mnCapacity;
+			size_t   mnSize;
+			bool     mbOverflow;
+			Crc      mCrc;
+		};
+	}
+
+
+	/// cobs_encoder
+	///
+	/// Writes one COBS frame per begin()/end() pair. Each block's code byte
+	/// is reserved when the block starts and filled in when it ends, so the
+	/// payload is encoded in a single pass straight into the output buffer.
+	///
+	template <typename Crc = crc16_ccitt>
+	class cobs_encoder : protected Internal::FrameEncoderBase<Crc>
+	{
+		typedef Internal::FrameEncoderBase<Crc> base_type;
+		friend class Internal::FrameEncoderBase<Crc>;
+
+	public:
+		/// The largest frame a payload of n bytes can produce.
+		static EA_CONSTEXPR size_t max_frame_size(size_t n)
+			{ return n + Crc::kSize + (n + Crc::kSize) / 254 + 2; }
+
+		/// Encodes a whole payload; returns the frame size, or 0 if it did not fit.
+		static size_t encode(const void* pPayload, size_t n, void* pOut, size_t capacity)
+		{
+			cobs_encoder encoder;
+
+			encoder.begin(pOut, capacity);
+			encoder.write(pPayload, n);
+			return encoder.end();
+		}
+
+		cobs_encoder() : mnCode(0) {}
+
+		void begin(void* pOut, size_t capacity)
+		{
+			base_type::Reset(pOut, capacity);
+			StartBlock();
+		}
+
+		void write(const void* p, size_t n)
+		{
+			this->mCrc.update(static_cast<const uint8_t*>(p), n);
+			WritePayload(static_cast<const uint8_t*>(p), n);
+		}
+
+		/// Appends the CRC and the delimiter; returns the frame size, or 0 if
+		/// the frame did not fit.
+		size_t end()
+		{
+			base_type::WriteCrc(*this);
+			EndBlock();
+			base_type::Out(0);
+			return this->mbOverflow ? 0 : this->mnSize;
+		}
+
+	protected:
+		void StartBlock()
+		{
+			mnCode = this->mnSize;
+			base_type::Out(1);
+		}
+
+		void EndBlock()
+		{
+			if(mnCode < this->mnCapacity)
+				this->mpBuffer[mnCode] = uint8_t(this->mnSize - mnCode);
+		}
+
+		void WritePayload(const uint8_t* p, size_t n)
+		{
+			while(n)
+			{
+				if(*p == 0)
+				{
+					EndBlock();
+					StartBlock();
+					++p;
+					--n;
+					continue;
+				}
+
+				// Copy up to the next zero or the end of the block, whichever comes first.
+				size_t room = 255 - (this->mnSize - mnCode);
+				size_t run  = (n < room) ? n : room;
+				const void* pZero = memchr(p, 0, run);
+
+				if(pZero)
+					run = size_t(static_cast<const uint8_t*>(pZero) - p);
+				if(run > this->mnCapacity - this->mnSize)
+				{
+					run = this->mnCapacity - this->mnSize;
+					this->mbOverflow = true;
+					if(run == 0)
+						return;
+				}
+
+				memcpy(this->mpBuffer + this->mnSize, p, run);
+				this->mnSize += run;
+				p += run;
+				n -= run;
+				room -= run;
+
+				if(room == 0)           // A full block of 254 non-zero bytes has no implied zero.
+				{
+					EndBlock();
+					StartBlock();
+				}
+			}
+		}
+
+		size_t mnCode;  // Position of the current block's code byte.
+	};
+
+
+	/// cobs_decoder
+	///
+	/// Decodes COBS frames into a caller supplied buffer as their bytes
+	/// arrive. A zero byte ends the frame; bytes after the end of a bad frame
+	/// resynchronize at the next zero.
+	///
+	template <typename Crc = crc16_ccitt>
+	class cobs_decoder : public Internal::FrameDecoderBase<Crc>
+	{
+		typedef Internal::FrameDecoderBase<Crc> base_type;
+
+	public:
+		cobs_decoder(void* pFrameBuffer, size_t capacity)
+			: base_type(pFrameBuffer, capacity), mnBlockLeft(0), mbZeroPending(false), mbInFrame(false) {}
+
+		/// Decodes input up to and including the next delimiter. Returns the
+		/// number of bytes used; status() tells whether a frame ended.
+		size_t consume(const void* pInput, size_t n)
+		{
+			const uint8_t* const pBegin = static_cast<const uint8_t*>(pInput);
+			const uint8_t*       p      = pBegin;
+			const uint8_t* const pEnd   = p + n;
+
+			base_type::BeginIfDone();
+
+			while(p != pEnd)
+			{
+				if(mnBlockLeft)
+				{
+					// Data bytes: copy the run up to the end of the block or of the input.
+					size_t      run   = size_t(pEnd - p);
+					const void* pZero;
+
+					if(run > mnBlockLeft)
+						run = mnBlockLeft;
+					if((pZero = memchr(p, 0, run)) != NULL)
+						run = size_t(static_cast<const uint8_t*>(pZero) - p);
+
+					base_type::Put(p, run);
+					p += run;
+					mnBlockLeft -= run;
+					if(pZero == NULL)
+						continue;
+				}
+
+				const uint8_t byte = *p++;
+
+				if(byte == 0)
+				{
+					const bool bTruncated = (mnBlockLeft != 0);
+					const bool bEmpty     = !mbInFrame;
+
+					mnBlockLeft   = 0;
+					mbZeroPending = false;
+					mbInFrame     = false;
+					if(base_type::Finish(bTruncated, bEmpty))
+						break;
+				}
+				else
+				{
+					if(mbZeroPending)
+						base_type::Put(0);
+					mnBlockLeft   = size_t(byte - 1);
+					mbZeroPending = (byte != 0xFF);
+					mbInFrame     = true;
+				}
+			}
+
+			return size_t(p - pBegin);
+		}
+
+		/// Decodes from a ring_buffer's contiguous spans and pops what was used.
+		template <typename RingBuffer>
+		frame_status consume(RingBuffer& ringBuffer)
+			{ return base_type::ConsumeRing(*this, ringBuffer); }
+
+	protected:
+		size_t mnBlockLeft;     // Data bytes left in the current block.
+		bool   mbZeroPending;   // The current block ends in an implied zero, written if another block follows.
+		bool   mbInFrame;       // A code byte has been seen since the last delimiter, so even an empty frame is reported.
+	};
+
+
+	/// slip_encoder
+	///
+	/// Writes one SLIP frame per begin()/end() pair. With bLeadingEnd, the
+	/// frame also starts with END, which flushes any line noise the receiver
+	/// has collected, as RFC 1055 suggests.
+	///
+	template <typename Crc = crc16_ccitt>
+	class slip_encoder : protected Internal::FrameEncoderBase<Crc>
+	{
+		typedef Internal::FrameEncoderBase<Crc> base_type;
+		friend class Internal::FrameEncoderBase<Crc>;
+
+	public:
+		static const uint8_t kEnd    = 0xC0;
+		static const uint8_t kEsc    = 0xDB;
+		static const uint8_t kEscEnd = 0xDC;
+		static const uint8_t kEscEsc = 0xDD;
+
+		static EA_CONSTEXPR size_t max_frame_size(size_t n)
+			{ return 2 * (n + Crc::kSize) + 2; }
+
+		static size_t encode(const void* pPayload, size_t n, void* pOut, size_t capacity, bool bLeadingEnd = false)
+		{
+			slip_encoder encoder;
+
+			encoder.begin(pOut, capacity, bLeadingEnd);
+			encoder.write(pPayload, n);
+			return encoder.end();
+		}
+
+		void begin(void* pOut, size_t capacity, bool bLeadingEnd = false)
+		{
+			base_type::Reset(pOut, capacity);
+			if(bLeadingEnd)
+				base_type::Out(kEnd);
+		}
+
+		void write(const void* p, size_t n)
+		{
+			this->mCrc.update(static_cast<const uint8_t*>(p), n);
+			WritePayload(static_cast<const uint8_t*>(p), n);
+		}
+
+		size_t end()
+		{
+			base_type::WriteCrc(*this);
+			base_type::Out(kEnd);
+			return this->mbOverflow ? 0 : this->mnSize;
+		}
+
+	protected:
+		void WritePayload(const uint8_t* p, size_t n)
+		{
+			for(const uint8_t* pEnd = p + n; p != pEnd; ++p)
+			{
+				if(*p == kEnd)
+				{
+					base_type::Out(kEsc);
+					base_type::Out(kEscEnd);
+				}
+				else if(*p == kEsc)
+				{
+					base_type::Out(kEsc);
+					base_type::Out(kEscEsc);
+				}
+				else
+					base_type::Out(*p);
+			}
+		}
+	};
+
+
+	/// slip_decoder
+	///
+	/// Decodes SLIP frames into a caller supplied buffer as their bytes
+	/// arrive. An ESC followed by anything but ESC_END or ESC_ESC makes the
+	/// frame malformed. SLIP cannot tell an empty frame from two END bytes in
+	/// a row, so with no_crc empty payloads are never reported.
+	///
+	template <typename Crc = crc16_ccitt>
+	class slip_decoder : public Internal::FrameDecoderBase<Crc>
+	{
+		typedef Internal::FrameDecoderBase<Crc> base_type;
+
+	public:
+		slip_decoder(void* pFrameBuffer, size_t capacity)
+			: base_type(pFrameBuffer, capacity), mbEscape(false) {}
+
+		size_t consume(const void* pInput, size_t n)
+		{
+			const uint8_t* const pBegin = static_cast<const uint8_t*>(pInput);
+			const uint8_t*       p      = pBegin;
+			const uint8_t* const pEnd   = p + n;
+
+			base_type::BeginIfDone();
+
+			while(p != pEnd)
+			{
+				// Copy the run of plain bytes up to the next END or ESC.
+				const uint8_t* pRun = p;
+
+				if(!mbEscape)
+				{
+					while(pRun != pEnd && *pRun != slip_encoder<Crc>::kEnd && *pRun != slip_encoder<Crc>::kEsc)
+						++pRun;
+					base_type::Put(p, size_t(pRun - p));
+					if((p = pRun) == pEnd)
+						break;
+				}
+
+				const uint8_t byte = *p++;
+
+				if(byte == slip_encoder<Crc>::kEnd)
+				{
+					const bool bTruncated = mbEscape;
+
+					mbEscape = false;
+					if(base_type::Finish(bTruncated, !bTruncated && this->mnSize == 0 && this->mError == frame_incomplete))
+						break;
+				}
+				else if(mbEscape)
+				{
+					mbEscape = false;
+					if(byte == slip_encoder<Crc>::kEscEnd)
+						base_type::Put(slip_encoder<Crc>::kEnd);
+					else if(byte == slip_encoder<Crc>::kEscEsc)
+						base_type::Put(slip_encoder<Crc>::kEsc);
+					else if(this->mError == frame_incomplete)
+						this->mError = frame_malformed;
+				}
+				else
+					mbEscape = true;
+			}
+
+			return size_t(p - pBegin);
+		}
+
+		template <typename RingBuffer>
+		frame_status consume(RingBuffer& ringBuffer)
+			{ return base_type::ConsumeRing(*this, ringBuffer); }
+
+	protected:
+		bool mbEscape;  // The last byte was ESC.
+	};
+
+} // namespace std
+
+
+#endif // Header include guard
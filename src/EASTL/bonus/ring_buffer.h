@@ -21,6 +21,7 @@
 #include <EASTL/internal/config.h>
 #include <EASTL/iterator.h>
 #include <EASTL/vector.h>
+#include <EASTL/span.h>
 #include <EASTL/initializer_list.h>
 #include <stddef.h>
 
@@ -293,9 +294,16 @@ namespace std
 		reference       operator[](size_type n);
 		const_reference operator[](size_type n) const;
 
-		// To consider:
-		// size_type read(value_type* pDestination, size_type nCount);
-		// size_type read(iterator** pPosition1, iterator** pPosition2, size_type& nCount1, size_type& nCount2);
+		void            pop_front(size_type n);             // Removes the n oldest elements; n must be <= size().
+		void            push_back(const value_type* p, size_type n); // Appends n elements; n must be <= capacity() - size().
+
+		// The contents as at most two contiguous runs, oldest first. array_two is empty
+		// unless the contents wrap around the end of the container. These require a
+		// Container that stores its elements contiguously, such as vector or fixed_vector.
+		span<value_type>       array_one();
+		span<const value_type> array_one() const;
+		span<value_type>       array_two();
+		span<const value_type> array_two() const;
 
 		/* To do:
 			template <class... Args>
@@ -967,13 +975,13 @@ namespace std
 		template <typename Container, bool UseOverflowAllocator = has_overflow_allocator<Container>()()>
 		struct GetFixedContainerCtorAllocator
 		{
-			auto& operator()(Container& c) { return c.get_overflow_allocator(); }
+			auto operator()(Container& c) -> decltype(c.get_overflow_allocator())& { return c.get_overflow_allocator(); }
 		};
 
 		template <typename Container>
 		struct GetFixedContainerCtorAllocator<Container, false>
 		{
-			auto& operator()(Container& c) { return c.get_allocator(); }
+			auto operator()(Container& c) -> decltype(c.get_allocator())& { return c.get_allocator(); }
 		};
 	} // namespace Internal
 
@@ -1285,6 +1293,82 @@ namespace std
 	}
 
 
+	template <typename T, typename Container, typename Allocator>
+	void ring_buffer<T, Container, Allocator>::push_back(const value_type* p, size_type n)
+	{
+		EASTL_ASSERT(n <= (capacity() - mSize));
+
+		const size_type nTail = (size_type)std::distance(mEnd, c.end());
+
+		if(n < nTail)
+			mEnd = std::copy(p, p + n, mEnd);
+		else
+		{
+			std::copy(p, p + nTail, mEnd);
+			mEnd = std::copy(p + nTail, p + n, c.begin());
+		}
+		mSize += n;
+	}
+
+
+	template <typename T, typename Container, typename Allocator>
+	void ring_buffer<T, Container, Allocator>::pop_front(size_type n)
+	{
+		EASTL_ASSERT(n <= mSize);
+
+		const size_type nTail = (size_type)std::distance(mBegin, c.end());
+
+		if(n < nTail)
+			std::advance(mBegin, n);
+		else
+		{
+			mBegin = c.begin();
+			std::advance(mBegin, n - nTail);
+		}
+		mSize -= n;
+	}
+
+
+	template <typename T, typename Container, typename Allocator>
+	span<typename ring_buffer<T, Container, Allocator>::value_type>
+	ring_buffer<T, Container, Allocator>::array_one()
+	{
+		const size_type nTail = (size_type)(c.end() - mBegin);
+
+		return span<value_type>(&*mBegin, (mSize < nTail) ? mSize : nTail);
+	}
+
+
+	template <typename T, typename Container, typename Allocator>
+	span<const typename ring_buffer<T, Container, Allocator>::value_type>
+	ring_buffer<T, Container, Allocator>::array_one() const
+	{
+		const size_type nTail = (size_type)(c.end() - container_const_iterator(mBegin));
+
+		return span<const value_type>(&*mBegin, (mSize < nTail) ? mSize : nTail);
+	}
+
+
+	template <typename T, typename Container, typename Allocator>
+	span<typename ring_buffer<T, Container, Allocator>::value_type>
+	ring_buffer<T, Container, Allocator>::array_two()
+	{
+		const size_type nTail = (size_type)(c.end() - mBegin);
+
+		return span<value_type>(&*c.begin(), (mSize > nTail) ? (mSize - nTail) : 0);
+	}
+
+
+	template <typename T, typename Container, typename Allocator>
+	span<const typename ring_buffer<T, Container, Allocator>::value_type>
+	ring_buffer<T, Container, Allocator>::array_two() const
+	{
+		const size_type nTail = (size_type)(c.end() - container_const_iterator(mBegin));
+
+		return span<const value_type>(&*c.begin(), (mSize > nTail) ? (mSize - nTail) : 0);
+	}
+
+
 	template <typename T, typename Container, typename Allocator>
 	typename ring_buffer<T, Container, Allocator>::reference
 	ring_buffer<T, Container, Allocator>::operator[](size_type n)
@@ -8,6 +8,7 @@
 //    selection_sort        -- Unstable.
 //    shaker_sort           -- Stable.
 //    bucket_sort           -- Stable.
+//    static_sort           -- Unstable.    Sorting network for a fixed number of elements.
 //
 //////////////////////////////////////////////////////////////////////////////
 
@@ -23,6 +24,7 @@
 #include <EASTL/heap.h>
 #include <EASTL/sort.h>             // For backwards compatibility due to sorts moved from here to sort.h.
 #include <EASTL/allocator.h>
+#include <EASTL/array.h>
 
 #if defined(EA_PRAGMA_ONCE_SUPPORTED)
 	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
@@ -178,6 +180,178 @@ namespace std
 
 
 
+	/// static_sort
+	///
+	/// Sorts exactly N elements with a sorting network that is expanded at
+	/// compile time into straight-line compare-exchanges, with no loops and no
+	/// data-dependent control flow. Meant for small arrays sorted over and over,
+	/// such as the window of a median filter. Unstable.
+	///
+	/// The network is Bose-Nelson's, which uses the fewest comparators known
+	/// for N <= 8 (3, 5, 9, 12, 16 and 19 for N = 3..8) and a few more above
+	/// that (27 for 9, 65 for 16 against the best known 25 and 60). Code
+	/// size grows as about N log^2 N compare-exchanges, so keep N small.
+	///
+	/// For arithmetic and pointer types each compare-exchange is written as a
+	/// pair of selects, which compilers turn into min/max or conditional moves
+	/// instead of branches.
+	///
+	/// Example usage:
+	///     int samples[5];
+	///     static_sort(samples);                 // N deduced from the array
+	///     static_sort<3>(samples + 1);          // Any random access iterator
+	///
+	///     std::array<float, 8> distances;
+	///     static_sort(distances, std::greater<float>());
+	///
+	namespace Internal
+	{
+		template <typename T, typename Compare, bool bSelect = std::is_arithmetic<T>::value || std::is_pointer<T>::value>
+		struct static_sort_exchange
+		{
+			static void apply(T& a, T& b, Compare& compare)
+			{
+				if(compare(b, a))
+					std::swap(a, b);
+			}
+		};
+
+		template <typename T, typename Compare>
+		struct static_sort_exchange<T, Compare, true>
+		{
+			static void apply(T& a, T& b, Compare& compare)
+			{
+				const T x = a, y = b;
+				const bool bSwap = compare(y, x);
+
+				a = bSwap ? y : x;
+				b = bSwap ? x : y;
+			}
+		};
+
+		// Merges the sorted ranges [I, I + X) and [J, J + Y).
+		template <size_t I, size_t X, size_t J, size_t Y,
+		          int Case = ((X == 0) || (Y == 0)) ? 0 : ((X == 1) && (Y == 1)) ? 1 : ((X == 1) && (Y == 2)) ? 2 : ((X == 2) && (Y == 1)) ? 3 : 4>
+		struct static_sort_merge
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator first, Compare& compare)
+			{
+				typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+				static_sort_exchange<value_type, Compare>::apply(first[I], first[J], compare);
+			}
+		};
+
+		template <size_t I, size_t X, size_t J, size_t Y>
+		struct static_sort_merge<I, X, J, Y, 0>
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator, Compare&) {}
+		};
+
+		template <size_t I, size_t X, size_t J, size_t Y>
+		struct static_sort_merge<I, X, J, Y, 2>
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator first, Compare& compare)
+			{
+				typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+				static_sort_exchange<value_type, Compare>::apply(first[I], first[J + 1], compare);
+				static_sort_exchange<value_type, Compare>::apply(first[I], first[J], compare);
+			}
+		};
+
+		template <size_t I, size_t X, size_t J, size_t Y>
+		struct static_sort_merge<I, X, J, Y, 3>
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator first, Compare& compare)
+			{
+				typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+				static_sort_exchange<value_type, Compare>::apply(first[I], first[J], compare);
+				static_sort_exchange<value_type, Compare>::apply(first[I + 1], first[J], compare);
+			}
+		};
+
+		template <size_t I, size_t X, size_t J, size_t Y>
+		struct static_sort_merge<I, X, J, Y, 4>
+		{
+			static const size_t A = X / 2;
+			static const size_t B = (X & 1) ? (Y / 2) : ((Y + 1) / 2);
+
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator first, Compare& compare)
+			{
+				static_sort_merge<I, A, J, B>::apply(first, compare);
+				static_sort_merge<I + A, X - A, J + B, Y - B>::apply(first, compare);
+				static_sort_merge<I + A, X - A, J, B>::apply(first, compare);
+			}
+		};
+
+		// Sorts [I, I + M) by sorting both halves and merging them.
+		template <size_t I, size_t M, bool bSplit = (M > 1)>
+		struct static_sort_network
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator first, Compare& compare)
+			{
+				static_sort_network<I, M / 2>::apply(first, compare);
+				static_sort_network<I + M / 2, M - M / 2>::apply(first, compare);
+				static_sort_merge<I, M / 2, I + M / 2, M - M / 2>::apply(first, compare);
+			}
+		};
+
+		template <size_t I, size_t M>
+		struct static_sort_network<I, M, false>
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void apply(RandomAccessIterator, Compare&) {}
+		};
+	}
+
+	template <size_t N, typename RandomAccessIterator, typename Compare>
+	inline void static_sort(RandomAccessIterator first, Compare compare)
+	{
+		std::Internal::static_sort_network<0, N>::apply(first, compare);
+	}
+
+	template <size_t N, typename RandomAccessIterator>
+	inline void static_sort(RandomAccessIterator first)
+	{
+		typedef std::less<typename std::iterator_traits<RandomAccessIterator>::value_type> Less;
+
+		std::static_sort<N, RandomAccessIterator, Less>(first, Less());
+	}
+
+	template <size_t N, typename T, typename Compare>
+	inline void static_sort(T (&array)[N], Compare compare)
+	{
+		std::static_sort<N, T*, Compare>(array, compare);
+	}
+
+	template <size_t N, typename T>
+	inline void static_sort(T (&array)[N])
+	{
+		std::static_sort<N, T*, std::less<T> >(array, std::less<T>());
+	}
+
+	template <size_t N, typename T, typename Compare>
+	inline void static_sort(std::array<T, N>& array, Compare compare)
+	{
+		std::static_sort<N, T*, Compare>(array.data(), compare);
+	}
+
+	template <size_t N, typename T>
+	inline void static_sort(std::array<T, N>& array)
+	{
+		std::static_sort<N, T*, std::less<T> >(array.data(), std::less<T>());
+	}
+
+
+
 } // namespace std
 
 
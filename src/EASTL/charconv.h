@@ -0,0 +1,2048 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the C++17 <charconv> primitives to_chars and
+// from_chars: locale independent, non-allocating, non-throwing conversions
+// between numbers and character ranges. Nothing here goes through printf or
+// scanf, which on AVR cost several KB of flash and thousands of cycles per
+// number.
+//
+// Integers are written two digits at a time from a digit-pair table. Values
+// that fit in 16 bits are divided in 16 bit arithmetic and 64 bit values are
+// split into 10^8 sized pieces, because wide division dominates on 8 bit
+// targets.
+//
+// Floating point values are written in the shortest form that reads back to
+// the same value. float uses the Ryu algorithm (Ulf Adams, "Ryu: Fast
+// Float-to-String Conversion", PLDI 2018), which only needs 32x64 bit
+// multiplies and two small power-of-five tables. Where double is 32 bits
+// (AVR) double uses the same path. Where double is 64 bits the shortest
+// precision is found by rounding the exact digits (see below) to each
+// precision in turn until one reads back, which is correct but not fast;
+// long double is converted through double.
+//
+// Reading floating point values takes an exact fast path when the decimal
+// mantissa and the power of ten are both exactly representable (Clinger,
+// "How to Read Floating Point Numbers Accurately", PLDI 1990). Other inputs
+// are normalized into a short buffer and handed to strtod.
+//
+// The to_chars overloads that take a precision generate the exact decimal
+// expansion of the binary value with a small bignum, so they round exactly as
+// printf does without needing a printf with floating point support, which
+// avr-libc does not link by default.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_CHARCONV_H
+#define EASTL_CHARCONV_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_CHARCONV_PROGMEM
+//
+// The lookup tables used by this file are read-only and are placed in flash
+// on AVR, where a const table would otherwise be copied into the 2 KB of RAM
+// at startup.
+//
+#if defined(ARDUINO) && defined(__AVR__)
+	#include <avr/pgmspace.h>
+	#define EASTL_CHARCONV_PROGMEM          PROGMEM
+	#define EASTL_CHARCONV_READ_BYTE(p)     ((char)pgm_read_byte(p))
+	#define EASTL_CHARCONV_READ_DWORD(p)    ((uint32_t)pgm_read_dword(p))
+#else
+	#define EASTL_CHARCONV_PROGMEM
+	#define EASTL_CHARCONV_READ_BYTE(p)     (*(p))
+	#define EASTL_CHARCONV_READ_DWORD(p)    (*(p))
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_CHARCONV_DOUBLE_IS_FLOAT
+//
+// Defined as 1 when double has the same representation as float, as is the
+// case with avr-gcc. double conversions then share the float code path.
+//
+#ifndef EASTL_CHARCONV_DOUBLE_IS_FLOAT
+	#if defined(__SIZEOF_DOUBLE__) && defined(__SIZEOF_FLOAT__) && (__SIZEOF_DOUBLE__ == __SIZEOF_FLOAT__)
+		#define EASTL_CHARCONV_DOUBLE_IS_FLOAT 1
+	#else
+		#define EASTL_CHARCONV_DOUBLE_IS_FLOAT 0
+	#endif
+#endif
+
+
+
+namespace std
+{
+	/// chars_format
+	///
+	/// http://en.cppreference.com/w/cpp/utility/chars_format
+	///
+	enum class chars_format
+	{
+		scientific = 0x1,
+		fixed      = 0x2,
+		hex        = 0x4,
+		general    = fixed | scientific
+	};
+
+	inline EA_CONSTEXPR chars_format operator|(chars_format a, chars_format b) { return chars_format((int)a | (int)b); }
+	inline EA_CONSTEXPR chars_format operator&(chars_format a, chars_format b) { return chars_format((int)a & (int)b); }
+	inline EA_CONSTEXPR chars_format operator^(chars_format a, chars_format b) { return chars_format((int)a ^ (int)b); }
+	inline EA_CONSTEXPR chars_format operator~(chars_format a)                 { return chars_format(~(int)a & 0x7); }
+
+
+	/// errc
+	///
+	/// The subset of std::errc that the conversion functions report. The values
+	/// are the POSIX errno codes of the same name.
+	///
+	/// http://en.cppreference.com/w/cpp/error/errc
+	///
+	enum class errc
+	{
+		invalid_argument    = 22, // EINVAL
+		result_out_of_range = 34, // ERANGE
+		value_too_large     = 75  // EOVERFLOW
+	};
+
+
+	/// to_chars_result
+	///
+	/// http://en.cppreference.com/w/cpp/utility/to_chars
+	///
+	struct to_chars_result
+	{
+		char* ptr;
+		errc  ec;
+	};
+
+
+	/// from_chars_result
+	///
+	/// http://en.cppreference.com/w/cpp/utility/from_chars
+	///
+	struct from_chars_result
+	{
+		const char* ptr;
+		errc        ec;
+	};
+
+
+
+	namespace Internal
+	{
+		const char gCharconvDigitPairs[200] EASTL_CHARCONV_PROGMEM =
+		{
+			'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+			'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+			'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+			'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+			'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+			'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+			'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+			'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+			'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+			'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+		};
+
+
+		/// CharconvUnsigned
+		///
+		/// The unsigned type that conversions of a type of the given size are carried
+		/// out in. Everything up to 32 bits shares one instantiation.
+		///
+		template <size_t N> struct CharconvUnsigned    { typedef uint32_t type; };
+		template <>         struct CharconvUnsigned<8> { typedef uint64_t type; };
+
+
+		/// CountDecimalDigits
+		///
+		/// Returns the number of decimal digits in value; zero has one digit.
+		///
+		inline int CountDecimalDigits(uint32_t value)
+		{
+			for(int n = 1; ; n += 4)
+			{
+				if(value < 10u)    return n;
+				if(value < 100u)   return n + 1;
+				if(value < 1000u)  return n + 2;
+				if(value < 10000u) return n + 3;
+				value /= 10000u;
+			}
+		}
+
+		inline int CountDecimalDigits(uint64_t value)
+		{
+			int n = 0;
+			for(; value > 0xffffffffu; n += 4)
+				value /= 10000u;
+			return n + CountDecimalDigits((uint32_t)value);
+		}
+
+
+		template <typename T>
+		inline void CopyDigitPair(T* pDest, unsigned n)
+		{
+			const char* const pPair = gCharconvDigitPairs + (n * 2);
+			pDest[0] = (T)EASTL_CHARCONV_READ_BYTE(pPair);
+			pDest[1] = (T)EASTL_CHARCONV_READ_BYTE(pPair + 1);
+		}
+
+
+		/// WriteDecimalBackward
+		///
+		/// Writes the decimal digits of value so that the last digit lands just
+		/// before pEnd, and returns a pointer to the first digit. The caller must
+		/// provide CountDecimalDigits(value) characters of space.
+		///
+		template <typename T>
+		inline T* WriteDecimalBackward(T* pEnd, uint32_t value)
+		{
+			while(value > 0xffffu)
+			{
+				const uint32_t q = value / 100u;
+				CopyDigitPair(pEnd -= 2, (unsigned)(value - (q * 100u)));
+				value = q;
+			}
+
+			uint16_t v = (uint16_t)value; // 16 bit division is several times cheaper than 32 bit division on AVR.
+
+			while(v >= 100u)
+			{
+				const uint16_t q = (uint16_t)(v / 100u);
+				CopyDigitPair(pEnd -= 2, (unsigned)(v - (q * 100u)));
+				v = q;
+			}
+
+			if(v >= 10u)
+				CopyDigitPair(pEnd -= 2, v);
+			else
+				*--pEnd = (T)('0' + v);
+
+			return pEnd;
+		}
+
+		template <typename T>
+		inline T* WriteDecimalBackward(T* pEnd, uint64_t value)
+		{
+			while(value > 0xffffffffu)
+			{
+				// Peel off eight digits with a single 64 bit division.
+				const uint64_t q = value / 100000000u;
+				uint32_t r = (uint32_t)(value - (q * 100000000u));
+
+				for(int i = 0; i < 4; ++i)
+				{
+					const uint32_t rq = r / 100u;
+					CopyDigitPair(pEnd -= 2, (unsigned)(r - (rq * 100u)));
+					r = rq;
+				}
+
+				value = q;
+			}
+
+			return WriteDecimalBackward(pEnd, (uint32_t)value);
+		}
+
+
+		/// WriteBaseBackward
+		///
+		/// Like WriteDecimalBackward for any base in [2, 36]. Digits above 9 are
+		/// written in lower case.
+		///
+		template <typename T, typename Unsigned>
+		inline T* WriteBaseBackward(T* pEnd, Unsigned value, unsigned base)
+		{
+			if((base & (base - 1)) == 0)
+			{
+				unsigned shift = 1;
+				while((1u << shift) < base)
+					++shift;
+
+				do {
+					const unsigned d = (unsigned)value & (base - 1);
+					*--pEnd = (T)((d < 10) ? ('0' + d) : ('a' + d - 10));
+					value >>= shift;
+				} while(value);
+			}
+			else
+			{
+				do {
+					const Unsigned q = (Unsigned)(value / base);
+					const unsigned d = (unsigned)(value - (q * base));
+					*--pEnd = (T)((d < 10) ? ('0' + d) : ('a' + d - 10));
+					value = q;
+				} while(value);
+			}
+
+			return pEnd;
+		}
+
+
+		inline to_chars_result CharconvTooLarge(char* last)
+		{
+			to_chars_result result = { last, errc::value_too_large };
+			return result;
+		}
+
+
+		template <typename Unsigned>
+		inline to_chars_result ToCharsUnsigned(char* first, char* last, Unsigned value, int base)
+		{
+			EASTL_ASSERT((base >= 2) && (base <= 36));
+
+			to_chars_result result;
+
+			if(base == 10)
+			{
+				const int n = CountDecimalDigits(value);
+
+				if((last - first) < n)
+				{
+					result.ptr = last;
+					result.ec  = errc::value_too_large;
+				}
+				else
+				{
+					WriteDecimalBackward(first + n, value);
+					result.ptr = first + n;
+					result.ec  = errc();
+				}
+			}
+			else
+			{
+				char        buffer[sizeof(Unsigned) * 8];
+				char* const pEnd = buffer + sizeof(buffer);
+				char* const p    = WriteBaseBackward(pEnd, value, (unsigned)base);
+
+				if((last - first) < (pEnd - p))
+				{
+					result.ptr = last;
+					result.ec  = errc::value_too_large;
+				}
+				else
+				{
+					memcpy(first, p, (size_t)(pEnd - p));
+					result.ptr = first + (pEnd - p);
+					result.ec  = errc();
+				}
+			}
+
+			return result;
+		}
+
+
+		/// CharconvDigitValue
+		///
+		/// Returns the value of c as a digit in base 36, or a value >= 36 if c is not a digit.
+		///
+		inline unsigned CharconvDigitValue(char c)
+		{
+			if((unsigned)(c - '0') < 10u)
+				return (unsigned)(c - '0');
+
+			const unsigned lower = (unsigned)((c | 0x20) - 'a');
+			return (lower < 26u) ? (lower + 10u) : 0xffu;
+		}
+
+
+		/// ParseUnsigned
+		///
+		/// Consumes digits of the given base starting at p and accumulates them into
+		/// result. Sets bOverflow if the value exceeds maxValue; digits are still
+		/// consumed so that the returned pointer is past the whole number.
+		///
+		template <typename Unsigned>
+		EA_FORCE_INLINE const char* ParseUnsigned(const char* p, const char* last, Unsigned& result, Unsigned maxValue, unsigned base, bool& bOverflow)
+		{
+			const Unsigned limit      = (Unsigned)(maxValue / base);
+			const unsigned limitDigit = (unsigned)(maxValue - (limit * base));
+			Unsigned       value      = 0;
+
+			bOverflow = false;
+
+			for(; p != last; ++p)
+			{
+				const unsigned d = CharconvDigitValue(*p);
+
+				if(d >= base)
+					break;
+
+				if((value < limit) || ((value == limit) && (d <= limitDigit)))
+					value = (Unsigned)((value * base) + d);
+				else
+					bOverflow = true;
+			}
+
+			result = value;
+			return p;
+		}
+
+
+		template <typename Integer, typename UInteger>
+		inline to_chars_result ToCharsSigned(char* first, char* last, Integer value, int base)
+		{
+			typedef typename CharconvUnsigned<sizeof(Integer)>::type unsigned_type;
+
+			if(value < 0)
+			{
+				if(first == last)
+					return CharconvTooLarge(last);
+
+				*first++ = '-';
+				return ToCharsUnsigned(first, last, (unsigned_type)(UInteger)(UInteger(0) - (UInteger)value), base);
+			}
+
+			return ToCharsUnsigned(first, last, (unsigned_type)(UInteger)value, base);
+		}
+
+
+		template <typename Integer, typename UInteger>
+		inline from_chars_result FromCharsInteger(const char* first, const char* last, Integer& value, int base, bool bSigned)
+		{
+			typedef typename CharconvUnsigned<sizeof(Integer)>::type unsigned_type;
+
+			EASTL_ASSERT((base >= 2) && (base <= 36));
+
+			const char* p         = first;
+			bool        bNegative = false;
+
+			if(bSigned && (p != last) && (*p == '-'))
+			{
+				bNegative = true;
+				++p;
+			}
+
+			const UInteger      maxUnsigned = (UInteger)~UInteger(0);
+			const unsigned_type maxValue    = bSigned ? ((unsigned_type)(UInteger)(maxUnsigned >> 1) + (bNegative ? 1u : 0u)) : (unsigned_type)maxUnsigned;
+			unsigned_type       magnitude;
+			bool                bOverflow;
+			const char*         pEnd;
+
+			if(base == 10) // Lets the compiler turn the multiply and divide by the base into shifts and adds.
+				pEnd = ParseUnsigned(p, last, magnitude, maxValue, 10u, bOverflow);
+			else
+				pEnd = ParseUnsigned(p, last, magnitude, maxValue, (unsigned)base, bOverflow);
+
+			from_chars_result result = { pEnd, errc() };
+
+			if(pEnd == p)
+			{
+				result.ptr = first;
+				result.ec  = errc::invalid_argument;
+			}
+			else if(bOverflow)
+				result.ec = errc::result_out_of_range;
+			else if(bNegative)
+				value = (Integer)(UInteger)(UInteger(0) - (UInteger)magnitude);
+			else
+				value = (Integer)magnitude;
+
+			return result;
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Shortest round trip float formatting (Ryu)
+		///////////////////////////////////////////////////////////////////////
+
+		const int32_t kFloatPow5InvBitCount = 59;
+		const int32_t kFloatPow5BitCount    = 61;
+
+		// gFloatPow5InvSplit[i] = ceil(2^(RyuPow5Bits(i) - 1 + 59) / 5^i), as { high, low } 32 bit halves.
+		// gFloatPow5Split[i]    = floor(5^i / 2^(RyuPow5Bits(i) - 61)), as { high, low } 32 bit halves.
+		const uint32_t gFloatPow5InvSplit[31][2] EASTL_CHARCONV_PROGMEM =
+		{
+			{ 0x08000000u, 0x00000001u }, { 0x06666666u, 0x66666667u }, { 0x051eb851u, 0xeb851eb9u },
+			{ 0x04189374u, 0xbc6a7efau }, { 0x068db8bau, 0xc710cb2au }, { 0x053e2d62u, 0x38da3c22u },
+			{ 0x0431bde8u, 0x2d7b634eu }, { 0x06b5fca6u, 0xaf2bd216u }, { 0x055e63b8u, 0x8c230e78u },
+			{ 0x044b82fau, 0x09b5a52du }, { 0x06df37f6u, 0x75ef6eaeu }, { 0x057f5ff8u, 0x5e592558u },
+			{ 0x0465e660u, 0x4b7a8447u }, { 0x0709709au, 0x125da071u }, { 0x05a126e1u, 0xa84ae6c1u },
+			{ 0x0480ebe7u, 0xb9d58567u }, { 0x0734aca5u, 0xf6226f0bu }, { 0x05c3bd51u, 0x91b525a3u },
+			{ 0x049c9774u, 0x7490eae9u }, { 0x0760f253u, 0xedb4ab0eu }, { 0x05e72843u, 0x249088d8u },
+			{ 0x04b8ed02u, 0x83a6d3e0u }, { 0x078e4804u, 0x05d7b966u }, { 0x060b6cd0u, 0x04ac9452u },
+			{ 0x04d5f0a6u, 0x6a23a9dbu }, { 0x07bcb43du, 0x769f762bu }, { 0x06309031u, 0x2bb2c4efu },
+			{ 0x04f3a68du, 0xbc8f03f3u }, { 0x07ec3dafu, 0x94180651u }, { 0x065697bfu, 0xa9acd1dau },
+			{ 0x051212ffu, 0xbaf0a7e2u }
+		};
+
+		const uint32_t gFloatPow5Split[47][2] EASTL_CHARCONV_PROGMEM =
+		{
+			{ 0x10000000u, 0x00000000u }, { 0x14000000u, 0x00000000u }, { 0x19000000u, 0x00000000u },
+			{ 0x1f400000u, 0x00000000u }, { 0x13880000u, 0x00000000u }, { 0x186a0000u, 0x00000000u },
+			{ 0x1e848000u, 0x00000000u }, { 0x1312d000u, 0x00000000u }, { 0x17d78400u, 0x00000000u },
+			{ 0x1dcd6500u, 0x00000000u }, { 0x12a05f20u, 0x00000000u }, { 0x174876e8u, 0x00000000u },
+			{ 0x1d1a94a2u, 0x00000000u }, { 0x12309ce5u, 0x40000000u }, { 0x16bcc41eu, 0x90000000u },
+			{ 0x1c6bf526u, 0x34000000u }, { 0x11c37937u, 0xe0800000u }, { 0x16345785u, 0xd8a00000u },
+			{ 0x1bc16d67u, 0x4ec80000u }, { 0x1158e460u, 0x913d0000u }, { 0x15af1d78u, 0xb58c4000u },
+			{ 0x1b1ae4d6u, 0xe2ef5000u }, { 0x10f0cf06u, 0x4dd59200u }, { 0x152d02c7u, 0xe14af680u },
+			{ 0x1a784379u, 0xd99db420u }, { 0x108b2a2cu, 0x28029094u }, { 0x14adf4b7u, 0x320334b9u },
+			{ 0x19d971e4u, 0xfe8401e7u }, { 0x1027e72fu, 0x1f128130u }, { 0x1431e0fau, 0xe6d7217cu },
+			{ 0x193e5939u, 0xa08ce9dbu }, { 0x1f8def88u, 0x08b02452u }, { 0x13b8b5b5u, 0x056e16b3u },
+			{ 0x18a6e322u, 0x46c99c60u }, { 0x1ed09beau, 0xd87c0378u }, { 0x13426172u, 0xc74d822bu },
+			{ 0x1812f9cfu, 0x7920e2b6u }, { 0x1e17b843u, 0x57691b64u }, { 0x12ced32au, 0x16a1b11eu },
+			{ 0x178287f4u, 0x9c4a1d66u }, { 0x1d6329f1u, 0xc35ca4bfu }, { 0x125dfa37u, 0x1a19e6f7u },
+			{ 0x16f578c4u, 0xe0a060b5u }, { 0x1cb2d6f6u, 0x18c878e3u }, { 0x11efc659u, 0xcf7d4b8du },
+			{ 0x166bb7f0u, 0x435c9e71u }, { 0x1c06a5ecu, 0x5433c60du }
+		};
+
+		inline uint32_t RyuPow5Factor(uint32_t value)
+		{
+			uint32_t count = 0;
+			for(;;)
+			{
+				const uint32_t q = value / 5u;
+				if((value - (q * 5u)) != 0)
+					return count;
+				value = q;
+				++count;
+			}
+		}
+
+		inline bool RyuMultipleOfPowerOf5(uint32_t value, uint32_t p) { return RyuPow5Factor(value) >= p; }
+		inline bool RyuMultipleOfPowerOf2(uint32_t value, uint32_t p) { return (value & ((1u << p) - 1)) == 0; }
+
+		inline uint32_t RyuLog10Pow2(int32_t e) { return ((uint32_t)e * 78913u) >> 18; }   // floor(e * log10(2)) for 0 <= e <= 1650
+		inline uint32_t RyuLog10Pow5(int32_t e) { return ((uint32_t)e * 732923u) >> 20; }  // floor(e * log10(5)) for 0 <= e <= 2620
+		inline int32_t  RyuPow5Bits(int32_t e)  { return (int32_t)((((uint32_t)e * 1217359u) >> 19) + 1); } // ceil(log2(5^e)) for e > 0
+
+		inline uint32_t RyuMulShift(uint32_t m, const uint32_t* pFactor, int32_t shift)
+		{
+			const uint32_t factorHi = EASTL_CHARCONV_READ_DWORD(pFactor);
+			const uint32_t factorLo = EASTL_CHARCONV_READ_DWORD(pFactor + 1);
+			const uint64_t bits0    = (uint64_t)m * factorLo;
+			const uint64_t bits1    = (uint64_t)m * factorHi;
+			const uint64_t sum      = (bits0 >> 32) + bits1;
+
+			return (uint32_t)(sum >> (shift - 32));
+		}
+
+		inline uint32_t RyuMulPow5InvDivPow2(uint32_t m, uint32_t q, int32_t j) { return RyuMulShift(m, gFloatPow5InvSplit[q], j); }
+		inline uint32_t RyuMulPow5DivPow2(uint32_t m, uint32_t i, int32_t j)    { return RyuMulShift(m, gFloatPow5Split[i], j); }
+
+
+		/// FloatToDecimal
+		///
+		/// Converts the finite, non-zero float with the given IEEE fields into the
+		/// shortest decimal mantissa * 10^exponent that rounds back to it.
+		///
+		inline uint32_t FloatToDecimal(uint32_t ieeeMantissa, uint32_t ieeeExponent, int& exponent)
+		{
+			int32_t  e2;
+			uint32_t m2;
+
+			if(ieeeExponent == 0)
+			{
+				e2 = 1 - 127 - 23 - 2;
+				m2 = ieeeMantissa;
+			}
+			else
+			{
+				e2 = (int32_t)ieeeExponent - 127 - 23 - 2;
+				m2 = (1u << 23) | ieeeMantissa;
+			}
+
+			const bool acceptBounds = (m2 & 1) == 0;
+
+			// Step 2: Determine the interval of valid decimal representations.
+			const uint32_t mv      = 4 * m2;
+			const uint32_t mmShift = ((ieeeMantissa != 0) || (ieeeExponent <= 1)) ? 1u : 0u;
+
+			// Step 3: Convert to a decimal power base using 64 bit arithmetic.
+			uint32_t vr, vp, vm;
+			int32_t  e10;
+			bool     vmIsTrailingZeros = false;
+			bool     vrIsTrailingZeros = false;
+			uint8_t  lastRemovedDigit  = 0;
+
+			if(e2 >= 0)
+			{
+				const uint32_t q = RyuLog10Pow2(e2);
+				const int32_t  k = kFloatPow5InvBitCount + RyuPow5Bits((int32_t)q) - 1;
+				const int32_t  i = -e2 + (int32_t)q + k;
+
+				e10 = (int32_t)q;
+				vr  = RyuMulPow5InvDivPow2(mv, q, i);
+				vp  = RyuMulPow5InvDivPow2(mv + 2, q, i);
+				vm  = RyuMulPow5InvDivPow2(mv - 1 - mmShift, q, i);
+
+				if((q != 0) && (((vp - 1) / 10) <= (vm / 10)))
+				{
+					// We need to know one removed digit even if we are not going to loop below.
+					const int32_t l = kFloatPow5InvBitCount + RyuPow5Bits((int32_t)(q - 1)) - 1;
+					lastRemovedDigit = (uint8_t)(RyuMulPow5InvDivPow2(mv, q - 1, -e2 + (int32_t)q - 1 + l) % 10);
+				}
+
+				if(q <= 9)
+				{
+					// Only one of mp, mv, and mm can be a multiple of 5, if any.
+					if((mv % 5) == 0)
+						vrIsTrailingZeros = RyuMultipleOfPowerOf5(mv, q);
+					else if(acceptBounds)
+						vmIsTrailingZeros = RyuMultipleOfPowerOf5(mv - 1 - mmShift, q);
+					else
+						vp -= RyuMultipleOfPowerOf5(mv + 2, q) ? 1 : 0;
+				}
+			}
+			else
+			{
+				const uint32_t q = RyuLog10Pow5(-e2);
+				const int32_t  i = -e2 - (int32_t)q;
+				const int32_t  k = RyuPow5Bits(i) - kFloatPow5BitCount;
+				int32_t        j = (int32_t)q - k;
+
+				e10 = (int32_t)q + e2;
+				vr  = RyuMulPow5DivPow2(mv, (uint32_t)i, j);
+				vp  = RyuMulPow5DivPow2(mv + 2, (uint32_t)i, j);
+				vm  = RyuMulPow5DivPow2(mv - 1 - mmShift, (uint32_t)i, j);
+
+				if((q != 0) && (((vp - 1) / 10) <= (vm / 10)))
+				{
+					j = (int32_t)q - 1 - (RyuPow5Bits(i + 1) - kFloatPow5BitCount);
+					lastRemovedDigit = (uint8_t)(RyuMulPow5DivPow2(mv, (uint32_t)(i + 1), j) % 10);
+				}
+
+				if(q <= 1)
+				{
+					// {vr,vp,vm} is trailing zeros if {mv,mp,mm} has at least q trailing 0 bits.
+					// mv = 4 * m2, so it always has at least two trailing 0 bits.
+					vrIsTrailingZeros = true;
+
+					if(acceptBounds)
+						vmIsTrailingZeros = (mmShift == 1); // mm = mv - 1 - mmShift, so it has 1 trailing 0 bit iff mmShift == 1.
+					else
+						--vp;                               // mp = mv + 2, so it always has at least one trailing 0 bit.
+				}
+				else if(q < 31)
+					vrIsTrailingZeros = RyuMultipleOfPowerOf2(mv, q - 1);
+			}
+
+			// Step 4: Find the shortest decimal representation in the interval of valid representations.
+			int32_t  removed = 0;
+			uint32_t output;
+
+			if(vmIsTrailingZeros || vrIsTrailingZeros)
+			{
+				// General case, which happens rarely (~4%).
+				while((vp / 10) > (vm / 10))
+				{
+					vmIsTrailingZeros &= ((vm % 10) == 0);
+					vrIsTrailingZeros &= (lastRemovedDigit == 0);
+					lastRemovedDigit = (uint8_t)(vr % 10);
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+
+				if(vmIsTrailingZeros)
+				{
+					while((vm % 10) == 0)
+					{
+						vrIsTrailingZeros &= (lastRemovedDigit == 0);
+						lastRemovedDigit = (uint8_t)(vr % 10);
+						vr /= 10;
+						vp /= 10;
+						vm /= 10;
+						++removed;
+					}
+				}
+
+				if(vrIsTrailingZeros && (lastRemovedDigit == 5) && ((vr % 2) == 0))
+					lastRemovedDigit = 4; // Round even if the exact number is .....50..0.
+
+				// We need to take vr + 1 if vr is outside bounds or we need to round up.
+				output = vr + ((((vr == vm) && (!acceptBounds || !vmIsTrailingZeros)) || (lastRemovedDigit >= 5)) ? 1 : 0);
+			}
+			else
+			{
+				// Specialized for the common case (~96%).
+				while((vp / 10) > (vm / 10))
+				{
+					lastRemovedDigit = (uint8_t)(vr % 10);
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+
+				output = vr + (((vr == vm) || (lastRemovedDigit >= 5)) ? 1 : 0);
+			}
+
+			exponent = e10 + removed;
+			return output;
+		}
+
+
+		// Defined with the fixed precision formatting below.
+		template <typename Digits>
+		inline to_chars_result FormatFixedPrecision(char* first, char* last, bool bNegative, Digits& digits, int precision, bool bAlternate);
+
+
+		inline to_chars_result WriteFloatSpecial(char* first, char* last, bool bNegative, bool bNaN)
+		{
+			const size_t n = bNegative ? 4u : 3u;
+
+			if((size_t)(last - first) < n)
+				return CharconvTooLarge(last);
+
+			if(bNegative)
+				*first++ = '-';
+			memcpy(first, bNaN ? "nan" : "inf", 3);
+
+			to_chars_result result = { first + 3, errc() };
+			return result;
+		}
+
+
+		/// FormatDecimal
+		///
+		/// Writes [-]mantissa * 10^exponent, the shortest digits of the value
+		/// binaryMantissa * 2^binaryExponent, in the requested style. A fmt of zero
+		/// selects the plain to_chars(first, last, value) behavior: whichever of fixed
+		/// and scientific is shorter, preferring fixed on a tie. general follows
+		/// printf's %g rule with its default precision of 6, as the standard asks.
+		///
+		/// Fixed notation of a value whose shortest digits stop before the decimal
+		/// point prints the exact integer from Digits rather than padding with zeros.
+		///
+		template <typename Digits, typename Unsigned>
+		inline to_chars_result FormatDecimal(char* first, char* last, bool bNegative, Unsigned mantissa, int exponent, chars_format fmt,
+		                                     uint64_t binaryMantissa, int binaryExponent)
+		{
+			char        digits[20];
+			char* const pDigitsEnd = digits + sizeof(digits);
+			const char* pDigits    = WriteDecimalBackward(pDigitsEnd, mantissa);
+			const int   n          = (int)(pDigitsEnd - pDigits);
+			const int   x          = n + exponent - 1; // The exponent in scientific notation.
+			const int   xAbs       = (x < 0) ? -x : x;
+
+			const int scientificLength = n + ((n > 1) ? 1 : 0) + 2 + ((xAbs >= 100) ? 3 : 2);
+			const int fixedLength      = (exponent >= 0) ? (n + exponent) : ((n + exponent) > 0) ? (n + 1) : (2 - exponent);
+
+			bool bScientific;
+
+			if(fmt == chars_format::scientific)
+				bScientific = true;
+			else if(fmt == chars_format::fixed)
+				bScientific = false;
+			else if(fmt == chars_format::general)
+				bScientific = (x < -4) || (x >= 6);
+			else
+				bScientific = (scientificLength < fixedLength);
+
+			if(!bScientific && (exponent > 0))
+			{
+				Digits digits(binaryMantissa, binaryExponent);
+				return FormatFixedPrecision(first, last, bNegative, digits, 0, false);
+			}
+
+			const int length = (bScientific ? scientificLength : fixedLength) + (bNegative ? 1 : 0);
+
+			if((last - first) < length)
+				return CharconvTooLarge(last);
+
+			char* p = first;
+
+			if(bNegative)
+				*p++ = '-';
+
+			if(bScientific)
+			{
+				*p++ = *pDigits;
+				if(n > 1)
+				{
+					*p++ = '.';
+					memcpy(p, pDigits + 1, (size_t)(n - 1));
+					p += (n - 1);
+				}
+
+				*p++ = 'e';
+				*p++ = (x < 0) ? '-' : '+';
+				if(xAbs >= 100)
+				{
+					*p++ = (char)('0' + (xAbs / 100));
+					CopyDigitPair(p, (unsigned)(xAbs % 100));
+				}
+				else
+					CopyDigitPair(p, (unsigned)xAbs);
+				p += 2;
+			}
+			else if(exponent == 0)
+			{
+				memcpy(p, pDigits, (size_t)n);
+				p += n;
+			}
+			else if((n + exponent) > 0)
+			{
+				const int nInteger = n + exponent;
+
+				memcpy(p, pDigits, (size_t)nInteger);
+				p += nInteger;
+				*p++ = '.';
+				memcpy(p, pDigits + nInteger, (size_t)(n - nInteger));
+				p += (n - nInteger);
+			}
+			else
+			{
+				*p++ = '0';
+				*p++ = '.';
+				memset(p, '0', (size_t)-(n + exponent));
+				p += -(n + exponent);
+				memcpy(p, pDigits, (size_t)n);
+				p += n;
+			}
+
+			to_chars_result result = { p, errc() };
+			return result;
+		}
+
+
+		/// FormatHex
+		///
+		/// Writes the IEEE fields of a finite value as printf's %a does, without the
+		/// leading "0x". A negative precision selects the shortest form, with
+		/// trailing zero digits removed; otherwise the fraction is rounded half to
+		/// even or zero padded to precision hex digits.
+		///
+		inline to_chars_result FormatHex(char* first, char* last, bool bNegative, uint64_t ieeeMantissa, uint32_t ieeeExponent,
+		                                 int nMantissaBits, int bias, int precision = -1)
+		{
+			const int shift      = (4 - (nMantissaBits % 4)) % 4;
+			int       nHexDigits = (nMantissaBits + shift) / 4;
+			uint64_t  fraction   = ieeeMantissa << shift;
+			unsigned  leading    = (ieeeExponent != 0) ? 1u : 0u;
+			int       nZeros     = 0;
+			int       exponent;
+
+			if(ieeeExponent != 0)
+				exponent = (int)ieeeExponent - bias;
+			else
+				exponent = (ieeeMantissa != 0) ? (1 - bias) : 0;
+
+			if(precision < 0)
+			{
+				for(; (nHexDigits > 0) && ((fraction & 0xf) == 0); --nHexDigits)
+					fraction >>= 4;
+			}
+			else if(precision < nHexDigits)
+			{
+				// A carry out of the fraction turns the leading digit into 2, as with glibc.
+				const int      nDroppedBits = (nHexDigits - precision) * 4;
+				const uint64_t value        = ((uint64_t)leading << (nHexDigits * 4)) | fraction;
+				const uint64_t half         = (uint64_t)1 << (nDroppedBits - 1);
+				const uint64_t dropped      = value & ((half << 1) - 1);
+				uint64_t       kept         = value >> nDroppedBits;
+
+				if((dropped > half) || ((dropped == half) && (kept & 1)))
+					++kept;
+
+				leading    = (unsigned)(kept >> (precision * 4));
+				fraction   = kept & (((uint64_t)1 << (precision * 4)) - 1);
+				nHexDigits = precision;
+			}
+			else
+				nZeros = precision - nHexDigits;
+
+			char        exponentBuffer[8];
+			char* const pExponentEnd = exponentBuffer + sizeof(exponentBuffer);
+			char* const pExponent    = WriteDecimalBackward(pExponentEnd, (uint32_t)((exponent < 0) ? -exponent : exponent));
+			const int   nFraction    = nHexDigits + nZeros;
+
+			const int length = (bNegative ? 1 : 0) + 1 + ((nFraction > 0) ? (nFraction + 1) : 0) + 2 + (int)(pExponentEnd - pExponent);
+
+			if((last - first) < length)
+				return CharconvTooLarge(last);
+
+			char* p = first;
+
+			if(bNegative)
+				*p++ = '-';
+			*p++ = (char)('0' + leading);
+			if(nFraction > 0)
+			{
+				*p++ = '.';
+				for(int i = nHexDigits - 1; i >= 0; --i)
+				{
+					const unsigned d = (unsigned)fraction & 0xf;
+					p[i] = (char)((d < 10) ? ('0' + d) : ('a' + d - 10));
+					fraction >>= 4;
+				}
+				p += nHexDigits;
+				memset(p, '0', (size_t)nZeros);
+				p += nZeros;
+			}
+			*p++ = 'p';
+			*p++ = (exponent < 0) ? '-' : '+';
+			memcpy(p, pExponent, (size_t)(pExponentEnd - pExponent));
+			p += (pExponentEnd - pExponent);
+
+			to_chars_result result = { p, errc() };
+			return result;
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Fixed precision formatting
+		///////////////////////////////////////////////////////////////////////
+
+		/// CharconvExactDigits
+		///
+		/// Produces the exact decimal expansion of mantissa * 2^exponent one digit at
+		/// a time, the integer digits first and then the fraction digits. A binary
+		/// fraction always has a finite decimal expansion, so the digits can be
+		/// rounded half to even exactly, as printf does, with no error analysis.
+		///
+		/// kLimbs 32 bit limbs must hold the integer part, and the fraction bits plus
+		/// the 30 bits a multiplication by 10^9 adds. kMaxIntegerDigits is the length
+		/// of the largest integer part and kMaxSignificantDigits the length of the
+		/// longest expansion; every digit after that is zero.
+		///
+		template <int kLimbs, int kMaxIntegerDigits, int kMaxSignificant>
+		class CharconvExactDigits
+		{
+		public:
+			static const int kMaxSignificantDigits = kMaxSignificant;
+
+			CharconvExactDigits(uint64_t mantissa, int exponent)
+				: mnChunkIndex(9), mnLowLimb(0), mnFractionBits(0)
+			{
+				char* const pEnd = mIntegerDigits + kMaxIntegerDigits;
+				memset(mLimbs, 0, sizeof(mLimbs));
+
+				if(exponent >= 0)
+				{
+					const int limb = exponent / 32;
+					const int bit  = exponent % 32;
+
+					mLimbs[limb]     = (uint32_t)(mantissa << bit);
+					mLimbs[limb + 1] = (uint32_t)(mantissa >> (32 - bit));
+					mLimbs[limb + 2] = bit ? (uint32_t)(mantissa >> (64 - bit)) : 0;
+
+					// Peel off nine digits per pass; every limb is zero again at the end.
+					int   nLimbs = limb + 3;
+					char* p      = pEnd;
+
+					for(;;)
+					{
+						while((nLimbs > 0) && (mLimbs[nLimbs - 1] == 0))
+							--nLimbs;
+						if(nLimbs == 0)
+							break;
+
+						uint64_t remainder = 0;
+						for(int i = nLimbs - 1; i >= 0; --i)
+						{
+							const uint64_t current = (remainder << 32) | mLimbs[i];
+							mLimbs[i] = (uint32_t)(current / 1000000000u);
+							remainder = current - ((uint64_t)mLimbs[i] * 1000000000u);
+						}
+
+						char* const pChunkEnd = p;
+						p = WriteDecimalBackward(p, (uint32_t)remainder);
+
+						if((mLimbs[nLimbs - 1] != 0) || (nLimbs > 1))
+						{
+							while(p != (pChunkEnd - 9))
+								*--p = '0';
+						}
+					}
+
+					mpInteger = p;
+				}
+				else
+				{
+					const int nFractionBits = -exponent;
+					uint64_t  integer       = 0;
+
+					if(nFractionBits < 64)
+					{
+						integer   = mantissa >> nFractionBits;
+						mantissa &= ((uint64_t)1 << nFractionBits) - 1;
+					}
+
+					mpInteger      = integer ? WriteDecimalBackward(pEnd, integer) : pEnd;
+					mLimbs[0]      = (uint32_t)mantissa;
+					mLimbs[1]      = (uint32_t)(mantissa >> 32);
+					mnFractionBits = nFractionBits;
+				}
+			}
+
+			/// Returns the number of digits before the decimal point, zero if the
+			/// value is below one. Only valid before the first call to Next.
+			int IntegerDigitCount() const
+				{ return (int)((mIntegerDigits + kMaxIntegerDigits) - mpInteger); }
+
+			char Next()
+			{
+				if(mpInteger != (mIntegerDigits + kMaxIntegerDigits))
+					return *mpInteger++;
+
+				if(mnChunkIndex == 9)
+					NextChunk();
+				return mChunk[mnChunkIndex++];
+			}
+
+			/// Returns true if every digit after the last one returned by Next is zero.
+			bool RestIsZero() const
+			{
+				for(const char* p = mpInteger; p != (mIntegerDigits + kMaxIntegerDigits); ++p)
+				{
+					if(*p != '0')
+						return false;
+				}
+
+				for(int i = mnChunkIndex; i < 9; ++i)
+				{
+					if(mChunk[i] != '0')
+						return false;
+				}
+
+				return FractionIsZero();
+			}
+
+		protected:
+			bool FractionIsZero() const
+			{
+				for(int i = mnLowLimb, iEnd = (mnFractionBits / 32); i <= iEnd; ++i)
+				{
+					if(mLimbs[i] != 0)
+						return false;
+				}
+				return true;
+			}
+
+			void NextChunk()
+			{
+				mnChunkIndex = 0;
+
+				if(FractionIsZero())
+				{
+					memset(mChunk, '0', sizeof(mChunk));
+					return;
+				}
+
+				// Multiply the fraction by 10^9; the bits that move above the binary point
+				// are the next nine digits. The low limbs fill with zeros as it goes.
+				const int topLimb = mnFractionBits / 32;
+				const int bit     = mnFractionBits % 32;
+				uint64_t  carry   = 0;
+
+				for(int i = mnLowLimb; i <= (topLimb + 1); ++i)
+				{
+					const uint64_t t = ((uint64_t)mLimbs[i] * 1000000000u) + carry;
+					mLimbs[i] = (uint32_t)t;
+					carry     = t >> 32;
+				}
+
+				const uint32_t chunk = (uint32_t)((((uint64_t)mLimbs[topLimb + 1] << 32) | mLimbs[topLimb]) >> bit);
+
+				mLimbs[topLimb]    &= ((uint32_t)1 << bit) - 1;
+				mLimbs[topLimb + 1] = 0;
+
+				while((mnLowLimb < topLimb) && (mLimbs[mnLowLimb] == 0))
+					++mnLowLimb;
+
+				char* p = WriteDecimalBackward(mChunk + 9, chunk);
+				while(p != mChunk)
+					*--p = '0';
+			}
+
+			uint32_t mLimbs[kLimbs];
+			char     mIntegerDigits[kMaxIntegerDigits];
+			char*    mpInteger;
+			char     mChunk[9];
+			int      mnChunkIndex;
+			int      mnLowLimb;
+			int      mnFractionBits;
+		};
+
+		typedef CharconvExactDigits<6, 39, 112> FloatExactDigits;    // 2^128 has 39 digits; no float expansion has more than 112 significant digits.
+
+		#if !EASTL_CHARCONV_DOUBLE_IS_FLOAT
+			typedef CharconvExactDigits<35, 309, 767> DoubleExactDigits; // 2^1024 has 309 digits; no double expansion has more than 767 significant digits.
+
+
+			/// DoubleReadsBack
+			///
+			/// Returns true if mantissa * 10^exponent reads back as value. When both
+			/// factors are exact doubles one correctly rounded operation decides it, as
+			/// in FromCharsFloat; otherwise strtod does.
+			///
+			inline bool DoubleReadsBack(double value, uint64_t mantissa, int exponent)
+			{
+				if(((mantissa >> 53) == 0) && (exponent >= -22) && (exponent <= 22))
+				{
+					double scale = 1;
+					for(int i = (exponent < 0) ? -exponent : exponent; i > 0; --i)
+						scale *= 10;
+
+					return ((exponent < 0) ? ((double)mantissa / scale) : ((double)mantissa * scale)) == value;
+				}
+
+				char        buffer[32];
+				char* const pMantissaEnd = buffer + 20;
+				char*       p            = pMantissaEnd;
+
+				*p++ = 'e';
+				if(exponent < 0)
+					*p++ = '-';
+
+				const uint32_t exponentAbs = (uint32_t)((exponent < 0) ? -exponent : exponent);
+				p += CountDecimalDigits(exponentAbs);
+				WriteDecimalBackward(p, exponentAbs);
+				*p = 0;
+
+				return strtod(WriteDecimalBackward(pMantissaEnd, mantissa), NULL) == value;
+			}
+
+
+			/// DoubleToDecimal
+			///
+			/// The 64 bit double counterpart of FloatToDecimal for positive finite values.
+			/// Seventeen significant digits always read back. The exact expansion is
+			/// rounded to each precision up to that in turn, half to even, and the first
+			/// that reads back is the shortest.
+			///
+			inline uint64_t DoubleToDecimal(double value, int& exponent)
+			{
+				uint64_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+
+				const uint64_t ieeeMantissa = bits & UINT64_C(0xfffffffffffff);
+				const uint32_t ieeeExponent = (uint32_t)(bits >> 52) & 0x7ffu;
+
+				DoubleExactDigits digits((ieeeExponent != 0) ? (ieeeMantissa | UINT64_C(0x10000000000000)) : ieeeMantissa,
+				                         ((ieeeExponent != 0) ? (int)ieeeExponent : 1) - 1075);
+
+				// The exponent of the first significant digit in scientific notation.
+				int  x = digits.IntegerDigitCount() - 1;
+				char d[18];
+
+				d[0] = digits.Next();
+				for(; d[0] == '0'; --x)
+					d[0] = digits.Next();
+				for(int i = 1; i < 18; ++i)
+					d[i] = digits.Next();
+
+				const bool bRestIsZero = digits.RestIsZero();
+				uint64_t   mantissa    = 0;
+				uint64_t   power       = 1;
+
+				for(int n = 1; ; ++n)
+				{
+					mantissa = (mantissa * 10) + (uint64_t)(d[n - 1] - '0');
+					power   *= 10;
+
+					bool bRoundsUp = (d[n] > '5');
+
+					if(d[n] == '5')
+					{
+						bRoundsUp = ((mantissa & 1) != 0) || !bRestIsZero;
+						for(int i = n + 1; (i < 18) && !bRoundsUp; ++i)
+							bRoundsUp = (d[i] != '0');
+					}
+
+					uint64_t rounded = mantissa + (bRoundsUp ? 1 : 0);
+
+					exponent = x - (n - 1);
+					if(rounded == power) // 99..9 rounded up to 10^n.
+					{
+						rounded   = 1;
+						exponent += n;
+					}
+
+					if((n == 17) || DoubleReadsBack(value, rounded, exponent))
+						return rounded;
+				}
+			}
+		#endif
+
+
+		/// CharconvRoundsUp
+		///
+		/// Consumes the next digit and returns true if the digits written so far,
+		/// the last of which is lastDigit, round up to nearest, ties to even.
+		///
+		template <typename Digits>
+		inline bool CharconvRoundsUp(Digits& digits, char lastDigit)
+		{
+			const char next = digits.Next();
+			return (next > '5') || ((next == '5') && ((((lastDigit - '0') & 1) != 0) || !digits.RestIsZero()));
+		}
+
+
+		/// CharconvPropagateCarry
+		///
+		/// Adds one to the last digit of [pBegin, pEnd), skipping a decimal point.
+		/// Returns true if the carry ran off the front, leaving all zeros.
+		///
+		inline bool CharconvPropagateCarry(char* pBegin, char* pEnd)
+		{
+			while(pEnd != pBegin)
+			{
+				if(*--pEnd != '.')
+				{
+					if(*pEnd != '9')
+					{
+						++*pEnd;
+						return false;
+					}
+					*pEnd = '0';
+				}
+			}
+			return true;
+		}
+
+
+		template <typename Digits>
+		inline to_chars_result FormatFixedPrecision(char* first, char* last, bool bNegative, Digits& digits, int precision, bool bAlternate)
+		{
+			const int  nInteger = digits.IntegerDigitCount();
+			const bool bPoint   = (precision > 0) || bAlternate;
+			const int  length   = (bNegative ? 1 : 0) + ((nInteger > 0) ? nInteger : 1) + (bPoint ? 1 : 0) + precision;
+
+			if((last - first) < length)
+				return CharconvTooLarge(last);
+
+			char* p = first;
+
+			if(bNegative)
+				*p++ = '-';
+
+			char* const pDigits = p;
+
+			if(nInteger == 0)
+				*p++ = '0';
+			for(int i = 0; i < nInteger; ++i)
+				*p++ = digits.Next();
+
+			char lastDigit = p[-1];
+
+			if(bPoint)
+				*p++ = '.';
+			for(int i = 0; i < precision; ++i)
+				*p++ = lastDigit = digits.Next();
+
+			if(CharconvRoundsUp(digits, lastDigit) && CharconvPropagateCarry(pDigits, p))
+			{
+				if(p == last)
+					return CharconvTooLarge(last);
+
+				memmove(pDigits + 1, pDigits, (size_t)(p - pDigits));
+				*pDigits = '1';
+				++p;
+			}
+
+			to_chars_result result = { p, errc() };
+			return result;
+		}
+
+
+		/// FormatSignificantPrecision
+		///
+		/// Writes nSignificant significant digits in scientific notation, or for
+		/// general in printf's %g style: fixed notation when the exponent is in
+		/// [-4, nSignificant) and trailing zeros removed unless bAlternate is set.
+		///
+		template <typename Digits>
+		inline to_chars_result FormatSignificantPrecision(char* first, char* last, bool bNegative, Digits& digits, bool bZero,
+		                                                  int nSignificant, bool bGeneral, bool bAlternate)
+		{
+			char      buffer[Digits::kMaxSignificantDigits];
+			const int nCollected = (nSignificant < Digits::kMaxSignificantDigits) ? nSignificant : Digits::kMaxSignificantDigits;
+			int       x          = 0; // The exponent in scientific notation.
+
+			if(bZero)
+				memset(buffer, '0', (size_t)nCollected);
+			else
+			{
+				x = digits.IntegerDigitCount() - 1;
+
+				char c = digits.Next();
+				for(; c == '0'; c = digits.Next())
+					--x;
+
+				buffer[0] = c;
+				for(int i = 1; i < nCollected; ++i)
+					buffer[i] = digits.Next();
+
+				if(CharconvRoundsUp(digits, buffer[nCollected - 1]) && CharconvPropagateCarry(buffer, buffer + nCollected))
+				{
+					buffer[0] = '1';
+					++x;
+				}
+			}
+
+			// Digits past nCollected are zeros.
+			int  nDigits     = nSignificant;
+			bool bScientific = true;
+
+			if(bGeneral)
+			{
+				bScientific = (x < -4) || (x >= nSignificant);
+
+				if(!bAlternate)
+				{
+					const int nMin = (!bScientific && (x >= 0)) ? (x + 1) : 1;
+
+					for(nDigits = nCollected; (nDigits > nMin) && (buffer[nDigits - 1] == '0'); )
+						--nDigits;
+				}
+			}
+
+			const int xAbs = (x < 0) ? -x : x;
+			int       length;
+
+			if(bScientific)
+				length = nDigits + (((nDigits > 1) || bAlternate) ? 1 : 0) + 2 + ((xAbs >= 100) ? 3 : 2);
+			else if(x >= 0)
+				length = nDigits + (((nDigits > (x + 1)) || bAlternate) ? 1 : 0);
+			else
+				length = 1 + xAbs + nDigits;
+
+			if((last - first) < (length + (bNegative ? 1 : 0)))
+				return CharconvTooLarge(last);
+
+			char* p = first;
+
+			if(bNegative)
+				*p++ = '-';
+
+			if(!bScientific && (x < 0))
+			{
+				*p++ = '0';
+				*p++ = '.';
+				for(int i = 1; i < xAbs; ++i)
+					*p++ = '0';
+			}
+
+			const int nBeforePoint = bScientific ? 1 : (x >= 0) ? (x + 1) : 0;
+
+			for(int i = 0; i < nDigits; ++i)
+			{
+				if((i == nBeforePoint) && (i != 0))
+					*p++ = '.';
+				*p++ = (i < nCollected) ? buffer[i] : '0';
+			}
+
+			if((nDigits == nBeforePoint) && bAlternate)
+				*p++ = '.';
+
+			if(bScientific)
+			{
+				*p++ = 'e';
+				*p++ = (x < 0) ? '-' : '+';
+				if(xAbs >= 100)
+				{
+					*p++ = (char)('0' + (xAbs / 100));
+					CopyDigitPair(p, (unsigned)(xAbs % 100));
+				}
+				else
+					CopyDigitPair(p, (unsigned)xAbs);
+				p += 2;
+			}
+
+			to_chars_result result = { p, errc() };
+			return result;
+		}
+
+
+		/// FormatPrecision
+		///
+		/// Writes [-]mantissa * 2^exponent as printf's %f, %e and %g do with the given
+		/// precision. bAlternate corresponds to printf's '#' flag.
+		///
+		template <typename Digits>
+		inline to_chars_result FormatPrecision(char* first, char* last, bool bNegative, uint64_t mantissa, int exponent,
+		                                       chars_format fmt, int precision, bool bAlternate)
+		{
+			Digits digits(mantissa, exponent);
+
+			if(fmt == chars_format::fixed)
+				return FormatFixedPrecision(first, last, bNegative, digits, precision, bAlternate);
+
+			if(fmt == chars_format::scientific)
+				return FormatSignificantPrecision(first, last, bNegative, digits, mantissa == 0, precision + 1, false, bAlternate);
+
+			return FormatSignificantPrecision(first, last, bNegative, digits, mantissa == 0, (precision > 0) ? precision : 1, true, bAlternate);
+		}
+
+
+		inline to_chars_result ToCharsFloat(char* first, char* last, float value, chars_format fmt)
+		{
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			const bool     bNegative    = (bits >> 31) != 0;
+			const uint32_t ieeeMantissa = bits & 0x7fffffu;
+			const uint32_t ieeeExponent = (bits >> 23) & 0xffu;
+
+			if(ieeeExponent == 0xff)
+				return WriteFloatSpecial(first, last, bNegative, ieeeMantissa != 0);
+
+			if(fmt == chars_format::hex)
+				return FormatHex(first, last, bNegative, ieeeMantissa, ieeeExponent, 23, 127);
+
+			if((ieeeExponent == 0) && (ieeeMantissa == 0))
+				return FormatDecimal<FloatExactDigits>(first, last, bNegative, (uint32_t)0, 0, fmt, 0, 0);
+
+			int            exponent;
+			const uint32_t mantissa = FloatToDecimal(ieeeMantissa, ieeeExponent, exponent);
+
+			return FormatDecimal<FloatExactDigits>(first, last, bNegative, mantissa, exponent, fmt, (ieeeExponent != 0) ? (ieeeMantissa | 0x800000u) : ieeeMantissa,
+			                                       ((ieeeExponent != 0) ? (int)ieeeExponent : 1) - 150);
+		}
+
+
+		inline to_chars_result ToCharsDouble(char* first, char* last, double value, chars_format fmt)
+		{
+			#if EASTL_CHARCONV_DOUBLE_IS_FLOAT
+				return ToCharsFloat(first, last, (float)value, fmt);
+			#else
+				uint64_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+
+				const bool     bNegative    = (bits >> 63) != 0;
+				const uint64_t ieeeMantissa = bits & UINT64_C(0xfffffffffffff);
+				const uint32_t ieeeExponent = (uint32_t)(bits >> 52) & 0x7ffu;
+
+				if(ieeeExponent == 0x7ff)
+					return WriteFloatSpecial(first, last, bNegative, ieeeMantissa != 0);
+
+				if(fmt == chars_format::hex)
+					return FormatHex(first, last, bNegative, ieeeMantissa, ieeeExponent, 52, 1023);
+
+				if((ieeeExponent == 0) && (ieeeMantissa == 0))
+					return FormatDecimal<DoubleExactDigits>(first, last, bNegative, (uint32_t)0, 0, fmt, 0, 0);
+
+				int            exponent;
+				const uint64_t mantissa = DoubleToDecimal(bNegative ? -value : value, exponent);
+
+				return FormatDecimal<DoubleExactDigits>(first, last, bNegative, mantissa, exponent, fmt, (ieeeExponent != 0) ? (ieeeMantissa | UINT64_C(0x10000000000000)) : ieeeMantissa,
+				                                        ((ieeeExponent != 0) ? (int)ieeeExponent : 1) - 1075);
+			#endif
+		}
+
+
+		inline to_chars_result ToCharsFloat(char* first, char* last, float value, chars_format fmt, int precision, bool bAlternate)
+		{
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			const bool     bNegative    = (bits >> 31) != 0;
+			const uint32_t ieeeMantissa = bits & 0x7fffffu;
+			const uint32_t ieeeExponent = (bits >> 23) & 0xffu;
+
+			if(ieeeExponent == 0xff)
+				return WriteFloatSpecial(first, last, bNegative, ieeeMantissa != 0);
+
+			if(fmt == chars_format::hex)
+				return FormatHex(first, last, bNegative, ieeeMantissa, ieeeExponent, 23, 127, precision);
+
+			const uint32_t mantissa = (ieeeExponent != 0) ? (ieeeMantissa | 0x800000u) : ieeeMantissa;
+			const int      exponent = ((ieeeExponent != 0) ? (int)ieeeExponent : 1) - 150;
+
+			return FormatPrecision<FloatExactDigits>(first, last, bNegative, mantissa, exponent, fmt, (precision < 0) ? 6 : precision, bAlternate);
+		}
+
+
+		inline to_chars_result ToCharsDouble(char* first, char* last, double value, chars_format fmt, int precision, bool bAlternate)
+		{
+			#if EASTL_CHARCONV_DOUBLE_IS_FLOAT
+				return ToCharsFloat(first, last, (float)value, fmt, precision, bAlternate);
+			#else
+				uint64_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+
+				const bool     bNegative    = (bits >> 63) != 0;
+				const uint64_t ieeeMantissa = bits & UINT64_C(0xfffffffffffff);
+				const uint32_t ieeeExponent = (uint32_t)(bits >> 52) & 0x7ffu;
+
+				if(ieeeExponent == 0x7ff)
+					return WriteFloatSpecial(first, last, bNegative, ieeeMantissa != 0);
+
+				if(fmt == chars_format::hex)
+					return FormatHex(first, last, bNegative, ieeeMantissa, ieeeExponent, 52, 1023, precision);
+
+				const uint64_t mantissa = (ieeeExponent != 0) ? (ieeeMantissa | UINT64_C(0x10000000000000)) : ieeeMantissa;
+				const int      exponent = ((ieeeExponent != 0) ? (int)ieeeExponent : 1) - 1075;
+
+				return FormatPrecision<DoubleExactDigits>(first, last, bNegative, mantissa, exponent, fmt, (precision < 0) ? 6 : precision, bAlternate);
+			#endif
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Float parsing
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename T> struct CharconvFloatTraits;
+
+		template <>
+		struct CharconvFloatTraits<float>
+		{
+			static const int kMantissaDigits = 24;  // Including the implicit bit.
+			static const int kMinExponent    = -126;
+			static const int kMaxExactPow10  = 10;  // 10^10 is the largest power of ten a float holds exactly.
+			static const int kMaxSlowDigits  = 120; // Enough significant digits to decide any float rounding.
+
+			static float Parse(const char* p)
+			{
+				#if EASTL_CHARCONV_DOUBLE_IS_FLOAT
+					return (float)strtod(p, NULL);
+				#else
+					return strtof(p, NULL);
+				#endif
+			}
+		};
+
+		template <>
+		struct CharconvFloatTraits<double>
+		{
+			#if EASTL_CHARCONV_DOUBLE_IS_FLOAT
+				static const int kMantissaDigits = 24;
+				static const int kMinExponent    = -126;
+				static const int kMaxExactPow10  = 10;
+				static const int kMaxSlowDigits  = 120;
+			#else
+				static const int kMantissaDigits = 53;
+				static const int kMinExponent    = -1022;
+				static const int kMaxExactPow10  = 22;
+				static const int kMaxSlowDigits  = 780;
+			#endif
+
+			static double Parse(const char* p) { return strtod(p, NULL); }
+		};
+
+
+		inline bool CharconvMatchNoCase(const char* p, const char* last, const char* pLowerCase)
+		{
+			for(; *pLowerCase; ++p, ++pLowerCase)
+			{
+				if((p == last) || ((*p | 0x20) != *pLowerCase))
+					return false;
+			}
+			return true;
+		}
+
+
+		/// ParseFloatSpecial
+		///
+		/// Parses "inf", "infinity", "nan" and "nan(n-char-sequence)", ignoring case.
+		/// p points just past the optional minus sign.
+		///
+		template <typename T>
+		inline from_chars_result ParseFloatSpecial(const char* first, const char* p, const char* last, bool bNegative, T& value)
+		{
+			from_chars_result result = { first, errc::invalid_argument };
+
+			if(CharconvMatchNoCase(p, last, "inf"))
+			{
+				p += CharconvMatchNoCase(p, last, "infinity") ? 8 : 3;
+				value = bNegative ? -(T)INFINITY : (T)INFINITY;
+				result.ptr = p;
+				result.ec  = errc();
+			}
+			else if(CharconvMatchNoCase(p, last, "nan"))
+			{
+				p += 3;
+
+				if((p != last) && (*p == '('))
+				{
+					const char* pEnd = p + 1;
+					while((pEnd != last) && ((CharconvDigitValue(*pEnd) < 36) || (*pEnd == '_')))
+						++pEnd;
+					if((pEnd != last) && (*pEnd == ')'))
+						p = pEnd + 1;
+				}
+
+				value = bNegative ? -(T)NAN : (T)NAN;
+				result.ptr = p;
+				result.ec  = errc();
+			}
+
+			return result;
+		}
+
+
+		/// FromCharsHex
+		///
+		/// Parses the hex subject sequence (no "0x" prefix, 'p' exponent) and rounds
+		/// it to T with round-half-even.
+		///
+		template <typename T>
+		inline from_chars_result FromCharsHex(const char* first, const char* p, const char* last, bool bNegative, T& value)
+		{
+			typedef CharconvFloatTraits<T> traits;
+
+			from_chars_result result = { first, errc::invalid_argument };
+			uint64_t mantissa   = 0;
+			int      exponent   = 0;
+			bool     bSticky    = false;
+			bool     bAnyDigits = false;
+			bool     bPoint     = false;
+
+			for(; p != last; ++p)
+			{
+				if((*p == '.') && !bPoint)
+				{
+					bPoint = true;
+					continue;
+				}
+
+				const unsigned d = CharconvDigitValue(*p);
+				if(d >= 16)
+					break;
+
+				bAnyDigits = true;
+				if((mantissa >> 56) == 0)
+				{
+					mantissa = (mantissa << 4) | d;
+					if(bPoint)
+						exponent -= 4;
+				}
+				else
+				{
+					bSticky |= (d != 0);
+					if(!bPoint)
+						exponent += 4;
+				}
+			}
+
+			if(!bAnyDigits)
+				return result;
+
+			if((p != last) && ((*p | 0x20) == 'p'))
+			{
+				const char* pExponent = p + 1;
+				bool        bExponentNegative = false;
+
+				if((pExponent != last) && ((*pExponent == '+') || (*pExponent == '-')))
+					bExponentNegative = (*pExponent++ == '-');
+
+				if((pExponent != last) && ((unsigned)(*pExponent - '0') < 10u))
+				{
+					int e = 0;
+					for(; (pExponent != last) && ((unsigned)(*pExponent - '0') < 10u); ++pExponent)
+						if(e < 100000)
+							e = (e * 10) + (*pExponent - '0');
+					exponent += bExponentNegative ? -e : e;
+					p = pExponent;
+				}
+			}
+
+			result.ptr = p;
+			result.ec  = errc();
+
+			if(mantissa == 0)
+			{
+				value = bNegative ? -(T)0 : (T)0;
+				return result;
+			}
+
+			// Round mantissa to the number of bits available at this magnitude.
+			int msb = 63;
+			while(((mantissa >> msb) & 1) == 0)
+				--msb;
+
+			int nBits = traits::kMantissaDigits;
+			if((msb + exponent) < traits::kMinExponent)
+				nBits -= (traits::kMinExponent - (msb + exponent));
+
+			const int nDropped = (msb + 1) - nBits;
+
+			if(nDropped > 0)
+			{
+				uint64_t rounded = 0; // Below half of the smallest subnormal everything rounds to zero.
+
+				if(nBits >= 0)
+				{
+					const uint64_t half = UINT64_C(1) << (nDropped - 1);
+					const uint64_t rest = mantissa & ((UINT64_C(1) << nDropped) - 1);
+
+					rounded = mantissa >> nDropped;
+					if((rest > half) || ((rest == half) && (bSticky || (rounded & 1))))
+						++rounded;
+				}
+
+				mantissa  = rounded;
+				exponent += nDropped;
+			}
+
+			const T v = (T)ldexp((double)mantissa, exponent);
+
+			if((v == 0) || (v == (T)INFINITY))
+				result.ec = errc::result_out_of_range;
+			else
+				value = bNegative ? -v : v;
+
+			return result;
+		}
+
+
+		/// FromCharsFloatSlow
+		///
+		/// Re-reads the digits in [p, pDigitsEnd) into a normalized "digits e exponent"
+		/// string and lets strtod do the correctly rounded conversion. Digits beyond
+		/// kMaxSlowDigits are replaced by a single sticky 1 when any of them is non-zero,
+		/// which cannot change the rounding.
+		///
+		template <typename T>
+		EA_NO_INLINE T FromCharsFloatSlow(const char* p, const char* pDigitsEnd, int exponent)
+		{
+			typedef CharconvFloatTraits<T> traits;
+
+			char  buffer[traits::kMaxSlowDigits + 16];
+			char* pOut    = buffer;
+			int   nDigits = 0;
+			bool  bPoint  = false;
+			bool  bSticky = false;
+
+			for(; p != pDigitsEnd; ++p)
+			{
+				if(*p == '.')
+				{
+					bPoint = true;
+					continue;
+				}
+
+				if((nDigits == 0) && (*p == '0'))
+				{
+					if(bPoint)
+						--exponent;
+					continue;
+				}
+
+				if(nDigits < traits::kMaxSlowDigits)
+				{
+					*pOut++ = *p;
+					++nDigits;
+					if(bPoint)
+						--exponent;
+				}
+				else
+				{
+					bSticky |= (*p != '0');
+					if(!bPoint)
+						++exponent;
+				}
+			}
+
+			if(bSticky)
+			{
+				*pOut++ = '1';
+				--exponent;
+			}
+
+			*pOut++ = 'e';
+			if(exponent < 0)
+			{
+				*pOut++ = '-';
+				exponent = -exponent;
+			}
+			const int nExponentDigits = CountDecimalDigits((uint32_t)exponent);
+			WriteDecimalBackward(pOut + nExponentDigits, (uint32_t)exponent);
+			pOut[nExponentDigits] = 0;
+
+			return traits::Parse(buffer);
+		}
+
+
+		template <typename T>
+		inline from_chars_result FromCharsFloat(const char* first, const char* last, T& value, chars_format fmt)
+		{
+			typedef CharconvFloatTraits<T> traits;
+
+			from_chars_result result = { first, errc::invalid_argument };
+			const char* p         = first;
+			bool        bNegative = false;
+
+			if((p != last) && (*p == '-'))
+			{
+				bNegative = true;
+				++p;
+			}
+
+			if((p != last) && (((*p | 0x20) == 'i') || ((*p | 0x20) == 'n')))
+				return ParseFloatSpecial(first, p, last, bNegative, value);
+
+			if(fmt == chars_format::hex)
+				return FromCharsHex(first, p, last, bNegative, value);
+
+			// Read up to 19 significant digits, which always fit in 64 bits.
+			const char* const pDigitsBegin = p;
+			uint64_t mantissa   = 0;
+			int      nDigits    = 0;
+			int      exponent   = 0;
+			bool     bExact     = true;
+			bool     bAnyDigits = false;
+
+			for(; (p != last) && ((unsigned)(*p - '0') < 10u); ++p)
+			{
+				bAnyDigits = true;
+				if((nDigits == 0) && (*p == '0'))
+					continue;
+				if(nDigits < 19)
+				{
+					mantissa = (mantissa * 10) + (unsigned)(*p - '0');
+					++nDigits;
+				}
+				else
+				{
+					bExact &= (*p == '0');
+					++exponent;
+				}
+			}
+
+			if((p != last) && (*p == '.'))
+			{
+				for(++p; (p != last) && ((unsigned)(*p - '0') < 10u); ++p)
+				{
+					bAnyDigits = true;
+					if((nDigits == 0) && (*p == '0'))
+					{
+						--exponent;
+						continue;
+					}
+					if(nDigits < 19)
+					{
+						mantissa = (mantissa * 10) + (unsigned)(*p - '0');
+						++nDigits;
+						--exponent;
+					}
+					else
+						bExact &= (*p == '0');
+				}
+			}
+
+			if(!bAnyDigits)
+				return result;
+
+			const char* const pDigitsEnd = p;
+			int explicitExponent = 0;
+
+			if(((int)fmt & (int)chars_format::scientific) && (p != last) && ((*p | 0x20) == 'e'))
+			{
+				const char* pExponent = p + 1;
+				bool        bExponentNegative = false;
+
+				if((pExponent != last) && ((*pExponent == '+') || (*pExponent == '-')))
+					bExponentNegative = (*pExponent++ == '-');
+
+				if((pExponent != last) && ((unsigned)(*pExponent - '0') < 10u))
+				{
+					for(; (pExponent != last) && ((unsigned)(*pExponent - '0') < 10u); ++pExponent)
+						if(explicitExponent < 100000)
+							explicitExponent = (explicitExponent * 10) + (*pExponent - '0');
+					if(bExponentNegative)
+						explicitExponent = -explicitExponent;
+					p = pExponent;
+				}
+			}
+
+			if((fmt == chars_format::scientific) && (p == pDigitsEnd))
+				return result; // The exponent is required.
+
+			result.ptr = p;
+			result.ec  = errc();
+
+			if(mantissa == 0)
+			{
+				value = bNegative ? -(T)0 : (T)0;
+				return result;
+			}
+
+			exponent += explicitExponent;
+
+			T v;
+
+			if(bExact && ((mantissa >> traits::kMantissaDigits) == 0) &&
+			   (exponent >= -traits::kMaxExactPow10) && (exponent <= traits::kMaxExactPow10))
+			{
+				// Both mantissa and 10^|exponent| are exact, so a single correctly rounded
+				// multiply or divide gives the correctly rounded result.
+				T scale = 1;
+				for(int i = (exponent < 0) ? -exponent : exponent; i > 0; --i)
+					scale *= 10;
+
+				v = (T)mantissa;
+				v = (exponent < 0) ? (v / scale) : (v * scale);
+			}
+			else
+			{
+				v = FromCharsFloatSlow<T>(pDigitsBegin, pDigitsEnd, explicitExponent);
+
+				if((v == 0) || (v == (T)INFINITY))
+				{
+					result.ec = errc::result_out_of_range;
+					return result;
+				}
+			}
+
+			value = bNegative ? -v : v;
+			return result;
+		}
+
+	} // namespace Internal
+
+
+
+	/// to_chars
+	///
+	/// Integer overloads. Writes value in the given base (2 to 36) with lower case
+	/// letters for digits above 9 and a leading '-' for negative values. On success
+	/// returns { end of the written characters, errc() }; if the range is too small
+	/// returns { last, errc::value_too_large } and the range contents are unspecified.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/to_chars
+	///
+	inline to_chars_result to_chars(char* first, char* last, char value, int base = 10)
+	{
+		return (char(-1) < char(0)) ? Internal::ToCharsSigned<signed char, unsigned char>(first, last, (signed char)value, base)
+		                            : Internal::ToCharsUnsigned(first, last, (uint32_t)(unsigned char)value, base);
+	}
+
+	inline to_chars_result to_chars(char* first, char* last, signed char value, int base = 10)
+		{ return Internal::ToCharsSigned<signed char, unsigned char>(first, last, value, base); }
+	inline to_chars_result to_chars(char* first, char* last, unsigned char value, int base = 10)
+		{ return Internal::ToCharsUnsigned(first, last, (uint32_t)value, base); }
+	inline to_chars_result to_chars(char* first, char* last, short value, int base = 10)
+		{ return Internal::ToCharsSigned<short, unsigned short>(first, last, value, base); }
+	inline to_chars_result to_chars(char* first, char* last, unsigned short value, int base = 10)
+		{ return Internal::ToCharsUnsigned(first, last, (uint32_t)value, base); }
+	inline to_chars_result to_chars(char* first, char* last, int value, int base = 10)
+		{ return Internal::ToCharsSigned<int, unsigned int>(first, last, value, base); }
+	inline to_chars_result to_chars(char* first, char* last, unsigned int value, int base = 10)
+		{ return Internal::ToCharsUnsigned(first, last, (Internal::CharconvUnsigned<sizeof(unsigned int)>::type)value, base); }
+	inline to_chars_result to_chars(char* first, char* last, long value, int base = 10)
+		{ return Internal::ToCharsSigned<long, unsigned long>(first, last, value, base); }
+	inline to_chars_result to_chars(char* first, char* last, unsigned long value, int base = 10)
+		{ return Internal::ToCharsUnsigned(first, last, (Internal::CharconvUnsigned<sizeof(unsigned long)>::type)value, base); }
+	inline to_chars_result to_chars(char* first, char* last, long long value, int base = 10)
+		{ return Internal::ToCharsSigned<long long, unsigned long long>(first, last, value, base); }
+	inline to_chars_result to_chars(char* first, char* last, unsigned long long value, int base = 10)
+		{ return Internal::ToCharsUnsigned(first, last, (Internal::CharconvUnsigned<sizeof(unsigned long long)>::type)value, base); }
+
+	to_chars_result to_chars(char* first, char* last, bool value, int base = 10) = delete;
+
+
+	/// to_chars
+	///
+	/// Floating point overloads. Without a format the result is the shortest
+	/// representation that from_chars reads back to exactly value, in fixed or
+	/// scientific notation, whichever is shorter. With a format the shortest
+	/// round trip digits are written in that style (hex as printf's %a without
+	/// the "0x" prefix).
+	///
+	inline to_chars_result to_chars(char* first, char* last, float value)
+		{ return Internal::ToCharsFloat(first, last, value, chars_format(0)); }
+
+	inline to_chars_result to_chars(char* first, char* last, double value)
+		{ return Internal::ToCharsDouble(first, last, value, chars_format(0)); }
+
+	inline to_chars_result to_chars(char* first, char* last, long double value)
+		{ return Internal::ToCharsDouble(first, last, (double)value, chars_format(0)); }
+
+	inline to_chars_result to_chars(char* first, char* last, float value, chars_format fmt)
+		{ return Internal::ToCharsFloat(first, last, value, fmt); }
+
+	inline to_chars_result to_chars(char* first, char* last, double value, chars_format fmt)
+		{ return Internal::ToCharsDouble(first, last, value, fmt); }
+
+	inline to_chars_result to_chars(char* first, char* last, long double value, chars_format fmt)
+		{ return Internal::ToCharsDouble(first, last, (double)value, fmt); }
+
+
+	/// to_chars
+	///
+	/// Floating point overloads with a precision. The result is what printf would
+	/// produce for %f (fixed), %e (scientific), %g (general) or %a (hex, without
+	/// the "0x" prefix) with that precision, in the "C" locale. The digits are
+	/// exact and rounded half to even however large the precision is; a negative
+	/// precision selects 6, or the shortest form for hex.
+	///
+	inline to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, int precision)
+		{ return Internal::ToCharsFloat(first, last, value, fmt, precision, false); }
+
+	inline to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, int precision)
+		{ return Internal::ToCharsDouble(first, last, value, fmt, precision, false); }
+
+	inline to_chars_result to_chars(char* first, char* last, long double value, chars_format fmt, int precision)
+		{ return Internal::ToCharsDouble(first, last, (double)value, fmt, precision, false); }
+
+
+	/// from_chars
+	///
+	/// Integer overloads. Parses an optional '-' (signed types only) followed by
+	/// digits in the given base. Leading whitespace, '+' and "0x" are not accepted.
+	/// Returns errc::invalid_argument with ptr == first if no digits were found,
+	/// and errc::result_out_of_range with ptr past the digits if the value does
+	/// not fit; value is only modified on success.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/from_chars
+	///
+	inline from_chars_result from_chars(const char* first, const char* last, char& value, int base = 10)
+		{ return Internal::FromCharsInteger<char, unsigned char>(first, last, value, base, char(-1) < char(0)); }
+	inline from_chars_result from_chars(const char* first, const char* last, signed char& value, int base = 10)
+		{ return Internal::FromCharsInteger<signed char, unsigned char>(first, last, value, base, true); }
+	inline from_chars_result from_chars(const char* first, const char* last, unsigned char& value, int base = 10)
+		{ return Internal::FromCharsInteger<unsigned char, unsigned char>(first, last, value, base, false); }
+	inline from_chars_result from_chars(const char* first, const char* last, short& value, int base = 10)
+		{ return Internal::FromCharsInteger<short, unsigned short>(first, last, value, base, true); }
+	inline from_chars_result from_chars(const char* first, const char* last, unsigned short& value, int base = 10)
+		{ return Internal::FromCharsInteger<unsigned short, unsigned short>(first, last, value, base, false); }
+	inline from_chars_result from_chars(const char* first, const char* last, int& value, int base = 10)
+		{ return Internal::FromCharsInteger<int, unsigned int>(first, last, value, base, true); }
+	inline from_chars_result from_chars(const char* first, const char* last, unsigned int& value, int base = 10)
+		{ return Internal::FromCharsInteger<unsigned int, unsigned int>(first, last, value, base, false); }
+	inline from_chars_result from_chars(const char* first, const char* last, long& value, int base = 10)
+		{ return Internal::FromCharsInteger<long, unsigned long>(first, last, value, base, true); }
+	inline from_chars_result from_chars(const char* first, const char* last, unsigned long& value, int base = 10)
+		{ return Internal::FromCharsInteger<unsigned long, unsigned long>(first, last, value, base, false); }
+	inline from_chars_result from_chars(const char* first, const char* last, long long& value, int base = 10)
+		{ return Internal::FromCharsInteger<long long, unsigned long long>(first, last, value, base, true); }
+	inline from_chars_result from_chars(const char* first, const char* last, unsigned long long& value, int base = 10)
+		{ return Internal::FromCharsInteger<unsigned long long, unsigned long long>(first, last, value, base, false); }
+
+
+	/// from_chars
+	///
+	/// Floating point overloads. Parses an optional '-' followed by a decimal
+	/// number (with or without exponent, as allowed by fmt), a hex number without
+	/// "0x" if fmt is chars_format::hex, or inf/infinity/nan. The result is
+	/// correctly rounded. Values that overflow or underflow to zero report
+	/// errc::result_out_of_range and leave value unmodified.
+	///
+	inline from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt = chars_format::general)
+		{ return Internal::FromCharsFloat(first, last, value, fmt); }
+
+	inline from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt = chars_format::general)
+		{ return Internal::FromCharsFloat(first, last, value, fmt); }
+
+	inline from_chars_result from_chars(const char* first, const char* last, long double& value, chars_format fmt = chars_format::general)
+	{
+		double d = 0;
+		const from_chars_result result = Internal::FromCharsFloat(first, last, d, fmt);
+		if(result.ec == errc())
+			value = d;
+		return result;
+	}
+
+} // namespace std
+
+
+#endif // Header include guard
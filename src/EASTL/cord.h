@@ -0,0 +1,780 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// basic_cord is a rope-like string made of a chain of fixed-size chunks.
+//
+// It is intended for building large outgoing payloads (log records,
+// telemetry frames) from many small fragments. Unlike basic_string, growing
+// a cord never reallocates or copies what has already been written: append
+// fills the free space in the last chunk and then links in new chunks.
+//
+// Chunks are reference counted, so copying a cord or taking a substr of it
+// shares the underlying characters instead of copying them. A cord only ever
+// writes past the high-water mark of a chunk, which is why sharing chunks
+// between cords is safe without copy-on-write.
+//
+// The contents are exposed as a sequence of contiguous pieces (chunks),
+// which can be handed one by one to a scatter-style sink such as
+// basic_streambuf::sputn. flatten() produces a contiguous basic_string
+// for code that really needs one.
+//
+// Example usage:
+//     cord frame;
+//     frame += "{\"id\":";
+//     frame += idString;
+//     frame.append(payload, payloadSize);
+//
+//     frame.write_to(serialBuf);                // One sputn per chunk, no copy.
+//     cord header = frame.substr(0, 16);        // Shares chunks with frame.
+//     string text = frame.flatten();            // Single allocation and copy.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_CORD_H
+#define EASTL_CORD_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/iterator.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+#include <string.h>
+
+namespace std
+{
+	/// EASTL_CORD_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_CORD_DEFAULT_NAME
+		#define EASTL_CORD_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " cord" // Unless the user overrides something, this is "EASTL cord".
+	#endif
+
+
+	/// EASTL_CORD_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_CORD_DEFAULT_ALLOCATOR
+		#define EASTL_CORD_DEFAULT_ALLOCATOR allocator_type(EASTL_CORD_DEFAULT_NAME)
+	#endif
+
+
+	/// EASTL_CORD_DEFAULT_CHUNK_SIZE
+	///
+	/// Number of characters per chunk. Larger chunks mean fewer allocations
+	/// and fewer pieces to write out; smaller chunks waste less on the tail.
+	///
+	#ifndef EASTL_CORD_DEFAULT_CHUNK_SIZE
+		#define EASTL_CORD_DEFAULT_CHUNK_SIZE 64
+	#endif
+
+
+
+	/// basic_cord
+	///
+	template <typename T, size_t ChunkSize = EASTL_CORD_DEFAULT_CHUNK_SIZE, typename Allocator = EASTLAllocatorType>
+	class basic_cord
+	{
+	public:
+		typedef basic_cord<T, ChunkSize, Allocator> this_type;
+		typedef basic_string_view<T>                view_type;
+		typedef basic_string<T, Allocator>          string_type;
+		typedef T                                   value_type;
+		typedef eastl_size_t                        size_type;
+		typedef ptrdiff_t                           difference_type;
+		typedef Allocator                           allocator_type;
+
+		static const size_type npos       = (size_type)-1;
+		static const size_type kChunkSize = ChunkSize;
+
+	protected:
+		struct Chunk
+		{
+			size_type  mnRefCount; // Number of segments (in any cord) that refer to this chunk.
+			size_type  mnSize;     // High-water mark; characters at or above it have never been written.
+			value_type mData[ChunkSize];
+		};
+
+		struct Segment
+		{
+			Chunk*    mpChunk;
+			size_type mnBegin;
+			size_type mnEnd;
+		};
+
+		typedef std::vector<Segment, Allocator> SegmentArray;
+
+	public:
+		/// const_chunk_iterator
+		///
+		/// Iterates the cord as a sequence of contiguous view_type pieces.
+		///
+		class const_chunk_iterator
+		{
+		public:
+			typedef view_type                                  value_type;
+			typedef const view_type*                           pointer;
+			typedef view_type                                  reference;
+			typedef ptrdiff_t                                  difference_type;
+			typedef EASTL_ITC_NS::forward_iterator_tag         iterator_category;
+
+			const_chunk_iterator() : mpSegment(NULL) {}
+			explicit const_chunk_iterator(const Segment* pSegment) : mpSegment(pSegment) {}
+
+			view_type operator*() const
+				{ return view_type(mpSegment->mpChunk->mData + mpSegment->mnBegin, mpSegment->mnEnd - mpSegment->mnBegin); }
+
+			const_chunk_iterator& operator++()    { ++mpSegment; return *this; }
+			const_chunk_iterator  operator++(int) { const_chunk_iterator temp(*this); ++mpSegment; return temp; }
+
+			bool operator==(const const_chunk_iterator& x) const { return mpSegment == x.mpSegment; }
+			bool operator!=(const const_chunk_iterator& x) const { return mpSegment != x.mpSegment; }
+
+		protected:
+			const Segment* mpSegment;
+		};
+
+	public:
+		explicit basic_cord(const allocator_type& allocator = EASTL_CORD_DEFAULT_ALLOCATOR);
+		basic_cord(const value_type* p, const allocator_type& allocator = EASTL_CORD_DEFAULT_ALLOCATOR);
+		basic_cord(view_type v, const allocator_type& allocator = EASTL_CORD_DEFAULT_ALLOCATOR);
+		basic_cord(const this_type& x);
+		basic_cord(this_type&& x) EA_NOEXCEPT;
+	   ~basic_cord();
+
+		this_type& operator=(const this_type& x);
+		this_type& operator=(this_type&& x) EA_NOEXCEPT;
+		this_type& operator=(view_type v);
+
+		void swap(this_type& x) EA_NOEXCEPT;
+
+		// Size
+		size_type size() const EA_NOEXCEPT   { return mnSize; }
+		size_type length() const EA_NOEXCEPT { return mnSize; }
+		bool      empty() const EA_NOEXCEPT  { return mnSize == 0; }
+
+		// Appending. All of these are O(n) in the appended length only. If a chunk
+		// can't be allocated, the cord is left as it was before the call.
+		this_type& append(const value_type* p, size_type n);
+		this_type& append(const value_type* p);
+		this_type& append(view_type v)                   { return append(v.data(), (size_type)v.size()); }
+		this_type& append(const string_type& s)          { return append(s.data(), (size_type)s.size()); }
+		this_type& append(size_type n, value_type c);
+		this_type& append(const this_type& x);           // Shares x's chunks; copies no characters.
+		void       push_back(value_type c);
+
+		this_type& operator+=(const value_type* p)       { return append(p); }
+		this_type& operator+=(view_type v)               { return append(v); }
+		this_type& operator+=(const string_type& s)      { return append(s); }
+		this_type& operator+=(const this_type& x)        { return append(x); }
+		this_type& operator+=(value_type c)              { push_back(c); return *this; }
+
+		// Element access. These walk the chunk list and so are O(chunk count).
+		value_type operator[](size_type n) const;
+		value_type front() const;
+		value_type back() const;
+
+		// Substrings share chunks with this cord.
+		this_type substr(size_type position = 0, size_type n = npos) const;
+
+		// Conversion to contiguous storage.
+		string_type flatten() const;
+		void        flatten(string_type& s) const; // Appends to s, reserving the final size once.
+		size_type   copy(value_type* p, size_type n, size_type position = 0) const;
+
+		// Chunk access.
+		size_type            chunk_count() const EA_NOEXCEPT { return (size_type)mSegments.size(); }
+		const_chunk_iterator chunk_begin() const EA_NOEXCEPT { return const_chunk_iterator(mSegments.data()); }
+		const_chunk_iterator chunk_end() const EA_NOEXCEPT   { return const_chunk_iterator(mSegments.data() + mSegments.size()); }
+
+		template <typename Function>
+		void for_each_chunk(Function function) const;
+
+		// Writes each chunk with one sputn call. Works with basic_streambuf and
+		// with anything else that provides sputn(const value_type*, n).
+		template <typename Streambuf>
+		size_type write_to(Streambuf& streambuf) const;
+
+		void clear() EA_NOEXCEPT;
+
+		allocator_type&       get_allocator() EA_NOEXCEPT       { return mAllocator; }
+		const allocator_type& get_allocator() const EA_NOEXCEPT { return mAllocator; }
+
+		bool validate() const EA_NOEXCEPT;
+
+	protected:
+		Chunk* DoAllocateChunk();
+		void   DoAddRef(Chunk* pChunk) EA_NOEXCEPT { ++pChunk->mnRefCount; }
+		void   DoRelease(Chunk* pChunk) EA_NOEXCEPT;
+		void   DoReleaseAll() EA_NOEXCEPT;
+		size_type DoReserveTail(size_type n, value_type*& pDest);
+		void      DoTruncateTail(size_type nSegments, size_type nSize) EA_NOEXCEPT;
+		const Segment* DoFindSegment(size_type& position) const EA_NOEXCEPT;
+
+	protected:
+		SegmentArray   mSegments;
+		size_type      mnSize;
+		allocator_type mAllocator;
+	};
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// basic_cord
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	const typename basic_cord<T, ChunkSize, Allocator>::size_type basic_cord<T, ChunkSize, Allocator>::npos;
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	const typename basic_cord<T, ChunkSize, Allocator>::size_type basic_cord<T, ChunkSize, Allocator>::kChunkSize;
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline basic_cord<T, ChunkSize, Allocator>::basic_cord(const allocator_type& allocator)
+		: mSegments(allocator)
+		, mnSize(0)
+		, mAllocator(allocator)
+	{
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline basic_cord<T, ChunkSize, Allocator>::basic_cord(const value_type* p, const allocator_type& allocator)
+		: mSegments(allocator)
+		, mnSize(0)
+		, mAllocator(allocator)
+	{
+		append(p);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline basic_cord<T, ChunkSize, Allocator>::basic_cord(view_type v, const allocator_type& allocator)
+		: mSegments(allocator)
+		, mnSize(0)
+		, mAllocator(allocator)
+	{
+		append(v);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline basic_cord<T, ChunkSize, Allocator>::basic_cord(const this_type& x)
+		: mSegments(x.mSegments)
+		, mnSize(x.mnSize)
+		, mAllocator(x.mAllocator)
+	{
+		for(typename SegmentArray::iterator it = mSegments.begin(); it != mSegments.end(); ++it)
+			DoAddRef(it->mpChunk);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline basic_cord<T, ChunkSize, Allocator>::basic_cord(this_type&& x) EA_NOEXCEPT
+		: mSegments(std::move(x.mSegments))
+		, mnSize(x.mnSize)
+		, mAllocator(x.mAllocator)
+	{
+		x.mSegments.clear();
+		x.mnSize = 0;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline basic_cord<T, ChunkSize, Allocator>::~basic_cord()
+	{
+		DoReleaseAll();
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::operator=(const this_type& x)
+	{
+		if(&x != this)
+		{
+			this_type temp(x);
+			swap(temp);
+		}
+		return *this;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::operator=(this_type&& x) EA_NOEXCEPT
+	{
+		swap(x);
+		return *this;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::operator=(view_type v)
+	{
+		clear();
+		return append(v);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline void basic_cord<T, ChunkSize, Allocator>::swap(this_type& x) EA_NOEXCEPT
+	{
+		mSegments.swap(x.mSegments);
+		std::swap(mnSize, x.mnSize);
+		std::swap(mAllocator, x.mAllocator);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::Chunk*
+	basic_cord<T, ChunkSize, Allocator>::DoAllocateChunk()
+	{
+		Chunk* const pChunk = (Chunk*)allocate_memory(mAllocator, sizeof(Chunk), EASTL_ALIGN_OF(Chunk), 0);
+
+		if(pChunk)
+		{
+			pChunk->mnRefCount = 1;
+			pChunk->mnSize     = 0;
+		}
+		return pChunk;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline void basic_cord<T, ChunkSize, Allocator>::DoRelease(Chunk* pChunk) EA_NOEXCEPT
+	{
+		if(--pChunk->mnRefCount == 0)
+			EASTLFree(mAllocator, pChunk, sizeof(Chunk));
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline void basic_cord<T, ChunkSize, Allocator>::DoReleaseAll() EA_NOEXCEPT
+	{
+		for(typename SegmentArray::iterator it = mSegments.begin(); it != mSegments.end(); ++it)
+			DoRelease(it->mpChunk);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::size_type
+	basic_cord<T, ChunkSize, Allocator>::DoReserveTail(size_type n, value_type*& pDest)
+	{
+		// Returns how many of the n characters can be written contiguously at pDest,
+		// and accounts for them in the cord. The last segment is only extended if it
+		// ends at its chunk's high-water mark; otherwise another cord sharing the chunk
+		// owns the free space and a new chunk is started. Returns 0 if that fails.
+		Segment* pSegment = mSegments.empty() ? NULL : &mSegments.back();
+
+		if(!pSegment || (pSegment->mnEnd != pSegment->mpChunk->mnSize) || (pSegment->mnEnd == kChunkSize))
+		{
+			Segment segment = { DoAllocateChunk(), 0, 0 };
+
+			if(!segment.mpChunk)
+				return 0;
+			mSegments.push_back(segment);
+			pSegment = &mSegments.back();
+		}
+
+		Chunk* const    pChunk = pSegment->mpChunk;
+		const size_type nSpace = kChunkSize - pChunk->mnSize;
+		const size_type nCount = (n < nSpace) ? n : nSpace;
+
+		pDest = pChunk->mData + pChunk->mnSize;
+		pChunk->mnSize   += nCount;
+		pSegment->mnEnd  += nCount;
+		mnSize           += nCount;
+
+		return nCount;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	void basic_cord<T, ChunkSize, Allocator>::DoTruncateTail(size_type nSegments, size_type nSize) EA_NOEXCEPT
+	{
+		// Undoes the DoReserveTail calls made since the cord had nSegments segments
+		// and nSize characters. The old last segment owned its chunk's free space,
+		// so giving back what it gained also lowers the chunk's high-water mark.
+		while(mSegments.size() > nSegments)
+		{
+			mnSize -= mSegments.back().mnEnd - mSegments.back().mnBegin;
+			DoRelease(mSegments.back().mpChunk);
+			mSegments.pop_back();
+		}
+
+		if(mnSize != nSize)
+		{
+			Segment& segment = mSegments.back();
+
+			segment.mpChunk->mnSize -= (mnSize - nSize);
+			segment.mnEnd           -= (mnSize - nSize);
+			mnSize = nSize;
+		}
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::append(const value_type* p, size_type n)
+	{
+		const size_type nSegments = (size_type)mSegments.size();
+		const size_type nSize     = mnSize;
+
+		while(n)
+		{
+			value_type*     pDest;
+			const size_type nCount = DoReserveTail(n, pDest);
+
+			if(nCount == 0)
+			{
+				DoTruncateTail(nSegments, nSize);
+				break;
+			}
+
+			memcpy(pDest, p, nCount * sizeof(value_type));
+			p += nCount;
+			n -= nCount;
+		}
+		return *this;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::append(const value_type* p)
+	{
+		return append(p, (size_type)CharStrlen(p));
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::append(size_type n, value_type c)
+	{
+		const size_type nSegments = (size_type)mSegments.size();
+		const size_type nSize     = mnSize;
+
+		while(n)
+		{
+			value_type*     pDest;
+			const size_type nCount = DoReserveTail(n, pDest);
+
+			if(nCount == 0)
+			{
+				DoTruncateTail(nSegments, nSize);
+				break;
+			}
+
+			for(size_type i = 0; i < nCount; ++i)
+				pDest[i] = c;
+			n -= nCount;
+		}
+		return *this;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::this_type&
+	basic_cord<T, ChunkSize, Allocator>::append(const this_type& x)
+	{
+		if(&x == this)
+		{
+			const this_type temp(x);
+			return append(temp);
+		}
+
+		mSegments.reserve(mSegments.size() + x.mSegments.size());
+
+		for(typename SegmentArray::const_iterator it = x.mSegments.begin(); it != x.mSegments.end(); ++it)
+		{
+			DoAddRef(it->mpChunk);
+			mSegments.push_back(*it);
+		}
+
+		mnSize += x.mnSize;
+		return *this;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline void basic_cord<T, ChunkSize, Allocator>::push_back(value_type c)
+	{
+		value_type* pDest;
+
+		if(DoReserveTail(1, pDest))
+			*pDest = c;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	const typename basic_cord<T, ChunkSize, Allocator>::Segment*
+	basic_cord<T, ChunkSize, Allocator>::DoFindSegment(size_type& position) const EA_NOEXCEPT
+	{
+		// Returns the segment containing position and converts position to an offset within it.
+		const Segment* pSegment = mSegments.data();
+
+		while(position >= (pSegment->mnEnd - pSegment->mnBegin))
+		{
+			position -= (pSegment->mnEnd - pSegment->mnBegin);
+			++pSegment;
+		}
+
+		return pSegment;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::value_type
+	basic_cord<T, ChunkSize, Allocator>::operator[](size_type n) const
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(n >= mnSize))
+				EASTL_FAIL_MSG("basic_cord::operator[] -- out of range");
+		#endif
+
+		const Segment* const pSegment = DoFindSegment(n);
+		return pSegment->mpChunk->mData[pSegment->mnBegin + n];
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::value_type
+	basic_cord<T, ChunkSize, Allocator>::front() const
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0))
+				EASTL_FAIL_MSG("basic_cord::front -- empty cord");
+		#endif
+
+		const Segment& segment = mSegments.front();
+		return segment.mpChunk->mData[segment.mnBegin];
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::value_type
+	basic_cord<T, ChunkSize, Allocator>::back() const
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0))
+				EASTL_FAIL_MSG("basic_cord::back -- empty cord");
+		#endif
+
+		const Segment& segment = mSegments.back();
+		return segment.mpChunk->mData[segment.mnEnd - 1];
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::this_type
+	basic_cord<T, ChunkSize, Allocator>::substr(size_type position, size_type n) const
+	{
+		this_type result(mAllocator);
+
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(position > mnSize))
+				EASTL_FAIL_MSG("basic_cord::substr -- invalid position");
+		#endif
+
+		if(position > mnSize)
+			position = mnSize;
+
+		if(n > (mnSize - position))
+			n = mnSize - position;
+
+		if(n)
+		{
+			const Segment* pSegment = DoFindSegment(position);
+
+			while(n)
+			{
+				const size_type nAvailable = (pSegment->mnEnd - pSegment->mnBegin) - position;
+				const size_type nCount     = (n < nAvailable) ? n : nAvailable;
+				const Segment   segment    = { pSegment->mpChunk, pSegment->mnBegin + position, pSegment->mnBegin + position + nCount };
+
+				result.DoAddRef(segment.mpChunk);
+				result.mSegments.push_back(segment);
+				result.mnSize += nCount;
+
+				n -= nCount;
+				position = 0;
+				++pSegment;
+			}
+		}
+
+		return result;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline typename basic_cord<T, ChunkSize, Allocator>::string_type
+	basic_cord<T, ChunkSize, Allocator>::flatten() const
+	{
+		string_type s(mAllocator);
+		flatten(s);
+		return s;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	void basic_cord<T, ChunkSize, Allocator>::flatten(string_type& s) const
+	{
+		s.reserve(s.size() + mnSize);
+
+		for(typename SegmentArray::const_iterator it = mSegments.begin(); it != mSegments.end(); ++it)
+			s.append(it->mpChunk->mData + it->mnBegin, it->mnEnd - it->mnBegin);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	typename basic_cord<T, ChunkSize, Allocator>::size_type
+	basic_cord<T, ChunkSize, Allocator>::copy(value_type* p, size_type n, size_type position) const
+	{
+		if((position >= mnSize) || (n == 0))
+			return 0;
+
+		if(n > (mnSize - position))
+			n = mnSize - position;
+
+		const size_type nResult  = n;
+		const Segment*  pSegment = DoFindSegment(position);
+
+		while(n)
+		{
+			const size_type nAvailable = (pSegment->mnEnd - pSegment->mnBegin) - position;
+			const size_type nCount     = (n < nAvailable) ? n : nAvailable;
+
+			memcpy(p, pSegment->mpChunk->mData + pSegment->mnBegin + position, nCount * sizeof(value_type));
+			p += nCount;
+			n -= nCount;
+			position = 0;
+			++pSegment;
+		}
+
+		return nResult;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	template <typename Function>
+	inline void basic_cord<T, ChunkSize, Allocator>::for_each_chunk(Function function) const
+	{
+		for(const_chunk_iterator it = chunk_begin(), itEnd = chunk_end(); it != itEnd; ++it)
+			function(*it);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	template <typename Streambuf>
+	typename basic_cord<T, ChunkSize, Allocator>::size_type
+	basic_cord<T, ChunkSize, Allocator>::write_to(Streambuf& streambuf) const
+	{
+		size_type nWritten = 0;
+
+		for(typename SegmentArray::const_iterator it = mSegments.begin(); it != mSegments.end(); ++it)
+		{
+			const size_type n      = it->mnEnd - it->mnBegin;
+			const size_type nCount = (size_type)streambuf.sputn(it->mpChunk->mData + it->mnBegin, n);
+
+			nWritten += nCount;
+			if(nCount != n)
+				break;
+		}
+
+		return nWritten;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline void basic_cord<T, ChunkSize, Allocator>::clear() EA_NOEXCEPT
+	{
+		DoReleaseAll();
+		mSegments.clear();
+		mnSize = 0;
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	bool basic_cord<T, ChunkSize, Allocator>::validate() const EA_NOEXCEPT
+	{
+		size_type nSize = 0;
+
+		for(typename SegmentArray::const_iterator it = mSegments.begin(); it != mSegments.end(); ++it)
+		{
+			if((it->mnBegin >= it->mnEnd) || (it->mnEnd > it->mpChunk->mnSize) || (it->mpChunk->mnSize > kChunkSize) || (it->mpChunk->mnRefCount == 0))
+				return false;
+			nSize += (it->mnEnd - it->mnBegin);
+		}
+
+		return nSize == mnSize;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline void swap(basic_cord<T, ChunkSize, Allocator>& a, basic_cord<T, ChunkSize, Allocator>& b) EA_NOEXCEPT
+	{
+		a.swap(b);
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	bool operator==(const basic_cord<T, ChunkSize, Allocator>& a, const basic_cord<T, ChunkSize, Allocator>& b)
+	{
+		if(a.size() != b.size())
+			return false;
+
+		typedef typename basic_cord<T, ChunkSize, Allocator>::const_chunk_iterator const_chunk_iterator;
+		typedef typename basic_cord<T, ChunkSize, Allocator>::view_type            view_type;
+
+		const_chunk_iterator ia = a.chunk_begin(), ib = b.chunk_begin();
+		view_type            va, vb;
+
+		for(;;)
+		{
+			if(va.empty())
+			{
+				if(ia == a.chunk_end())
+					return true;
+				va = *ia++;
+			}
+			if(vb.empty())
+				vb = *ib++;
+
+			const size_t n = (va.size() < vb.size()) ? va.size() : vb.size();
+
+			if(memcmp(va.data(), vb.data(), n * sizeof(T)) != 0)
+				return false;
+
+			va.remove_prefix(n);
+			vb.remove_prefix(n);
+		}
+	}
+
+
+	template <typename T, size_t ChunkSize, typename Allocator>
+	inline bool operator!=(const basic_cord<T, ChunkSize, Allocator>& a, const basic_cord<T, ChunkSize, Allocator>& b)
+	{
+		return !(a == b);
+	}
+
+
+	/// cord
+	///
+	typedef basic_cord<char> cord;
+
+} // namespace std
+
+#endif // Header include guard
@@ -0,0 +1,1158 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the execution policies of the C++17 <execution> header
+// (seq, par, par_unseq and unseq) and the policy overloads of these
+// algorithms:
+//     sort, stable_sort, for_each, transform, reduce, transform_reduce,
+//     inclusive_scan, copy, fill, find, count, minmax_element
+//
+// par and par_unseq split a random access range into chunks and run them on a
+// pool of worker threads. Each thread owns a deque of tasks; it takes its own
+// newest task first and, when out of work, steals the oldest task of another
+// thread. A thread that waits for its chunks runs queued tasks meanwhile, so
+// nested parallel calls (the merges of sort) can't starve the pool.
+//
+// The pool needs POSIX threads, so it exists only on hosts (such as a desktop
+// simulator of a sketch). Elsewhere, including all Arduino boards, and for
+// seq, unseq and ranges that aren't random access, the overloads call the
+// sequential algorithms directly, so a policy costs nothing there. Ranges
+// shorter than EASTL_EXECUTION_MIN_CHUNK elements also run sequentially.
+//
+// As in the standard, the element access functions must not race with each
+// other, and reduce, transform_reduce and inclusive_scan assume their
+// operations are associative (and, for the reductions, commutative).
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_EXECUTION_H
+#define EASTL_EXECUTION_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/utility.h>
+#include <EASTL/functional.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/numeric.h>
+#include <EASTL/sort.h>
+#include <EASTL/allocator.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_EXECUTION_THREADS_ENABLED
+//
+// Defined as 0 or 1. Enables the thread pool behind par and par_unseq. It
+// uses pthreads and the GCC/Clang __atomic builtins, and needs -pthread.
+//
+#ifndef EASTL_EXECUTION_THREADS_ENABLED
+	#if defined(EA_PLATFORM_POSIX) && (defined(EA_COMPILER_GNUC) || defined(__clang__)) && !defined(__AVR__)
+		#define EASTL_EXECUTION_THREADS_ENABLED 1
+	#else
+		#define EASTL_EXECUTION_THREADS_ENABLED 0
+	#endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_EXECUTION_THREAD_COUNT
+//
+// The number of threads a parallel algorithm runs on, the calling thread
+// included. 0 means one per online processor.
+//
+#ifndef EASTL_EXECUTION_THREAD_COUNT
+	#define EASTL_EXECUTION_THREAD_COUNT 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_EXECUTION_MIN_CHUNK
+//
+// The fewest elements worth handing to another thread. Ranges shorter than
+// twice this run sequentially.
+//
+#ifndef EASTL_EXECUTION_MIN_CHUNK
+	#define EASTL_EXECUTION_MIN_CHUNK 4096
+#endif
+
+#if EASTL_EXECUTION_THREADS_ENABLED
+	#include <pthread.h>
+	#include <sched.h>
+	#include <unistd.h>
+	#include <new>
+#endif
+
+
+
+namespace std
+{
+	namespace execution
+	{
+		/// sequenced_policy / parallel_policy / parallel_unsequenced_policy / unsequenced_policy
+		///
+		/// http://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+		///
+		class sequenced_policy            { public: EA_CONSTEXPR sequenced_policy() {} };
+		class parallel_policy             { public: EA_CONSTEXPR parallel_policy() {} };
+		class parallel_unsequenced_policy { public: EA_CONSTEXPR parallel_unsequenced_policy() {} };
+		class unsequenced_policy          { public: EA_CONSTEXPR unsequenced_policy() {} };
+
+		EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR sequenced_policy            seq{};
+		EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR parallel_policy             par{};
+		EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR parallel_unsequenced_policy par_unseq{};
+		EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR unsequenced_policy          unseq{};
+	}
+
+
+	/// is_execution_policy
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/is_execution_policy
+	///
+	template <typename T> struct is_execution_policy                                         : public false_type {};
+	template <>           struct is_execution_policy<execution::sequenced_policy>            : public true_type  {};
+	template <>           struct is_execution_policy<execution::parallel_policy>             : public true_type  {};
+	template <>           struct is_execution_policy<execution::parallel_unsequenced_policy> : public true_type  {};
+	template <>           struct is_execution_policy<execution::unsequenced_policy>          : public true_type  {};
+
+	#if EASTL_VARIABLE_TEMPLATES_ENABLED
+		template <typename T>
+		EA_CONSTEXPR bool is_execution_policy_v = is_execution_policy<T>::value;
+	#endif
+
+
+
+	namespace Internal
+	{
+		// The return type R of a policy overload, or no overload when ExecutionPolicy isn't a policy.
+		template <typename ExecutionPolicy, typename R>
+		using execution_enable_t = typename enable_if<is_execution_policy<typename decay<ExecutionPolicy>::type>::value, R>::type;
+
+
+		/// is_parallel_execution
+		///
+		/// True when ExecutionPolicy asks for threads, threads exist and the
+		/// iterators are random access, so execution_imp<true> can chunk them.
+		///
+		template <typename ExecutionPolicy, typename Iterator1, typename Iterator2 = Iterator1>
+		struct is_parallel_execution
+		{
+			typedef typename decay<ExecutionPolicy>::type policy_type;
+
+			static const bool value = EASTL_EXECUTION_THREADS_ENABLED &&
+			                          (is_same<policy_type, execution::parallel_policy>::value || is_same<policy_type, execution::parallel_unsequenced_policy>::value) &&
+			                          is_base_of<EASTL_ITC_NS::random_access_iterator_tag, typename iterator_traits<Iterator1>::iterator_category>::value &&
+			                          is_base_of<EASTL_ITC_NS::random_access_iterator_tag, typename iterator_traits<Iterator2>::iterator_category>::value;
+		};
+
+
+		/// execution_imp
+		///
+		/// The policy overloads dispatch here. execution_imp<false> is the
+		/// sequential algorithms; execution_imp<true> chunks the range over the
+		/// thread pool when is_parallel_execution holds.
+		///
+		template <bool bParallel>
+		struct execution_imp
+		{
+			template <typename RandomAccessIterator, typename Compare>
+			static void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+				{ std::sort(first, last, compare); }
+
+			template <typename RandomAccessIterator, typename Compare>
+			static void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+				{ std::stable_sort(first, last, compare); }
+
+			template <typename ForwardIterator, typename Function>
+			static void for_each(ForwardIterator first, ForwardIterator last, Function function)
+				{ std::for_each(first, last, function); }
+
+			template <typename ForwardIterator1, typename ForwardIterator2, typename UnaryOperation>
+			static ForwardIterator2 transform(ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, UnaryOperation op)
+				{ return std::transform(first, last, result, op); }
+
+			template <typename ForwardIterator1, typename ForwardIterator2, typename ForwardIterator3, typename BinaryOperation>
+			static ForwardIterator3 transform(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator3 result, BinaryOperation op)
+				{ return std::transform(first1, last1, first2, result, op); }
+
+			template <typename ForwardIterator, typename T, typename BinaryOperation>
+			static T reduce(ForwardIterator first, ForwardIterator last, T init, BinaryOperation op)
+				{ return std::reduce(first, last, init, op); }
+
+			template <typename ForwardIterator1, typename ForwardIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+			static T transform_reduce(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, T init, BinaryOperation1 reduce, BinaryOperation2 transform)
+				{ return std::transform_reduce(first1, last1, first2, init, reduce, transform); }
+
+			template <typename ForwardIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+			static T transform_reduce(ForwardIterator first, ForwardIterator last, T init, BinaryOperation reduce, UnaryOperation transform)
+				{ return std::transform_reduce(first, last, init, reduce, transform); }
+
+			template <typename ForwardIterator1, typename ForwardIterator2, typename BinaryOperation>
+			static ForwardIterator2 inclusive_scan(ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, BinaryOperation op)
+				{ return std::inclusive_scan(first, last, result, op); }
+
+			template <typename ForwardIterator1, typename ForwardIterator2, typename BinaryOperation, typename T>
+			static ForwardIterator2 inclusive_scan(ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, BinaryOperation op, T init)
+				{ return std::inclusive_scan(first, last, result, op, init); }
+
+			template <typename ForwardIterator1, typename ForwardIterator2>
+			static ForwardIterator2 copy(ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result)
+				{ return std::copy(first, last, result); }
+
+			template <typename ForwardIterator, typename T>
+			static void fill(ForwardIterator first, ForwardIterator last, const T& value)
+				{ std::fill(first, last, value); }
+
+			template <typename ForwardIterator, typename T>
+			static ForwardIterator find(ForwardIterator first, ForwardIterator last, const T& value)
+				{ return std::find(first, last, value); }
+
+			template <typename ForwardIterator, typename T>
+			static typename iterator_traits<ForwardIterator>::difference_type count(ForwardIterator first, ForwardIterator last, const T& value)
+				{ return std::count(first, last, value); }
+
+			template <typename ForwardIterator, typename Compare>
+			static pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last, Compare compare)
+				{ return std::minmax_element(first, last, compare); }
+
+			template <typename ForwardIterator>
+			static pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last)
+				{ return std::minmax_element(first, last); }
+		};
+
+
+		#if EASTL_EXECUTION_THREADS_ENABLED
+			class execution_task_group
+			{
+			public:
+				explicit execution_task_group(size_t nPending) : mnPending(nPending) {}
+
+				size_t mnPending; // Tasks of the group not yet finished.
+			};
+
+			struct execution_task
+			{
+				void                (*mpFunction)(void* pContext, size_t nIndex);
+				void*                 mpContext;
+				size_t                mnIndex;
+				execution_task_group* mpGroup;
+			};
+
+
+			/// execution_thread_pool
+			///
+			/// The worker threads, created on first use and joined at exit. Thread
+			/// 0 is whichever thread calls a parallel algorithm; the workers are
+			/// 1 to concurrency() - 1. Each has a fixed size deque behind a mutex.
+			///
+			class execution_thread_pool
+			{
+			public:
+				static const size_t kQueueCapacity = 1024; // Per thread. Tasks that don't fit run on the thread that made them.
+
+				static execution_thread_pool& get()
+				{
+					static execution_thread_pool sPool;
+					return sPool;
+				}
+
+				size_t concurrency() const
+					{ return mnThreadCount; }
+
+				bool push(const execution_task& task)
+				{
+					queue& q = mpQueues[this_thread_index()];
+
+					pthread_mutex_lock(&q.mMutex);
+					const bool bRoom = (q.mnBack - q.mnFront) < kQueueCapacity;
+					if(bRoom)
+						q.mTasks[q.mnBack++ % kQueueCapacity] = task;
+					pthread_mutex_unlock(&q.mMutex);
+
+					if(bRoom)
+					{
+						pthread_mutex_lock(&mMutex);
+						__atomic_add_fetch(&mnQueued, 1, __ATOMIC_RELEASE);
+						pthread_cond_signal(&mCondition);
+						pthread_mutex_unlock(&mMutex);
+					}
+					return bRoom;
+				}
+
+				// Returns once every task of group has run, running tasks meanwhile.
+				void wait(execution_task_group& group)
+				{
+					execution_task task;
+
+					while(__atomic_load_n(&group.mnPending, __ATOMIC_ACQUIRE))
+					{
+						if(take(task))
+							run(task);
+						else
+							sched_yield();
+					}
+				}
+
+			private:
+				struct queue
+				{
+					pthread_mutex_t mMutex;
+					size_t          mnFront;
+					size_t          mnBack;
+					execution_task  mTasks[kQueueCapacity];
+				};
+
+				execution_thread_pool()
+					: mnThreadCount(EASTL_EXECUTION_THREAD_COUNT), mnNextIndex(0), mnQueued(0), mbStop(false), mpQueues(NULL), mpThreads(NULL)
+				{
+					if(mnThreadCount == 0)
+					{
+						const long nProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+						mnThreadCount = (nProcessors > 0) ? size_t(nProcessors) : 1;
+					}
+
+					pthread_mutex_init(&mMutex, NULL);
+					pthread_cond_init(&mCondition, NULL);
+
+					mpQueues = new queue[mnThreadCount];
+					for(size_t i = 0; i < mnThreadCount; ++i)
+					{
+						pthread_mutex_init(&mpQueues[i].mMutex, NULL);
+						mpQueues[i].mnFront = mpQueues[i].mnBack = 0;
+					}
+
+					mpThreads = new pthread_t[mnThreadCount];
+					for(size_t i = 1; i < mnThreadCount; ++i)
+					{
+						if(pthread_create(&mpThreads[i], NULL, &execution_thread_pool::worker_main, this) != 0)
+						{
+							mnThreadCount = i; // Run with the threads we got.
+							break;
+						}
+					}
+				}
+
+				~execution_thread_pool()
+				{
+					pthread_mutex_lock(&mMutex);
+					mbStop = true;
+					pthread_cond_broadcast(&mCondition);
+					pthread_mutex_unlock(&mMutex);
+
+					for(size_t i = 1; i < mnThreadCount; ++i)
+						pthread_join(mpThreads[i], NULL);
+
+					for(size_t i = 0; i < mnThreadCount; ++i)
+						pthread_mutex_destroy(&mpQueues[i].mMutex);
+					pthread_cond_destroy(&mCondition);
+					pthread_mutex_destroy(&mMutex);
+
+					delete[] mpThreads;
+					delete[] mpQueues;
+				}
+
+				execution_thread_pool(const execution_thread_pool&);
+				void operator=(const execution_thread_pool&);
+
+				static size_t& this_thread_index()
+				{
+					static __thread size_t sIndex = 0;
+					return sIndex;
+				}
+
+				static void* worker_main(void* pContext)
+				{
+					execution_thread_pool* const pPool = static_cast<execution_thread_pool*>(pContext);
+					execution_task               task;
+
+					this_thread_index() = __atomic_add_fetch(&pPool->mnNextIndex, 1, __ATOMIC_RELAXED);
+
+					for(;;)
+					{
+						if(pPool->take(task))
+						{
+							pPool->run(task);
+							continue;
+						}
+
+						pthread_mutex_lock(&pPool->mMutex);
+						while(!__atomic_load_n(&pPool->mnQueued, __ATOMIC_ACQUIRE) && !pPool->mbStop)
+							pthread_cond_wait(&pPool->mCondition, &pPool->mMutex);
+						const bool bStop = pPool->mbStop;
+						pthread_mutex_unlock(&pPool->mMutex);
+
+						if(bStop)
+							return NULL;
+					}
+				}
+
+				// The newest task of this thread, else the oldest of another.
+				bool take(execution_task& task)
+				{
+					const size_t nSelf = this_thread_index();
+
+					for(size_t i = 0; i < mnThreadCount; ++i)
+					{
+						queue&     q      = mpQueues[(nSelf + i) % mnThreadCount];
+						const bool bOwner = (i == 0);
+						bool       bTaken = false;
+
+						pthread_mutex_lock(&q.mMutex);
+						if(q.mnFront != q.mnBack)
+						{
+							task   = bOwner ? q.mTasks[--q.mnBack % kQueueCapacity] : q.mTasks[q.mnFront++ % kQueueCapacity];
+							bTaken = true;
+						}
+						pthread_mutex_unlock(&q.mMutex);
+
+						if(bTaken)
+						{
+							__atomic_sub_fetch(&mnQueued, 1, __ATOMIC_RELAXED);
+							return true;
+						}
+					}
+					return false;
+				}
+
+				static void run(const execution_task& task)
+				{
+					task.mpFunction(task.mpContext, task.mnIndex);
+					__atomic_sub_fetch(&task.mpGroup->mnPending, 1, __ATOMIC_ACQ_REL);
+				}
+
+				size_t          mnThreadCount;
+				size_t          mnNextIndex;
+				size_t          mnQueued;   // Tasks in all the queues, for the workers to sleep on.
+				bool            mbStop;
+				pthread_mutex_t mMutex;
+				pthread_cond_t  mCondition;
+				queue*          mpQueues;
+				pthread_t*      mpThreads;
+			};
+
+
+			template <typename Body>
+			void execution_invoke(void* pBody, size_t nIndex)
+			{
+				(*static_cast<Body*>(pBody))(nIndex);
+			}
+
+			// Calls body(i) for each i in [0, nCount), spread over the pool, and
+			// returns when all have returned.
+			template <typename Body>
+			void execution_parallel_for(size_t nCount, Body& body)
+			{
+				execution_thread_pool& pool = execution_thread_pool::get();
+				execution_task_group   group(nCount - 1);
+
+				for(size_t i = nCount - 1; i > 0; --i)
+				{
+					const execution_task task = { &execution_invoke<Body>, &body, i, &group };
+
+					if(!pool.push(task))
+					{
+						body(i);
+						__atomic_sub_fetch(&group.mnPending, 1, __ATOMIC_ACQ_REL);
+					}
+				}
+
+				body(0);
+				pool.wait(group);
+			}
+
+
+			static const size_t kExecutionMaxChunks = 256;
+
+			// How many chunks to cut n elements into: a few per thread, so that
+			// stealing evens out chunks that take longer, but none smaller than
+			// nMinChunk. 1 means the caller should run sequentially.
+			inline size_t execution_chunk_count(size_t n, size_t nMinChunk = EASTL_EXECUTION_MIN_CHUNK)
+			{
+				const size_t nThreads = execution_thread_pool::get().concurrency();
+				size_t       nChunks  = n / nMinChunk;
+
+				if(nChunks > (nThreads * 4))
+					nChunks = nThreads * 4;
+				if(nChunks > kExecutionMaxChunks)
+					nChunks = kExecutionMaxChunks;
+				return ((nThreads > 1) && (nChunks > 1)) ? nChunks : 1;
+			}
+
+			// Start of chunk i of n elements cut into nChunks.
+			inline size_t execution_chunk_begin(size_t n, size_t nChunks, size_t i)
+			{
+				return ((n / nChunks) * i) + ((i < (n % nChunks)) ? i : (n % nChunks));
+			}
+
+
+			/// execution_partials
+			///
+			/// One uninitialized result slot per chunk, for chunks to fill in any
+			/// order and the caller to combine in chunk order. All slots must be
+			/// filled before destruction.
+			///
+			template <typename T>
+			class execution_partials
+			{
+			public:
+				explicit execution_partials(size_t nCount)
+					: mAllocator(EASTL_NAME_VAL("EASTL execution")), mnCount(nCount)
+				{
+					mpBegin = (T*)allocate_memory(mAllocator, nCount * sizeof(T), EASTL_ALIGN_OF(T), 0);
+				}
+
+				~execution_partials()
+				{
+					for(size_t i = 0; i < mnCount; ++i)
+						mpBegin[i].~T();
+					EASTLFree(mAllocator, mpBegin, mnCount * sizeof(T));
+				}
+
+				void set(size_t i, T&& value) { ::new((void*)(mpBegin + i)) T(std::move(value)); }
+				T&   operator[](size_t i)     { return mpBegin[i]; }
+
+			private:
+				execution_partials(const execution_partials&);
+				void operator=(const execution_partials&);
+
+				EASTLAllocatorType mAllocator;
+				T*                 mpBegin;
+				size_t             mnCount;
+			};
+
+
+			template <bool bStable>
+			struct execution_sort_leaf
+			{
+				template <typename RandomAccessIterator, typename Compare>
+				static void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) { std::sort(first, last, compare); }
+			};
+
+			template <>
+			struct execution_sort_leaf<true>
+			{
+				template <typename RandomAccessIterator, typename Compare>
+				static void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) { std::stable_sort(first, last, compare); }
+			};
+
+
+			static const size_t kExecutionMergeChunk = 16384;
+
+			// Moves the merge of two sorted ranges to result. Large merges split at
+			// the middle of the longer range and the matching point of the other,
+			// found so that equal elements of the first range stay ahead, and
+			// merge the halves in parallel.
+			template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+			void execution_merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare compare)
+			{
+				const size_t n1 = size_t(last1 - first1);
+				const size_t n2 = size_t(last2 - first2);
+
+				if((n1 + n2) <= kExecutionMergeChunk)
+				{
+					std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+					           std::make_move_iterator(first2), std::make_move_iterator(last2), result, compare);
+					return;
+				}
+
+				InputIterator1 middle1;
+				InputIterator2 middle2;
+
+				if(n1 >= n2)
+				{
+					middle1 = first1 + (n1 / 2);
+					middle2 = std::lower_bound(first2, last2, *middle1, compare);
+				}
+				else
+				{
+					middle2 = first2 + (n2 / 2);
+					middle1 = std::upper_bound(first1, last1, *middle2, compare);
+				}
+
+				OutputIterator middle = result + ((middle1 - first1) + (middle2 - first2));
+
+				auto body = [&](size_t i)
+				{
+					if(i == 0)
+						Internal::execution_merge(first1, middle1, first2, middle2, result, compare);
+					else
+						Internal::execution_merge(middle1, last1, middle2, last2, middle, compare);
+				};
+				execution_parallel_for(2, body);
+			}
+
+
+			template <>
+			struct execution_imp<true>
+			{
+				// Sorts 2^r chunks, r odd, in a buffer the elements are moved to, then
+				// merges pairs of runs back and forth r times, which leaves them in
+				// the range.
+				template <bool bStable, typename RandomAccessIterator, typename Compare>
+				static void parallel_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+				{
+					typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+					const size_t n        = size_t(last - first);
+					const size_t nThreads = execution_thread_pool::get().concurrency();
+					size_t       nRounds  = 1;
+
+					while(((size_t(2) << nRounds) <= nThreads) && ((n >> (nRounds + 2)) >= EASTL_EXECUTION_MIN_CHUNK))
+						nRounds += 2;
+
+					const size_t nChunks = size_t(1) << nRounds;
+
+					if((nThreads < 2) || ((n / nChunks) < EASTL_EXECUTION_MIN_CHUNK))
+					{
+						execution_sort_leaf<bStable>::sort(first, last, compare);
+						return;
+					}
+
+					execution_partials<value_type> buffer(n);
+					value_type* const              pBuffer = &buffer[0];
+
+					auto sortBody = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						const size_t e = execution_chunk_begin(n, nChunks, i + 1);
+
+						for(size_t j = b; j != e; ++j)
+							buffer.set(j, std::move(first[j]));
+						execution_sort_leaf<bStable>::sort(pBuffer + b, pBuffer + e, compare);
+					};
+					execution_parallel_for(nChunks, sortBody);
+
+					for(size_t nRun = 1; nRun < nChunks; nRun *= 2)
+					{
+						const bool bToRange = ((nRun & 0xAAAAAAAA) == 0); // Odd rounds (run lengths 1, 4, 16...) go to the range.
+
+						auto mergeBody = [&](size_t i)
+						{
+							const size_t a = execution_chunk_begin(n, nChunks, (2 * i) * nRun);
+							const size_t b = execution_chunk_begin(n, nChunks, (2 * i + 1) * nRun);
+							const size_t c = execution_chunk_begin(n, nChunks, (2 * i + 2) * nRun);
+
+							if(bToRange)
+								Internal::execution_merge(pBuffer + a, pBuffer + b, pBuffer + b, pBuffer + c, first + a, compare);
+							else
+								Internal::execution_merge(first + a, first + b, first + b, first + c, pBuffer + a, compare);
+						};
+						execution_parallel_for(nChunks / (2 * nRun), mergeBody);
+					}
+				}
+
+				template <typename RandomAccessIterator, typename Compare>
+				static void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+					{ parallel_sort<false>(first, last, compare); }
+
+				template <typename RandomAccessIterator, typename Compare>
+				static void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+					{ parallel_sort<true>(first, last, compare); }
+
+				template <typename RandomAccessIterator, typename Function>
+				static void for_each(RandomAccessIterator first, RandomAccessIterator last, Function function)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					auto body = [&](size_t i)
+					{
+						std::for_each(first + execution_chunk_begin(n, nChunks, i), first + execution_chunk_begin(n, nChunks, i + 1), function);
+					};
+					execution_parallel_for(nChunks, body);
+				}
+
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename UnaryOperation>
+				static RandomAccessIterator2 transform(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 result, UnaryOperation op)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					auto body = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						std::transform(first + b, first + execution_chunk_begin(n, nChunks, i + 1), result + b, op);
+					};
+					execution_parallel_for(nChunks, body);
+					return result + n;
+				}
+
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename BinaryOperation>
+				static RandomAccessIterator3 transform(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, RandomAccessIterator3 result, BinaryOperation op)
+				{
+					const size_t n       = size_t(last1 - first1);
+					const size_t nChunks = execution_chunk_count(n);
+
+					auto body = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						std::transform(first1 + b, first1 + execution_chunk_begin(n, nChunks, i + 1), first2 + b, result + b, op);
+					};
+					execution_parallel_for(nChunks, body);
+					return result + n;
+				}
+
+				// Each chunk reduces its elements without init, starting from its
+				// first element; the caller folds init and the chunks in order.
+				template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+				static T reduce(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					if(nChunks == 1)
+						return std::reduce(first, last, init, op);
+
+					execution_partials<T> partials(nChunks);
+
+					auto body = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						partials.set(i, std::reduce(first + b + 1, first + execution_chunk_begin(n, nChunks, i + 1), T(first[b]), op));
+					};
+					execution_parallel_for(nChunks, body);
+
+					for(size_t i = 0; i < nChunks; ++i)
+						init = op(init, partials[i]);
+					return init;
+				}
+
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+				static T transform_reduce(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, T init, BinaryOperation1 reduce, BinaryOperation2 transform)
+				{
+					const size_t n       = size_t(last1 - first1);
+					const size_t nChunks = execution_chunk_count(n);
+
+					if(nChunks == 1)
+						return std::transform_reduce(first1, last1, first2, init, reduce, transform);
+
+					execution_partials<T> partials(nChunks);
+
+					auto body = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						partials.set(i, std::transform_reduce(first1 + b + 1, first1 + execution_chunk_begin(n, nChunks, i + 1), first2 + b + 1,
+						                                                     T(transform(first1[b], first2[b])), reduce, transform));
+					};
+					execution_parallel_for(nChunks, body);
+
+					for(size_t i = 0; i < nChunks; ++i)
+						init = reduce(init, partials[i]);
+					return init;
+				}
+
+				template <typename RandomAccessIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+				static T transform_reduce(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation reduce, UnaryOperation transform)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					if(nChunks == 1)
+						return std::transform_reduce(first, last, init, reduce, transform);
+
+					execution_partials<T> partials(nChunks);
+
+					auto body = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						partials.set(i, std::transform_reduce(first + b + 1, first + execution_chunk_begin(n, nChunks, i + 1),
+						                                                     T(transform(first[b])), reduce, transform));
+					};
+					execution_parallel_for(nChunks, body);
+
+					for(size_t i = 0; i < nChunks; ++i)
+						init = reduce(init, partials[i]);
+					return init;
+				}
+
+				// Reduces every chunk but the last, scans the chunk sums, then scans
+				// every chunk from the sum of those before it.
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation, typename T>
+				static RandomAccessIterator2 scan(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 result, BinaryOperation op, const T* pInit)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					if(nChunks == 1)
+						return pInit ? std::inclusive_scan(first, last, result, op, *pInit) : std::inclusive_scan(first, last, result, op);
+
+					execution_partials<T> sums(nChunks - 1);
+
+					auto sumBody = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						sums.set(i, std::reduce(first + b + 1, first + execution_chunk_begin(n, nChunks, i + 1), T(first[b]), op));
+					};
+					execution_parallel_for(nChunks - 1, sumBody);
+
+					if(pInit)
+						sums[0] = op(*pInit, sums[0]);
+					for(size_t i = 1; i < (nChunks - 1); ++i)
+						sums[i] = op(sums[i - 1], sums[i]);
+
+					auto scanBody = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						const size_t e = execution_chunk_begin(n, nChunks, i + 1);
+
+						if(i)
+							std::inclusive_scan(first + b, first + e, result + b, op, sums[i - 1]);
+						else if(pInit)
+							std::inclusive_scan(first + b, first + e, result + b, op, *pInit);
+						else
+							std::inclusive_scan(first + b, first + e, result + b, op);
+					};
+					execution_parallel_for(nChunks, scanBody);
+					return result + n;
+				}
+
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation>
+				static RandomAccessIterator2 inclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 result, BinaryOperation op)
+				{
+					typedef typename iterator_traits<RandomAccessIterator1>::value_type value_type;
+
+					return scan(first, last, result, op, (const value_type*)NULL);
+				}
+
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation, typename T>
+				static RandomAccessIterator2 inclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 result, BinaryOperation op, T init)
+					{ return scan(first, last, result, op, &init); }
+
+				template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+				static RandomAccessIterator2 copy(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 result)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					auto body = [&](size_t i)
+					{
+						const size_t b = execution_chunk_begin(n, nChunks, i);
+						std::copy(first + b, first + execution_chunk_begin(n, nChunks, i + 1), result + b);
+					};
+					execution_parallel_for(nChunks, body);
+					return result + n;
+				}
+
+				template <typename RandomAccessIterator, typename T>
+				static void fill(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+
+					auto body = [&](size_t i)
+					{
+						std::fill(first + execution_chunk_begin(n, nChunks, i), first + execution_chunk_begin(n, nChunks, i + 1), value);
+					};
+					execution_parallel_for(nChunks, body);
+				}
+
+				// Chunks search a block at a time and stop once a match is known
+				// before the block; the smallest match wins.
+				template <typename RandomAccessIterator, typename T>
+				static RandomAccessIterator find(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+				{
+					const size_t n       = size_t(last - first);
+					const size_t nChunks = execution_chunk_count(n);
+					size_t       nFound  = n;
+
+					auto body = [&](size_t i)
+					{
+						const size_t e = execution_chunk_begin(n, nChunks, i + 1);
+
+						for(size_t b = execution_chunk_begin(n, nChunks, i); (b < e) && (b < __atomic_load_n(&nFound, __ATOMIC_RELAXED)); b += EASTL_EXECUTION_MIN_CHUNK)
+						{
+							const RandomAccessIterator blockEnd = first + ((e - b) > EASTL_EXECUTION_MIN_CHUNK ? b + EASTL_EXECUTION_MIN_CHUNK : e);
+							const RandomAccessIterator it       = std::find(first + b, blockEnd, value);
+
+							if(it != blockEnd)
+							{
+								size_t nIndex   = size_t(it - first);
+								size_t nCurrent = __atomic_load_n(&nFound, __ATOMIC_RELAXED);
+
+								while((nIndex < nCurrent) && !__atomic_compare_exchange_n(&nFound, &nCurrent, nIndex, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+									{ }
+								return;
+							}
+						}
+					};
+					execution_parallel_for(nChunks, body);
+					return first + nFound;
+				}
+
+				template <typename RandomAccessIterator, typename T>
+				static typename iterator_traits<RandomAccessIterator>::difference_type count(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+				{
+					typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+					const size_t    n       = size_t(last - first);
+					const size_t    nChunks = execution_chunk_count(n);
+					difference_type counts[kExecutionMaxChunks];
+					difference_type result  = 0;
+
+					auto body = [&](size_t i)
+					{
+						counts[i] = std::count(first + execution_chunk_begin(n, nChunks, i), first + execution_chunk_begin(n, nChunks, i + 1), value);
+					};
+					execution_parallel_for(nChunks, body);
+
+					for(size_t i = 0; i < nChunks; ++i)
+						result += counts[i];
+					return result;
+				}
+
+				// Combining the chunks in order keeps the first smallest and the last
+				// largest element, as minmax_element does.
+				template <typename RandomAccessIterator, typename Compare>
+				static pair<RandomAccessIterator, RandomAccessIterator> minmax_element(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+				{
+					const size_t                                      n       = size_t(last - first);
+					const size_t                                      nChunks = execution_chunk_count(n);
+					pair<RandomAccessIterator, RandomAccessIterator>  results[kExecutionMaxChunks];
+
+					auto body = [&](size_t i)
+					{
+						results[i] = std::minmax_element(first + execution_chunk_begin(n, nChunks, i), first + execution_chunk_begin(n, nChunks, i + 1), compare);
+					};
+					execution_parallel_for(nChunks, body);
+
+					pair<RandomAccessIterator, RandomAccessIterator> result(results[0]);
+
+					for(size_t i = 1; i < nChunks; ++i)
+					{
+						if(compare(*results[i].first, *result.first))
+							result.first = results[i].first;
+						if(!compare(*results[i].second, *result.second))
+							result.second = results[i].second;
+					}
+					return result;
+				}
+
+				template <typename RandomAccessIterator>
+				static pair<RandomAccessIterator, RandomAccessIterator> minmax_element(RandomAccessIterator first, RandomAccessIterator last)
+				{
+					typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+					if(execution_chunk_count(size_t(last - first)) == 1)
+						return std::minmax_element(first, last);
+					return minmax_element(first, last, std::less<value_type>());
+				}
+			};
+		#endif
+
+	} // namespace Internal
+
+
+
+	/// sort / stable_sort
+	///
+	/// With par or par_unseq, chunks of the range are sorted in parallel and
+	/// merged in parallel through a buffer of (last - first) elements.
+	///
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+	Internal::execution_enable_t<ExecutionPolicy, void>
+	sort(ExecutionPolicy&&, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, RandomAccessIterator>::value>::sort(first, last, compare);
+	}
+
+	template <typename ExecutionPolicy, typename RandomAccessIterator>
+	Internal::execution_enable_t<ExecutionPolicy, void>
+	sort(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		std::sort(std::forward<ExecutionPolicy>(policy), first, last, std::less<value_type>());
+	}
+
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+	Internal::execution_enable_t<ExecutionPolicy, void>
+	stable_sort(ExecutionPolicy&&, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, RandomAccessIterator>::value>::stable_sort(first, last, compare);
+	}
+
+	template <typename ExecutionPolicy, typename RandomAccessIterator>
+	Internal::execution_enable_t<ExecutionPolicy, void>
+	stable_sort(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		std::stable_sort(std::forward<ExecutionPolicy>(policy), first, last, std::less<value_type>());
+	}
+
+
+	/// for_each
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator, typename Function>
+	Internal::execution_enable_t<ExecutionPolicy, void>
+	for_each(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, Function function)
+	{
+		Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::for_each(first, last, function);
+	}
+
+
+	/// transform
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename UnaryOperation>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator2>
+	transform(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, UnaryOperation op)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value>::transform(first, last, result, op);
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename ForwardIterator3, typename BinaryOperation>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator3>
+	transform(ExecutionPolicy&&, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator3 result, BinaryOperation op)
+	{
+		const bool bParallel = Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value &&
+		                       Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator3>::value;
+
+		return Internal::execution_imp<bParallel>::transform(first1, last1, first2, result, op);
+	}
+
+
+	/// reduce
+	///
+	/// Like accumulate, but op is applied in an unspecified order, which lets
+	/// the chunks of a parallel call be reduced at the same time.
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator, typename T, typename BinaryOperation>
+	Internal::execution_enable_t<ExecutionPolicy, T>
+	reduce(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, T init, BinaryOperation op)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::reduce(first, last, init, op);
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+	Internal::execution_enable_t<ExecutionPolicy, T>
+	reduce(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, T init)
+	{
+		return std::reduce(std::forward<ExecutionPolicy>(policy), first, last, init, std::plus<>());
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator>
+	Internal::execution_enable_t<ExecutionPolicy, typename iterator_traits<ForwardIterator>::value_type>
+	reduce(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last)
+	{
+		typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+
+		return std::reduce(std::forward<ExecutionPolicy>(policy), first, last, value_type(), std::plus<>());
+	}
+
+
+	/// transform_reduce
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+	Internal::execution_enable_t<ExecutionPolicy, T>
+	transform_reduce(ExecutionPolicy&&, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, T init, BinaryOperation1 reduce, BinaryOperation2 transform)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value>::transform_reduce(first1, last1, first2, init, reduce, transform);
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename T>
+	Internal::execution_enable_t<ExecutionPolicy, T>
+	transform_reduce(ExecutionPolicy&& policy, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, T init)
+	{
+		return std::transform_reduce(std::forward<ExecutionPolicy>(policy), first1, last1, first2, init, std::plus<>(), std::multiplies<>());
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+	Internal::execution_enable_t<ExecutionPolicy, T>
+	transform_reduce(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, T init, BinaryOperation reduce, UnaryOperation transform)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::transform_reduce(first, last, init, reduce, transform);
+	}
+
+
+	/// inclusive_scan
+	///
+	/// Like partial_sum, but op is assumed associative, which lets the chunks
+	/// of a parallel call be summed at the same time. result may equal first.
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryOperation, typename T>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator2>
+	inclusive_scan(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, BinaryOperation op, T init)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value>::inclusive_scan(first, last, result, op, init);
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryOperation>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator2>
+	inclusive_scan(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, BinaryOperation op)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value>::inclusive_scan(first, last, result, op);
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator2>
+	inclusive_scan(ExecutionPolicy&& policy, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result)
+	{
+		return std::inclusive_scan(std::forward<ExecutionPolicy>(policy), first, last, result, std::plus<>());
+	}
+
+
+	/// copy
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator2>
+	copy(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value>::copy(first, last, result);
+	}
+
+
+	/// fill
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+	Internal::execution_enable_t<ExecutionPolicy, void>
+	fill(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, const T& value)
+	{
+		Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::fill(first, last, value);
+	}
+
+
+	/// find
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+	Internal::execution_enable_t<ExecutionPolicy, ForwardIterator>
+	find(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, const T& value)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::find(first, last, value);
+	}
+
+
+	/// count
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+	Internal::execution_enable_t<ExecutionPolicy, typename iterator_traits<ForwardIterator>::difference_type>
+	count(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, const T& value)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::count(first, last, value);
+	}
+
+
+	/// minmax_element
+	///
+	template <typename ExecutionPolicy, typename ForwardIterator, typename Compare>
+	Internal::execution_enable_t<ExecutionPolicy, pair<ForwardIterator, ForwardIterator> >
+	minmax_element(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, Compare compare)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::minmax_element(first, last, compare);
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIterator>
+	Internal::execution_enable_t<ExecutionPolicy, pair<ForwardIterator, ForwardIterator> >
+	minmax_element(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+	{
+		return Internal::execution_imp<Internal::is_parallel_execution<ExecutionPolicy, ForwardIterator>::value>::minmax_element(first, last);
+	}
+
+} // namespace std
+
+
+#endif // Header include guard
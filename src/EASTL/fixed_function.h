@@ -16,7 +16,7 @@ namespace std
 	template <int, typename>
 	class fixed_function;
 
-	namespace internal
+	namespace Internal
 	{
 		template <typename>
 		struct is_fixed_function
@@ -40,15 +40,15 @@ namespace std
 
 	template <typename Functor>
 	using EASTL_DISABLE_OVERLOAD_IF_FIXED_FUNCTION =
-	    std::disable_if_t<internal::is_fixed_function<std::decay_t<Functor>>::value>;
+	    std::disable_if_t<Internal::is_fixed_function<std::decay_t<Functor>>::value>;
 
 
 	// fixed_function
 	//
 	template <int SIZE_IN_BYTES, typename R, typename... Args>
-	class fixed_function<SIZE_IN_BYTES, R(Args...)> : public internal::function_detail<SIZE_IN_BYTES, R(Args...)>
+	class fixed_function<SIZE_IN_BYTES, R(Args...)> : public Internal::function_detail<SIZE_IN_BYTES, R(Args...)>
 	{
-		using Base = internal::function_detail<SIZE_IN_BYTES, R(Args...)>;
+		using Base = Internal::function_detail<SIZE_IN_BYTES, R(Args...)>;
 
 	public:
 		using typename Base::result_type;
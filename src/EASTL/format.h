@@ -0,0 +1,2351 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the C++20 <format> library: format, format_to,
+// format_to_n, formatted_size, their v* counterparts and the formatter
+// extension point.
+//
+// Nothing here allocates unless the output does. The arguments are captured
+// by reference in a small type erased array, the format string is walked
+// once, and the characters pass through a short stack buffer on their way to
+// the output iterator, which can be a char*, a back_insert_iterator into a
+// fixed_string or fixed_vector, or the iterator of a format_context when a
+// formatter recurses. Numbers are written with to_chars, so printf is never
+// linked in.
+//
+// With a compiler that supports consteval the format string is checked
+// against the argument types when the program is compiled, as the standard
+// requires. The specs of user defined formatters are only checked for
+// balanced braces there, since their parse functions need not be constexpr.
+// Under C++11, as used by avr-gcc, the same checks run when the string is
+// used: a bad format string throws format_error if exceptions are enabled and
+// otherwise fails an EASTL assert and stops the output at the error.
+//
+// Differences from the standard:
+//    - Only char is supported; there is no wformat.
+//    - The fill character is a single byte, and width counts bytes.
+//    - The locale option 'L' is accepted and ignored.
+//    - long double arguments are formatted as double.
+//    - chrono formatting covers durations. The microsecond suffix is "us".
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FORMAT_H
+#define EASTL_FORMAT_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/charconv.h>
+#include <EASTL/chrono.h>
+#include <EASTL/iterator.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/tuple.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/utility.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if EASTL_EXCEPTIONS_ENABLED
+	#include <stdexcept> // std::runtime_error
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_FORMAT_BUFFER_SIZE
+//
+// The size of the stack buffer that output collects in before it is handed
+// to the output iterator.
+//
+#ifndef EASTL_FORMAT_BUFFER_SIZE
+	#define EASTL_FORMAT_BUFFER_SIZE 32
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_FORMAT_FLOAT_BUFFER_SIZE
+//
+// The stack buffer a floating point argument is converted into. A fixed
+// notation value together with its precision must fit, otherwise format
+// reports an error.
+//
+#ifndef EASTL_FORMAT_FLOAT_BUFFER_SIZE
+	#if EASTL_CHARCONV_DOUBLE_IS_FLOAT
+		#define EASTL_FORMAT_FLOAT_BUFFER_SIZE 80
+	#else
+		#define EASTL_FORMAT_FLOAT_BUFFER_SIZE 400
+	#endif
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_FORMAT_CONSTEVAL_ENABLED
+//
+// Defined as 1 when format strings are checked at compile time.
+//
+#ifndef EASTL_FORMAT_CONSTEVAL_ENABLED
+	#if defined(__cpp_consteval) && (__cpp_consteval >= 201811L)
+		#define EASTL_FORMAT_CONSTEVAL_ENABLED 1
+	#else
+		#define EASTL_FORMAT_CONSTEVAL_ENABLED 0
+	#endif
+#endif
+
+#if EASTL_FORMAT_CONSTEVAL_ENABLED
+	#define EASTL_FORMAT_CONSTEVAL  consteval
+	#define EASTL_FORMAT_CONSTEXPR  constexpr
+#else
+	#define EASTL_FORMAT_CONSTEVAL  EA_CONSTEXPR
+	#define EASTL_FORMAT_CONSTEXPR
+#endif
+
+
+
+namespace std
+{
+	#if EASTL_EXCEPTIONS_ENABLED
+		/// format_error
+		///
+		/// http://en.cppreference.com/w/cpp/utility/format/format_error
+		///
+		class format_error : public std::runtime_error
+		{
+		public:
+			explicit format_error(const char* pMessage)
+				: std::runtime_error(pMessage) { }
+		};
+	#endif
+
+
+	template <typename T, typename CharT = char, typename Enable = void>
+	struct formatter;
+
+	template <typename CharT>
+	class basic_format_parse_context;
+
+	template <typename OutputIt, typename CharT>
+	class basic_format_context;
+
+	template <typename Context>
+	class basic_format_arg;
+
+	template <typename Context>
+	class basic_format_args;
+
+
+	namespace Internal
+	{
+		/// FormatError
+		///
+		/// Reports a malformed format string or a spec that does not fit its
+		/// argument. During constant evaluation the call itself is the compile
+		/// error, which is how a consteval format_string rejects bad strings.
+		///
+		inline void FormatError(const char* pMessage)
+		{
+			#if EASTL_EXCEPTIONS_ENABLED
+				throw format_error(pMessage);
+			#elif EASTL_ASSERT_ENABLED
+				EASTL_FAIL_MSG(pMessage);
+			#else
+				EA_UNUSED(pMessage);
+			#endif
+		}
+
+
+		/// FormatSink
+		///
+		/// The destination of all formatted output. Characters collect in a small
+		/// buffer that is passed to a flush function when it fills, so that the
+		/// formatting code is compiled once rather than once per output iterator.
+		///
+		class FormatSink
+		{
+		public:
+			typedef void (*FlushFunction)(FormatSink* pSink, const char* p, size_t n);
+
+			explicit FormatSink(FlushFunction pFlush)
+				: mpFlush(pFlush), mnSize(0) { }
+
+			void put(char c)
+			{
+				if(mnSize == EASTL_FORMAT_BUFFER_SIZE)
+					Flush();
+				mBuffer[mnSize++] = c;
+			}
+
+			void write(const char* p, size_t n)
+			{
+				if(n == 0) // p may be NULL, as with an empty string_view.
+					return;
+
+				if(n > (EASTL_FORMAT_BUFFER_SIZE - mnSize))
+				{
+					Flush();
+
+					if(n >= EASTL_FORMAT_BUFFER_SIZE)
+					{
+						mpFlush(this, p, n);
+						return;
+					}
+				}
+
+				memcpy(mBuffer + mnSize, p, n);
+				mnSize += n;
+			}
+
+			void fill(char c, size_t n)
+			{
+				while(n--)
+					put(c);
+			}
+
+			void Flush()
+			{
+				if(mnSize)
+				{
+					const size_t n = mnSize;
+					mnSize = 0;
+					mpFlush(this, mBuffer, n);
+				}
+			}
+
+		protected:
+			FlushFunction mpFlush;
+			size_t        mnSize;
+			char          mBuffer[EASTL_FORMAT_BUFFER_SIZE];
+		};
+
+
+		/// FormatIteratorSink
+		///
+		/// Writes to an output iterator.
+		///
+		template <typename OutputIt>
+		class FormatIteratorSink : public FormatSink
+		{
+		public:
+			explicit FormatIteratorSink(OutputIt out)
+				: FormatSink(&FormatIteratorSink::DoFlush), mOut(out) { }
+
+			OutputIt out()
+			{
+				Flush();
+				return mOut;
+			}
+
+		protected:
+			static void DoFlush(FormatSink* pSink, const char* p, size_t n)
+			{
+				FormatIteratorSink* const pThis = static_cast<FormatIteratorSink*>(pSink);
+
+				for(const char* const pEnd = p + n; p != pEnd; ++p)
+				{
+					*pThis->mOut = *p;
+					++pThis->mOut;
+				}
+			}
+
+			OutputIt mOut;
+		};
+
+		template <>
+		inline void FormatIteratorSink<char*>::DoFlush(FormatSink* pSink, const char* p, size_t n)
+		{
+			FormatIteratorSink* const pThis = static_cast<FormatIteratorSink*>(pSink);
+
+			memcpy(pThis->mOut, p, n);
+			pThis->mOut += n;
+		}
+
+
+		/// FormatLimitedSink
+		///
+		/// Writes at most a given number of characters to an output iterator and
+		/// counts all of them, for format_to_n.
+		///
+		template <typename OutputIt>
+		class FormatLimitedSink : public FormatSink
+		{
+		public:
+			FormatLimitedSink(OutputIt out, size_t nLimit)
+				: FormatSink(&FormatLimitedSink::DoFlush), mOut(out), mnLimit(nLimit), mnCount(0) { }
+
+			OutputIt out()
+			{
+				Flush();
+				return mOut;
+			}
+
+			size_t count() const
+				{ return mnCount + mnSize; }
+
+		protected:
+			static void DoFlush(FormatSink* pSink, const char* p, size_t n)
+			{
+				FormatLimitedSink* const pThis = static_cast<FormatLimitedSink*>(pSink);
+				const size_t nRoom = (pThis->mnCount < pThis->mnLimit) ? (pThis->mnLimit - pThis->mnCount) : 0;
+
+				pThis->mnCount += n;
+
+				for(const char* const pEnd = p + ((n < nRoom) ? n : nRoom); p != pEnd; ++p)
+				{
+					*pThis->mOut = *p;
+					++pThis->mOut;
+				}
+			}
+
+			OutputIt mOut;
+			size_t   mnLimit;
+			size_t   mnCount;
+		};
+
+
+		/// FormatCountingSink
+		///
+		/// Discards the output and counts it, for formatted_size and for padding
+		/// composite values to a width.
+		///
+		class FormatCountingSink : public FormatSink
+		{
+		public:
+			FormatCountingSink()
+				: FormatSink(&FormatCountingSink::DoFlush), mnCount(0) { }
+
+			size_t count() const
+				{ return mnCount + mnSize; }
+
+		protected:
+			static void DoFlush(FormatSink* pSink, const char*, size_t n)
+				{ static_cast<FormatCountingSink*>(pSink)->mnCount += n; }
+
+			size_t mnCount;
+		};
+
+
+		/// FormatStringSink
+		///
+		/// Appends to a string, for format and vformat.
+		///
+		template <typename String>
+		class FormatStringSink : public FormatSink
+		{
+		public:
+			explicit FormatStringSink(String& s)
+				: FormatSink(&FormatStringSink::DoFlush), mpString(&s) { }
+
+		protected:
+			static void DoFlush(FormatSink* pSink, const char* p, size_t n)
+				{ static_cast<FormatStringSink*>(pSink)->mpString->append(p, p + n); }
+
+			String* mpString;
+		};
+
+
+		/// FormatSinkIterator
+		///
+		/// The output iterator of format_context. Writing through it, or passing it
+		/// to format_to, goes straight to the sink of the enclosing call.
+		///
+		class FormatSinkIterator
+		{
+		public:
+			typedef EASTL_ITC_NS::output_iterator_tag iterator_category;
+			typedef void                              value_type;
+			typedef ptrdiff_t                         difference_type;
+			typedef void                              pointer;
+			typedef void                              reference;
+
+			explicit FormatSinkIterator(FormatSink* pSink)
+				: mpSink(pSink) { }
+
+			FormatSinkIterator& operator=(char c) { mpSink->put(c); return *this; }
+			FormatSinkIterator& operator*()       { return *this; }
+			FormatSinkIterator& operator++()      { return *this; }
+			FormatSinkIterator  operator++(int)   { return *this; }
+
+			FormatSink* GetSink() const { return mpSink; }
+
+		protected:
+			FormatSink* mpSink;
+		};
+
+
+		/// FormatArgType
+		///
+		/// How a formatting argument is stored. Integers are widened to 32 or
+		/// 64 bits so that 8 bit targets do not pay for 64 bit arithmetic on
+		/// every int.
+		///
+		enum FormatArgType
+		{
+			kFormatArgNone,
+			kFormatArgBool,
+			kFormatArgChar,
+			kFormatArgInt,
+			kFormatArgUInt,
+			kFormatArgLongLong,
+			kFormatArgULongLong,
+			kFormatArgFloat,
+			kFormatArgDouble,
+			kFormatArgCString,
+			kFormatArgString,
+			kFormatArgPointer,
+			kFormatArgCustom
+		};
+
+		EASTL_FORMAT_CONSTEXPR inline bool IsFormatIntegerType(int type)
+			{ return (type >= kFormatArgInt) && (type <= kFormatArgULongLong); }
+
+
+		/// FormatArgKind
+		///
+		/// Maps an argument type to the FormatArgType it is stored as.
+		///
+		template <typename T>
+		struct FormatArgKind
+		{
+			typedef typename remove_cv<T>::type U;
+			typedef typename decay<U>::type     D;
+
+			static const int value =
+				is_same<U, bool>::value ? kFormatArgBool :
+				is_same<U, char>::value ? kFormatArgChar :
+				is_integral<U>::value   ? (is_signed<U>::value ? ((sizeof(U) <= 4) ? kFormatArgInt  : kFormatArgLongLong)
+				                                               : ((sizeof(U) <= 4) ? kFormatArgUInt : kFormatArgULongLong)) :
+				is_same<U, float>::value        ? kFormatArgFloat :
+				is_floating_point<U>::value     ? kFormatArgDouble :
+				(is_same<D, char*>::value || is_same<D, const char*>::value) ? kFormatArgCString :
+				(is_same<U, decltype(nullptr)>::value || is_same<D, void*>::value || is_same<D, const void*>::value) ? kFormatArgPointer :
+				is_convertible<const U&, basic_string_view<char> >::value    ? kFormatArgString :
+				kFormatArgCustom;
+		};
+
+
+		/// FormatSpec
+		///
+		/// A parsed standard format spec:
+		///     [[fill]align][sign][#][0][width][.precision][L][type]
+		/// A width or precision given as a nested replacement field holds the
+		/// argument index until it is resolved at formatting time.
+		///
+		struct FormatSpec
+		{
+			int  mnWidth        = 0;
+			int  mnPrecision    = -1;
+			int  mnWidthArg     = -1;
+			int  mnPrecisionArg = -1;
+			char mFill          = ' ';
+			char mAlign         = 0;
+			char mSign          = 0;
+			char mType          = 0;
+			bool mbAlternate    = false;
+			bool mbZeroPad      = false;
+		};
+
+		template <typename Context, typename T>
+		void FormatCustomArg(basic_format_parse_context<char>& parseContext, Context& context, const void* pValue);
+
+	} // namespace Internal
+
+
+
+	/// basic_format_parse_context
+	///
+	/// The view of the format string that formatter::parse works on. begin()
+	/// is the start of the spec following the ':', or the closing '}' when
+	/// there is no spec.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/basic_format_parse_context
+	///
+	template <typename CharT>
+	class basic_format_parse_context
+	{
+	public:
+		typedef CharT           char_type;
+		typedef const CharT*    const_iterator;
+		typedef const_iterator  iterator;
+
+		EASTL_FORMAT_CONSTEXPR explicit basic_format_parse_context(basic_string_view<CharT> fmt, size_t nArgs = 0) EA_NOEXCEPT
+			: mpBegin(fmt.data()), mpEnd(fmt.data() + fmt.size()), mnArgs(nArgs), mnNextArgId(0) { }
+
+		basic_format_parse_context(const basic_format_parse_context&) = delete;
+		basic_format_parse_context& operator=(const basic_format_parse_context&) = delete;
+
+		EASTL_FORMAT_CONSTEXPR const_iterator begin() const EA_NOEXCEPT { return mpBegin; }
+		EASTL_FORMAT_CONSTEXPR const_iterator end() const EA_NOEXCEPT   { return mpEnd; }
+		EASTL_FORMAT_CONSTEXPR void advance_to(const_iterator it)       { mpBegin = it; }
+
+		/// Returns the next argument index in automatic numbering mode.
+		EASTL_FORMAT_CONSTEXPR size_t next_arg_id()
+		{
+			if(mnNextArgId < 0)
+				Internal::FormatError("format: cannot switch from manual to automatic argument indexing");
+			else if((size_t)mnNextArgId >= mnArgs)
+				Internal::FormatError("format: argument index out of range");
+
+			return (size_t)mnNextArgId++;
+		}
+
+		/// Switches to manual numbering mode and checks that id is in range.
+		EASTL_FORMAT_CONSTEXPR void check_arg_id(size_t id)
+		{
+			if(mnNextArgId > 0)
+				Internal::FormatError("format: cannot switch from automatic to manual argument indexing");
+			else if(id >= mnArgs)
+				Internal::FormatError("format: argument index out of range");
+
+			mnNextArgId = -1;
+		}
+
+	protected:
+		const_iterator mpBegin;
+		const_iterator mpEnd;
+		size_t         mnArgs;
+		ptrdiff_t      mnNextArgId; // Negative once manual indexing is in use.
+	};
+
+	typedef basic_format_parse_context<char> format_parse_context;
+
+
+
+	/// basic_format_arg
+	///
+	/// A type erased reference to one formatting argument.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/basic_format_arg
+	///
+	template <typename Context>
+	class basic_format_arg
+	{
+	public:
+		basic_format_arg() EA_NOEXCEPT
+			: mType(Internal::kFormatArgNone) { }
+
+		explicit operator bool() const EA_NOEXCEPT
+			{ return mType != Internal::kFormatArgNone; }
+
+	public:
+		// Implementation details, used by the format functions.
+		typedef void (*CustomFormatFunction)(basic_format_parse_context<char>&, Context&, const void*);
+
+		struct StringValue { const char* mpData; size_t mnSize; };
+		struct CustomValue { const void* mpObject; CustomFormatFunction mpFormat; };
+
+		int mType;
+
+		union
+		{
+			bool        mBool;
+			char        mChar;
+			int32_t     mInt;
+			uint32_t    mUInt;
+			int64_t     mLongLong;
+			uint64_t    mULongLong;
+			float       mFloat;
+			double      mDouble;
+			const char* mpCString;
+			StringValue mString;
+			const void* mpPointer;
+			CustomValue mCustom;
+		};
+	};
+
+
+	namespace Internal
+	{
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgBool>)      { arg.mBool = value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgChar>)      { arg.mChar = value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgInt>)       { arg.mInt = (int32_t)value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgUInt>)      { arg.mUInt = (uint32_t)value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgLongLong>)  { arg.mLongLong = (int64_t)value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgULongLong>) { arg.mULongLong = (uint64_t)value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgFloat>)     { arg.mFloat = value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgDouble>)    { arg.mDouble = (double)value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgCString>)   { arg.mpCString = value; }
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgPointer>)   { arg.mpPointer = value; }
+
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgString>)
+		{
+			const basic_string_view<char> sv(value);
+
+			arg.mString.mpData = sv.data();
+			arg.mString.mnSize = sv.size();
+		}
+
+		template <typename Context, typename T>
+		inline void InitFormatArg(basic_format_arg<Context>& arg, const T& value, integral_constant<int, kFormatArgCustom>)
+		{
+			arg.mCustom.mpObject = std::addressof(value);
+			arg.mCustom.mpFormat = &FormatCustomArg<Context, T>;
+		}
+
+		template <typename Context, typename T>
+		inline basic_format_arg<Context> MakeFormatArg(const T& value)
+		{
+			basic_format_arg<Context> arg;
+
+			arg.mType = FormatArgKind<T>::value;
+			InitFormatArg(arg, value, integral_constant<int, FormatArgKind<T>::value>());
+			return arg;
+		}
+
+
+		/// FormatArgStore
+		///
+		/// The array of arguments that make_format_args returns. It refers to
+		/// the arguments and must not outlive them.
+		///
+		template <typename Context, typename... Args>
+		class FormatArgStore
+		{
+		public:
+			explicit FormatArgStore(const Args&... args)
+				: mArgs{ MakeFormatArg<Context>(args)... } { }
+
+			basic_format_arg<Context> mArgs[(sizeof...(Args) > 0) ? sizeof...(Args) : 1];
+		};
+
+	} // namespace Internal
+
+
+
+	/// basic_format_args
+	///
+	/// A view of the arguments of a format call.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/basic_format_args
+	///
+	template <typename Context>
+	class basic_format_args
+	{
+	public:
+		basic_format_args() EA_NOEXCEPT
+			: mpArgs(NULL), mnSize(0) { }
+
+		template <typename... Args>
+		basic_format_args(const Internal::FormatArgStore<Context, Args...>& store) EA_NOEXCEPT
+			: mpArgs(store.mArgs), mnSize(sizeof...(Args)) { }
+
+		basic_format_arg<Context> get(size_t i) const EA_NOEXCEPT
+			{ return (i < mnSize) ? mpArgs[i] : basic_format_arg<Context>(); }
+
+		size_t size() const EA_NOEXCEPT // Extension
+			{ return mnSize; }
+
+	protected:
+		const basic_format_arg<Context>* mpArgs;
+		size_t                           mnSize;
+	};
+
+
+
+	/// basic_format_context
+	///
+	/// The state passed to formatter::format: the output iterator and the
+	/// arguments, for dynamic width and precision. All formatting goes through
+	/// the one format_context type, whose iterator writes to the sink of the
+	/// enclosing call.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/basic_format_context
+	///
+	template <typename OutputIt, typename CharT>
+	class basic_format_context
+	{
+	public:
+		typedef OutputIt iterator;
+		typedef CharT    char_type;
+
+		template <typename T>
+		using formatter_type = formatter<T, CharT>;
+
+		basic_format_context(iterator out, basic_format_args<basic_format_context> args)
+			: mOut(out), mArgs(args) { }
+
+		basic_format_context(const basic_format_context&) = delete;
+		basic_format_context& operator=(const basic_format_context&) = delete;
+
+		basic_format_arg<basic_format_context> arg(size_t id) const EA_NOEXCEPT { return mArgs.get(id); }
+		iterator out()                { return mOut; }
+		void     advance_to(iterator) { } // The iterator always refers to the same sink.
+
+		basic_format_args<basic_format_context> GetArgs() const { return mArgs; } // Extension
+
+	protected:
+		iterator                                mOut;
+		basic_format_args<basic_format_context> mArgs;
+	};
+
+	typedef basic_format_context<Internal::FormatSinkIterator, char> format_context;
+	typedef basic_format_args<format_context>                        format_args;
+
+
+
+	/// make_format_args
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/make_format_args
+	///
+	template <typename Context = format_context, typename... Args>
+	inline Internal::FormatArgStore<Context, Args...> make_format_args(const Args&... args)
+	{
+		return Internal::FormatArgStore<Context, Args...>(args...);
+	}
+
+
+
+	namespace Internal
+	{
+		///////////////////////////////////////////////////////////////////////
+		// Format string parsing
+		///////////////////////////////////////////////////////////////////////
+
+		EASTL_FORMAT_CONSTEXPR inline bool IsFormatDigit(char c)
+			{ return (c >= '0') && (c <= '9'); }
+
+		EASTL_FORMAT_CONSTEXPR inline bool IsFormatAlign(char c)
+			{ return (c == '<') || (c == '>') || (c == '^'); }
+
+
+		/// ParseFormatInteger
+		///
+		/// Parses a non-negative decimal integer that fits in an int, or returns NULL.
+		///
+		EASTL_FORMAT_CONSTEXPR inline const char* ParseFormatInteger(const char* p, const char* pEnd, int& value)
+		{
+			int n = 0;
+
+			for(; (p != pEnd) && IsFormatDigit(*p); ++p)
+			{
+				if(n > ((INT_MAX - 9) / 10))
+				{
+					FormatError("format: number is too big");
+					return NULL;
+				}
+				n = (n * 10) + (*p - '0');
+			}
+
+			value = n;
+			return p;
+		}
+
+
+		/// ParseFormatArgId
+		///
+		/// Parses the optional argument index at p, which follows a '{', and
+		/// returns the position after it or NULL.
+		///
+		EASTL_FORMAT_CONSTEXPR inline const char* ParseFormatArgId(format_parse_context& parseContext, const char* p, const char* pEnd, size_t& id)
+		{
+			if((p != pEnd) && IsFormatDigit(*p))
+			{
+				int n = 0;
+
+				if((*p == '0') && ((p + 1) != pEnd) && IsFormatDigit(p[1]))
+				{
+					FormatError("format: invalid argument index");
+					return NULL;
+				}
+
+				p = ParseFormatInteger(p, pEnd, n);
+				if(p)
+				{
+					parseContext.check_arg_id((size_t)n);
+					id = (size_t)n;
+				}
+			}
+			else
+				id = parseContext.next_arg_id();
+
+			return p;
+		}
+
+
+		/// ParseFormatField
+		///
+		/// Parses "arg-id" or "arg-id:" after the '{' of a replacement field and
+		/// returns the start of its spec.
+		///
+		EASTL_FORMAT_CONSTEXPR inline const char* ParseFormatField(format_parse_context& parseContext, const char* p, const char* pEnd, size_t& id)
+		{
+			p = ParseFormatArgId(parseContext, p, pEnd, id);
+
+			if(p && (p != pEnd))
+			{
+				if(*p == ':')
+					return p + 1;
+				if(*p == '}')
+					return p;
+			}
+
+			if(p)
+				FormatError("format: invalid replacement field");
+			return NULL;
+		}
+
+
+		/// ParseFormatDynamic
+		///
+		/// Parses a width or precision: an integer or a nested replacement field
+		/// naming the argument that holds it.
+		///
+		EASTL_FORMAT_CONSTEXPR inline const char* ParseFormatDynamic(format_parse_context& parseContext, const char* p, const char* pEnd, int& value, int& argId)
+		{
+			if((p != pEnd) && (*p == '{'))
+			{
+				size_t id = 0;
+
+				p = ParseFormatArgId(parseContext, p + 1, pEnd, id);
+				if(p && ((p == pEnd) || (*p != '}')))
+				{
+					FormatError("format: invalid dynamic width or precision");
+					return NULL;
+				}
+
+				argId = (int)id;
+				return p ? (p + 1) : NULL;
+			}
+
+			return ParseFormatInteger(p, pEnd, value);
+		}
+
+
+		/// ParseFormatSpec
+		///
+		/// Parses a standard format spec starting at parseContext.begin() and
+		/// returns the position of the closing '}', or NULL on error.
+		///
+		EASTL_FORMAT_CONSTEXPR inline const char* ParseFormatSpec(format_parse_context& parseContext, FormatSpec& spec)
+		{
+			const char*       p    = parseContext.begin();
+			const char* const pEnd = parseContext.end();
+
+			if((p == pEnd) || (*p == '}'))
+				return p;
+
+			if(((p + 1) != pEnd) && IsFormatAlign(p[1]) && (*p != '{') && (*p != '}'))
+			{
+				spec.mFill  = p[0];
+				spec.mAlign = p[1];
+				p += 2;
+			}
+			else if(IsFormatAlign(*p))
+				spec.mAlign = *p++;
+
+			if((p != pEnd) && ((*p == '+') || (*p == '-') || (*p == ' ')))
+				spec.mSign = *p++;
+
+			if((p != pEnd) && (*p == '#'))
+			{
+				spec.mbAlternate = true;
+				++p;
+			}
+
+			if((p != pEnd) && (*p == '0'))
+			{
+				spec.mbZeroPad = true;
+				++p;
+			}
+
+			p = ParseFormatDynamic(parseContext, p, pEnd, spec.mnWidth, spec.mnWidthArg);
+
+			if(p && (p != pEnd) && (*p == '.'))
+			{
+				++p;
+				if((p == pEnd) || (!IsFormatDigit(*p) && (*p != '{')))
+				{
+					FormatError("format: missing precision");
+					return NULL;
+				}
+				p = ParseFormatDynamic(parseContext, p, pEnd, spec.mnPrecision, spec.mnPrecisionArg);
+			}
+
+			if(!p)
+				return NULL;
+
+			if((p != pEnd) && (*p == 'L'))
+				++p;
+
+			if((p != pEnd) && (*p != '}'))
+				spec.mType = *p++;
+
+			if((p != pEnd) && (*p != '}'))
+			{
+				FormatError("format: invalid format spec");
+				return NULL;
+			}
+
+			return p;
+		}
+
+
+		/// CheckFormatSpec
+		///
+		/// Checks that a parsed spec is valid for an argument of the given type.
+		///
+		EASTL_FORMAT_CONSTEXPR inline bool CheckFormatSpec(const FormatSpec& spec, int type)
+		{
+			const char t = spec.mType;
+			const bool bInteger = (t == 'b') || (t == 'B') || (t == 'd') || (t == 'o') || (t == 'x') || (t == 'X');
+			bool       bNumeric = false;
+			bool       bValid   = false;
+
+			switch(type)
+			{
+				case kFormatArgBool:
+					bNumeric = bInteger;
+					bValid   = (t == 0) || (t == 's') || bInteger;
+					break;
+
+				case kFormatArgChar:
+					bNumeric = bInteger;
+					bValid   = (t == 0) || (t == 'c') || (t == '?') || bInteger;
+					break;
+
+				case kFormatArgInt:
+				case kFormatArgUInt:
+				case kFormatArgLongLong:
+				case kFormatArgULongLong:
+					bNumeric = true;
+					bValid   = (t == 0) || (t == 'c') || bInteger;
+					break;
+
+				case kFormatArgFloat:
+				case kFormatArgDouble:
+					bNumeric = true;
+					bValid   = (t == 0) || (t == 'a') || (t == 'A') || (t == 'e') || (t == 'E') ||
+					           (t == 'f') || (t == 'F') || (t == 'g') || (t == 'G');
+					break;
+
+				case kFormatArgCString:
+				case kFormatArgString:
+					bValid = (t == 0) || (t == 's') || (t == '?');
+					break;
+
+				case kFormatArgPointer:
+					bNumeric = true; // Zero padding is allowed; sign and '#' are rejected below.
+					bValid   = (t == 0) || (t == 'p') || (t == 'P');
+					break;
+			}
+
+			if(!bValid)
+				FormatError("format: invalid presentation type for the argument");
+			else if((spec.mSign || spec.mbAlternate || spec.mbZeroPad) && !bNumeric)
+				FormatError("format: sign, '#' and '0' are only valid for numbers");
+			else if((spec.mSign || spec.mbAlternate) && (type == kFormatArgPointer))
+				FormatError("format: sign and '#' are not valid for pointers");
+			else if(((spec.mnPrecision >= 0) || (spec.mnPrecisionArg >= 0)) &&
+			        (type != kFormatArgFloat) && (type != kFormatArgDouble) && (type != kFormatArgCString) && (type != kFormatArgString))
+				FormatError("format: precision is only valid for floating point and string arguments");
+			else
+				return true;
+
+			return false;
+		}
+
+
+		/// GetFormatDynamicValue
+		///
+		/// Returns the value of an argument used as a width or precision, or -1
+		/// if it is not a non-negative integer.
+		///
+		template <typename Context>
+		inline int GetFormatDynamicValue(const basic_format_arg<Context>& arg)
+		{
+			int64_t value = -1;
+
+			switch(arg.mType)
+			{
+				case kFormatArgInt:       value = arg.mInt;       break;
+				case kFormatArgUInt:      value = arg.mUInt;      break;
+				case kFormatArgLongLong:  value = arg.mLongLong;  break;
+				case kFormatArgULongLong: value = (arg.mULongLong > INT_MAX) ? -1 : (int64_t)arg.mULongLong; break;
+			}
+
+			if((value < 0) || (value > INT_MAX))
+			{
+				FormatError("format: width and precision arguments must be non-negative integers");
+				return -1;
+			}
+
+			return (int)value;
+		}
+
+
+		/// ResolveFormatSpec
+		///
+		/// Replaces a dynamic width or precision with the value of its argument.
+		///
+		inline bool ResolveFormatSpec(FormatSpec& spec, const format_context& context)
+		{
+			if(spec.mnWidthArg >= 0)
+			{
+				spec.mnWidth = GetFormatDynamicValue(context.arg((size_t)spec.mnWidthArg));
+				if(spec.mnWidth < 0)
+					return false;
+			}
+
+			if(spec.mnPrecisionArg >= 0)
+			{
+				spec.mnPrecision = GetFormatDynamicValue(context.arg((size_t)spec.mnPrecisionArg));
+				if(spec.mnPrecision < 0)
+					return false;
+			}
+
+			return true;
+		}
+
+
+		#if EASTL_FORMAT_CONSTEVAL_ENABLED
+			/// SkipFormatCustomSpec
+			///
+			/// Steps over the spec of an argument with a user defined formatter,
+			/// consuming the argument indices of any nested replacement fields as
+			/// the formatter's parse function will.
+			///
+			constexpr const char* SkipFormatCustomSpec(format_parse_context& parseContext, const char* p, const char* pEnd)
+			{
+				for(; (p != pEnd) && (*p != '}'); ++p)
+				{
+					if(*p == '{')
+					{
+						size_t id = 0;
+
+						p = ParseFormatArgId(parseContext, p + 1, pEnd, id);
+						if(!p || (p == pEnd) || (*p != '}'))
+						{
+							FormatError("format: invalid nested replacement field");
+							return NULL;
+						}
+					}
+				}
+
+				return p;
+			}
+
+
+			/// CheckFormatString
+			///
+			/// Walks a format string as vformat_to does, without any output, so that
+			/// every error it would report becomes a compile error.
+			///
+			template <typename... Args>
+			constexpr bool CheckFormatString(basic_string_view<char> fmt)
+			{
+				const int          types[] = { FormatArgKind<Args>::value..., kFormatArgNone };
+				format_parse_context parseContext(fmt, sizeof...(Args));
+				const char*        p    = fmt.data();
+				const char* const  pEnd = p + fmt.size();
+
+				while(p != pEnd)
+				{
+					if(*p == '}')
+					{
+						if(((p + 1) == pEnd) || (p[1] != '}'))
+							FormatError("format: unmatched '}' in format string");
+						p += 2;
+						continue;
+					}
+
+					if(*p++ != '{')
+						continue;
+
+					if((p != pEnd) && (*p == '{'))
+					{
+						++p;
+						continue;
+					}
+
+					size_t id = 0;
+
+					p = ParseFormatField(parseContext, p, pEnd, id);
+					if(!p)
+						return false;
+
+					parseContext.advance_to(p);
+
+					if(types[id] == kFormatArgCustom)
+						p = SkipFormatCustomSpec(parseContext, p, pEnd);
+					else
+					{
+						FormatSpec spec;
+
+						p = ParseFormatSpec(parseContext, spec);
+						if(!p || !CheckFormatSpec(spec, types[id]))
+							return false;
+
+						if(((spec.mnWidthArg >= 0) && !IsFormatIntegerType(types[spec.mnWidthArg])) ||
+						   ((spec.mnPrecisionArg >= 0) && !IsFormatIntegerType(types[spec.mnPrecisionArg])))
+							FormatError("format: width and precision arguments must be integers");
+					}
+
+					if(!p || (p == pEnd))
+					{
+						FormatError("format: missing '}' in format string");
+						return false;
+					}
+					++p;
+				}
+
+				return true;
+			}
+		#endif
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Value output
+		///////////////////////////////////////////////////////////////////////
+
+		/// FormatPadded
+		///
+		/// Writes [p, p + n) aligned within the spec's width.
+		///
+		inline void FormatPadded(FormatSink& sink, const FormatSpec& spec, const char* p, size_t n, char defaultAlign)
+		{
+			const size_t nPad  = ((size_t)spec.mnWidth > n) ? ((size_t)spec.mnWidth - n) : 0;
+			const char   align = spec.mAlign ? spec.mAlign : defaultAlign;
+			const size_t nLeft = (align == '<') ? 0 : (align == '^') ? (nPad / 2) : nPad;
+
+			sink.fill(spec.mFill, nLeft);
+			sink.write(p, n);
+			sink.fill(spec.mFill, nPad - nLeft);
+		}
+
+
+		/// FormatEscapeChar
+		///
+		/// Writes the escaped form of c for the '?' debug presentation to
+		/// pBuffer, which must hold 8 characters, and returns its length.
+		///
+		inline size_t FormatEscapeChar(char c, char quote, char* pBuffer)
+		{
+			const char* pEscape = NULL;
+
+			switch(c)
+			{
+				case '\t': pEscape = "\\t";  break;
+				case '\n': pEscape = "\\n";  break;
+				case '\r': pEscape = "\\r";  break;
+				case '\\': pEscape = "\\\\"; break;
+				case '"':  pEscape = (quote == '"')  ? "\\\"" : NULL; break;
+				case '\'': pEscape = (quote == '\'') ? "\\'"  : NULL; break;
+			}
+
+			if(pEscape)
+			{
+				pBuffer[0] = pEscape[0];
+				pBuffer[1] = pEscape[1];
+				return 2;
+			}
+
+			const unsigned char u = (unsigned char)c;
+
+			if((u < 0x20) || (u == 0x7f))
+			{
+				static const char kHexDigits[] = "0123456789abcdef";
+
+				memcpy(pBuffer, "\\u{", 3);
+				size_t n = 3;
+				if(u >= 0x10)
+					pBuffer[n++] = kHexDigits[u >> 4];
+				pBuffer[n++] = kHexDigits[u & 0xf];
+				pBuffer[n++] = '}';
+				return n;
+			}
+
+			pBuffer[0] = c;
+			return 1;
+		}
+
+
+		/// FormatEscaped
+		///
+		/// Writes [p, p + n) quoted and escaped, padded to the spec's width.
+		///
+		inline void FormatEscaped(FormatSink& sink, const FormatSpec& spec, const char* p, size_t n, char quote)
+		{
+			char         escape[8];
+			size_t       nEscaped = 2;
+			const char*  pEnd     = p + n;
+
+			for(const char* q = p; q != pEnd; ++q)
+				nEscaped += FormatEscapeChar(*q, quote, escape);
+
+			const size_t nPad  = ((size_t)spec.mnWidth > nEscaped) ? ((size_t)spec.mnWidth - nEscaped) : 0;
+			const size_t nLeft = (spec.mAlign == '>') ? nPad : (spec.mAlign == '^') ? (nPad / 2) : 0;
+
+			sink.fill(spec.mFill, nLeft);
+			sink.put(quote);
+			for(; p != pEnd; ++p)
+				sink.write(escape, FormatEscapeChar(*p, quote, escape));
+			sink.put(quote);
+			sink.fill(spec.mFill, nPad - nLeft);
+		}
+
+
+		inline void FormatString(FormatSink& sink, const FormatSpec& spec, const char* p, size_t n)
+		{
+			if((spec.mnPrecision >= 0) && (n > (size_t)spec.mnPrecision))
+				n = (size_t)spec.mnPrecision;
+
+			if(spec.mType == '?')
+				FormatEscaped(sink, spec, p, n, '"');
+			else
+				FormatPadded(sink, spec, p, n, '<');
+		}
+
+
+		/// FormatInteger
+		///
+		/// Writes an integer given as a sign and magnitude with the integer
+		/// presentation types b, B, d, o, x and X.
+		///
+		template <typename Unsigned>
+		inline void FormatInteger(FormatSink& sink, const FormatSpec& spec, Unsigned magnitude, bool bNegative)
+		{
+			char        buffer[4 + (sizeof(Unsigned) * 8)]; // Sign, two character prefix and up to 64 binary digits.
+			char* const pEnd = buffer + sizeof(buffer);
+			const char* pPrefix = "";
+			char*       p;
+
+			switch(spec.mType)
+			{
+				case 'b': p = WriteBaseBackward(pEnd, magnitude, 2);  pPrefix = "0b"; break;
+				case 'B': p = WriteBaseBackward(pEnd, magnitude, 2);  pPrefix = "0B"; break;
+				case 'o': p = WriteBaseBackward(pEnd, magnitude, 8);  pPrefix = magnitude ? "0" : ""; break;
+				case 'x': p = WriteBaseBackward(pEnd, magnitude, 16); pPrefix = "0x"; break;
+				case 'X': p = WriteBaseBackward(pEnd, magnitude, 16); pPrefix = "0X"; break;
+				default:  p = WriteDecimalBackward(pEnd, magnitude);  break;
+			}
+
+			if(spec.mType == 'X')
+			{
+				for(char* q = p; q != pEnd; ++q)
+				{
+					if(*q >= 'a')
+						*q = (char)(*q - ('a' - 'A'));
+				}
+			}
+
+			char* const pDigits = p;
+
+			if(spec.mbAlternate)
+			{
+				const size_t nPrefix = strlen(pPrefix);
+				p -= nPrefix;
+				memcpy(p, pPrefix, nPrefix);
+			}
+
+			if(bNegative)
+				*--p = '-';
+			else if((spec.mSign == '+') || (spec.mSign == ' '))
+				*--p = spec.mSign;
+
+			const size_t n = (size_t)(pEnd - p);
+
+			if(spec.mbZeroPad && !spec.mAlign)
+			{
+				sink.write(p, (size_t)(pDigits - p));
+				sink.fill('0', ((size_t)spec.mnWidth > n) ? ((size_t)spec.mnWidth - n) : 0);
+				sink.write(pDigits, (size_t)(pEnd - pDigits));
+			}
+			else
+				FormatPadded(sink, spec, p, n, '>');
+		}
+
+
+		inline void FormatChar(FormatSink& sink, const FormatSpec& spec, char c)
+		{
+			if(spec.mType == '?')
+				FormatEscaped(sink, spec, &c, 1, '\'');
+			else
+				FormatPadded(sink, spec, &c, 1, '<');
+		}
+
+
+		/// FormatIntegerArg
+		///
+		/// The integer argument types, which can also be presented as a char.
+		///
+		template <typename Unsigned>
+		inline void FormatIntegerArg(FormatSink& sink, const FormatSpec& spec, Unsigned magnitude, bool bNegative)
+		{
+			if(spec.mType == 'c')
+			{
+				if(bNegative ? (magnitude > 128u) : (magnitude > 255u))
+					FormatError("format: integer value out of range for a char");
+				else
+					FormatChar(sink, spec, (char)(bNegative ? (0u - (unsigned)magnitude) : (unsigned)magnitude));
+			}
+			else
+				FormatInteger(sink, spec, magnitude, bNegative);
+		}
+
+
+		inline to_chars_result FormatToCharsPrecision(char* first, char* last, float value, chars_format fmt, int precision, bool bAlternate)
+			{ return ToCharsFloat(first, last, value, fmt, precision, bAlternate); }
+
+		inline to_chars_result FormatToCharsPrecision(char* first, char* last, double value, chars_format fmt, int precision, bool bAlternate)
+			{ return ToCharsDouble(first, last, value, fmt, precision, bAlternate); }
+
+
+		/// FormatFloat
+		///
+		/// Writes a floating point value with the presentation types a, A, e, E,
+		/// f, F, g and G. Without a type and precision the shortest round trip
+		/// representation is written.
+		///
+		template <typename T>
+		inline void FormatFloat(FormatSink& sink, const FormatSpec& spec, T value)
+		{
+			char         buffer[EASTL_FORMAT_FLOAT_BUFFER_SIZE];
+			char* const  first = buffer + 1; // Room for a '+' or ' ' sign.
+			char* const  last  = buffer + sizeof(buffer) - 1;
+			const char   type  = spec.mType;
+			const bool   bUpper = (type == 'A') || (type == 'E') || (type == 'F') || (type == 'G');
+			chars_format fmt    = chars_format::general;
+			to_chars_result result;
+
+			switch(type)
+			{
+				case 'a': case 'A': fmt = chars_format::hex;        break;
+				case 'e': case 'E': fmt = chars_format::scientific; break;
+				case 'f': case 'F': fmt = chars_format::fixed;      break;
+			}
+
+			if((type == 0) && (spec.mnPrecision < 0))
+				result = to_chars(first, last, value);
+			else if(((type == 'a') || (type == 'A')) && (spec.mnPrecision < 0))
+				result = to_chars(first, last, value, fmt);
+			else
+				result = FormatToCharsPrecision(first, last, value, fmt, spec.mnPrecision, spec.mbAlternate);
+
+			if(result.ec != errc())
+			{
+				FormatError("format: floating point value does not fit EASTL_FORMAT_FLOAT_BUFFER_SIZE");
+				return;
+			}
+
+			char*      p     = first;
+			char*      pEnd  = result.ptr;
+			const bool bSpecial = ((pEnd[-1] == 'f') || (pEnd[-1] == 'n')); // "inf" or "nan"
+
+			// '#' guarantees a decimal point; the precision paths have already handled it.
+			if(spec.mbAlternate && !bSpecial && !memchr(first, '.', (size_t)(pEnd - first)))
+			{
+				char* pPoint = pEnd;
+				for(char* q = first; q != pEnd; ++q)
+				{
+					if((*q == 'e') || (*q == 'p'))
+					{
+						pPoint = q;
+						break;
+					}
+				}
+
+				memmove(pPoint + 1, pPoint, (size_t)(pEnd - pPoint));
+				*pPoint = '.';
+				++pEnd;
+			}
+
+			if(bUpper)
+			{
+				for(char* q = p; q != pEnd; ++q)
+				{
+					if((*q >= 'a') && (*q <= 'z'))
+						*q = (char)(*q - ('a' - 'A'));
+				}
+			}
+
+			if((*p != '-') && ((spec.mSign == '+') || (spec.mSign == ' ')))
+				*--p = spec.mSign;
+
+			const size_t n = (size_t)(pEnd - p);
+
+			if(spec.mbZeroPad && !spec.mAlign && !bSpecial)
+			{
+				const size_t nSign = ((*p == '-') || (*p == '+') || (*p == ' ')) ? 1 : 0;
+
+				sink.write(p, nSign);
+				sink.fill('0', ((size_t)spec.mnWidth > n) ? ((size_t)spec.mnWidth - n) : 0);
+				sink.write(p + nSign, n - nSign);
+			}
+			else
+				FormatPadded(sink, spec, p, n, '>');
+		}
+
+
+		inline void FormatPointer(FormatSink& sink, const FormatSpec& spec, const void* pValue)
+		{
+			FormatSpec hexSpec(spec);
+
+			hexSpec.mType      = (spec.mType == 'P') ? 'X' : 'x';
+			hexSpec.mbAlternate = true;
+			FormatInteger(sink, hexSpec, (CharconvUnsigned<sizeof(uintptr_t)>::type)(uintptr_t)pValue, false);
+		}
+
+
+		/// FormatArg
+		///
+		/// Writes a built in argument with a checked and resolved spec.
+		///
+		template <typename Context>
+		inline void FormatArg(FormatSink& sink, const FormatSpec& spec, const basic_format_arg<Context>& arg)
+		{
+			const bool bAsInteger = (spec.mType != 0) && (spec.mType != 'c') && (spec.mType != 's') && (spec.mType != '?');
+
+			switch(arg.mType)
+			{
+				case kFormatArgBool:
+					if(bAsInteger)
+						FormatInteger(sink, spec, (uint32_t)arg.mBool, false);
+					else
+						FormatString(sink, spec, arg.mBool ? "true" : "false", arg.mBool ? 4 : 5);
+					break;
+
+				case kFormatArgChar:
+					if(bAsInteger)
+						FormatInteger(sink, spec, (uint32_t)(unsigned char)arg.mChar, false);
+					else
+						FormatChar(sink, spec, arg.mChar);
+					break;
+
+				case kFormatArgInt:
+					FormatIntegerArg(sink, spec, (arg.mInt < 0) ? (0u - (uint32_t)arg.mInt) : (uint32_t)arg.mInt, arg.mInt < 0);
+					break;
+
+				case kFormatArgUInt:
+					FormatIntegerArg(sink, spec, arg.mUInt, false);
+					break;
+
+				case kFormatArgLongLong:
+					FormatIntegerArg(sink, spec, (arg.mLongLong < 0) ? (0u - (uint64_t)arg.mLongLong) : (uint64_t)arg.mLongLong, arg.mLongLong < 0);
+					break;
+
+				case kFormatArgULongLong:
+					FormatIntegerArg(sink, spec, arg.mULongLong, false);
+					break;
+
+				case kFormatArgFloat:
+					FormatFloat(sink, spec, arg.mFloat);
+					break;
+
+				case kFormatArgDouble:
+					FormatFloat(sink, spec, arg.mDouble);
+					break;
+
+				case kFormatArgCString:
+					FormatString(sink, spec, arg.mpCString, strlen(arg.mpCString));
+					break;
+
+				case kFormatArgString:
+					FormatString(sink, spec, arg.mString.mpData, arg.mString.mnSize);
+					break;
+
+				case kFormatArgPointer:
+					FormatPointer(sink, spec, arg.mpPointer);
+					break;
+			}
+		}
+
+
+		/// FormatCustomArg
+		///
+		/// The type erased call of formatter<T>::parse and format.
+		///
+		template <typename Context, typename T>
+		void FormatCustomArg(basic_format_parse_context<char>& parseContext, Context& context, const void* pValue)
+		{
+			formatter<T, char> f;
+
+			parseContext.advance_to(f.parse(parseContext));
+			context.advance_to(f.format(*static_cast<const T*>(pValue), context));
+		}
+
+
+		/// VFormatTo
+		///
+		/// The one formatting loop that every format function ends up in.
+		///
+		inline void VFormatTo(FormatSink& sink, basic_string_view<char> fmt, format_args args)
+		{
+			format_context       context(FormatSinkIterator(&sink), args);
+			format_parse_context parseContext(fmt, args.size());
+			const char*          p    = fmt.data();
+			const char* const    pEnd = p + fmt.size();
+
+			while(p != pEnd)
+			{
+				const char* const pText = p;
+
+				while((p != pEnd) && (*p != '{') && (*p != '}'))
+					++p;
+
+				sink.write(pText, (size_t)(p - pText));
+
+				if(p == pEnd)
+					break;
+
+				if(*p == '}')
+				{
+					if(((p + 1) == pEnd) || (p[1] != '}'))
+					{
+						FormatError("format: unmatched '}' in format string");
+						return;
+					}
+
+					sink.put('}');
+					p += 2;
+					continue;
+				}
+
+				if(((p + 1) != pEnd) && (p[1] == '{'))
+				{
+					sink.put('{');
+					p += 2;
+					continue;
+				}
+
+				size_t id = 0;
+
+				p = ParseFormatField(parseContext, p + 1, pEnd, id);
+
+				const basic_format_arg<format_context> arg = args.get(id);
+
+				if(!p || !arg)
+					return;
+
+				parseContext.advance_to(p);
+
+				if(arg.mType == kFormatArgCustom)
+				{
+					arg.mCustom.mpFormat(parseContext, context, arg.mCustom.mpObject);
+					p = parseContext.begin();
+				}
+				else
+				{
+					FormatSpec spec;
+
+					p = ParseFormatSpec(parseContext, spec);
+					if(!p || (p == pEnd) || !CheckFormatSpec(spec, arg.mType) || !ResolveFormatSpec(spec, context))
+					{
+						if(p == pEnd)
+							FormatError("format: missing '}' in format string");
+						return;
+					}
+
+					FormatArg(sink, spec, arg);
+				}
+
+				if((p == pEnd) || (*p != '}'))
+				{
+					FormatError("format: missing '}' in format string");
+					return;
+				}
+				++p;
+			}
+		}
+
+
+		template <typename OutputIt>
+		inline OutputIt VFormatToIterator(OutputIt out, basic_string_view<char> fmt, format_args args)
+		{
+			FormatIteratorSink<OutputIt> sink(out);
+			VFormatTo(sink, fmt, args);
+			return sink.out();
+		}
+
+		inline FormatSinkIterator VFormatToIterator(FormatSinkIterator out, basic_string_view<char> fmt, format_args args)
+		{
+			VFormatTo(*out.GetSink(), fmt, args);
+			return out;
+		}
+
+	} // namespace Internal
+
+
+
+	/// basic_format_string
+	///
+	/// A format string checked against the argument types. When consteval is
+	/// available the check happens at compile time and a string that is not a
+	/// constant expression is rejected; use vformat for run time strings.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/basic_format_string
+	///
+	template <typename CharT, typename... Args>
+	class basic_format_string
+	{
+	public:
+		template <typename S, typename = typename enable_if<is_convertible<const S&, basic_string_view<CharT> >::value>::type>
+		EASTL_FORMAT_CONSTEVAL basic_format_string(const S& s)
+			: mString(s)
+		{
+			#if EASTL_FORMAT_CONSTEVAL_ENABLED
+				Internal::CheckFormatString<Args...>(mString);
+			#endif
+		}
+
+		EA_CONSTEXPR basic_string_view<CharT> get() const EA_NOEXCEPT
+			{ return mString; }
+
+	protected:
+		basic_string_view<CharT> mString;
+	};
+
+	template <typename... Args>
+	using format_string = basic_format_string<char, typename type_identity<Args>::type...>;
+
+
+
+	/// format_to_n_result
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/format_to_n
+	///
+	template <typename OutputIt>
+	struct format_to_n_result
+	{
+		OutputIt  out;
+		ptrdiff_t size;
+	};
+
+
+	/// vformat_to
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/vformat_to
+	///
+	template <typename OutputIt>
+	inline OutputIt vformat_to(OutputIt out, string_view fmt, format_args args)
+	{
+		return Internal::VFormatToIterator(out, fmt, args);
+	}
+
+
+	/// format_to
+	///
+	/// Writes the formatted arguments to out and returns the end of the
+	/// output. Nothing is allocated, so with a char buffer, or a
+	/// back_insert_iterator into a fixed_string of sufficient capacity, this
+	/// is safe to use where the heap is not.
+	///
+	/// Example usage:
+	///     char buffer[32];
+	///     *std::format_to(buffer, "{}: {:.2f}", "t", 21.5f) = 0;  // "t: 21.50"
+	///
+	///     std::fixed_string<char, 32, false> s;
+	///     std::format_to(std::back_inserter(s), "{:>6}|{:#x}", 42, 255); // "    42|0xff"
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/format_to
+	///
+	template <typename OutputIt, typename... Args>
+	inline OutputIt format_to(OutputIt out, format_string<Args...> fmt, const Args&... args)
+	{
+		return Internal::VFormatToIterator(out, fmt.get(), make_format_args(args...));
+	}
+
+
+	/// format_to_n
+	///
+	/// Writes at most n characters and returns the end of the output along
+	/// with the size the complete output would have had.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/format_to_n
+	///
+	template <typename OutputIt, typename... Args>
+	inline format_to_n_result<OutputIt> format_to_n(OutputIt out, ptrdiff_t n, format_string<Args...> fmt, const Args&... args)
+	{
+		Internal::FormatLimitedSink<OutputIt> sink(out, (n > 0) ? (size_t)n : 0);
+		Internal::VFormatTo(sink, fmt.get(), make_format_args(args...));
+
+		const format_to_n_result<OutputIt> result = { sink.out(), (ptrdiff_t)sink.count() };
+		return result;
+	}
+
+
+	/// formatted_size
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/formatted_size
+	///
+	template <typename... Args>
+	inline size_t formatted_size(format_string<Args...> fmt, const Args&... args)
+	{
+		Internal::FormatCountingSink sink;
+		Internal::VFormatTo(sink, fmt.get(), make_format_args(args...));
+		return sink.count();
+	}
+
+
+	/// vformat
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/vformat
+	///
+	inline string vformat(string_view fmt, format_args args)
+	{
+		string result;
+		Internal::FormatStringSink<string> sink(result);
+
+		Internal::VFormatTo(sink, fmt, args);
+		sink.Flush();
+		return result;
+	}
+
+
+	/// format
+	///
+	/// Returns the formatted arguments as a string, which allocates; see
+	/// format_to for output that does not.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/format
+	///
+	template <typename... Args>
+	inline string format(format_string<Args...> fmt, const Args&... args)
+	{
+		return vformat(fmt.get(), make_format_args(args...));
+	}
+
+
+
+	/// formatter
+	///
+	/// The formatter for the built in argument types: integers, char, bool,
+	/// floating point, strings and pointers. A user defined formatter can
+	/// derive from one of these to reuse its spec handling.
+	///
+	/// A type is made formattable by specializing formatter for it:
+	///     namespace std
+	///     {
+	///         template <>
+	///         struct formatter<Point>
+	///         {
+	///             format_parse_context::iterator parse(format_parse_context& ctx)
+	///                 { return ctx.begin(); }
+	///
+	///             format_context::iterator format(const Point& p, format_context& ctx) const
+	///                 { return format_to(ctx.out(), "({}, {})", p.x, p.y); }
+	///         };
+	///     }
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/formatter
+	///
+	template <typename T>
+	struct formatter<T, char, typename enable_if<Internal::FormatArgKind<T>::value != Internal::kFormatArgCustom>::type>
+	{
+		EASTL_FORMAT_CONSTEXPR format_parse_context::iterator parse(format_parse_context& ctx)
+		{
+			const char* const p = Internal::ParseFormatSpec(ctx, mSpec);
+
+			if(!p || !Internal::CheckFormatSpec(mSpec, Internal::FormatArgKind<T>::value))
+				return ctx.end();
+			return p;
+		}
+
+		format_context::iterator format(const T& value, format_context& ctx) const
+		{
+			Internal::FormatSpec spec(mSpec);
+
+			if(Internal::ResolveFormatSpec(spec, ctx))
+				Internal::FormatArg(*ctx.out().GetSink(), spec, Internal::MakeFormatArg<format_context>(value));
+			return ctx.out();
+		}
+
+		/// Selects the quoted and escaped presentation that ranges use for their
+		/// char and string elements.
+		void set_debug_format()
+		{
+			const int type = Internal::FormatArgKind<T>::value;
+
+			if((type == Internal::kFormatArgChar) || (type == Internal::kFormatArgCString) || (type == Internal::kFormatArgString))
+				mSpec.mType = '?';
+		}
+
+	protected:
+		Internal::FormatSpec mSpec;
+	};
+
+
+
+	namespace Internal
+	{
+		///////////////////////////////////////////////////////////////////////
+		// Composite values
+		///////////////////////////////////////////////////////////////////////
+
+		/// ParseCompositeSpec
+		///
+		/// Parses the [[fill]align][width] prefix shared by the range, tuple and
+		/// duration specs and returns the position after it.
+		///
+		inline const char* ParseCompositeSpec(format_parse_context& parseContext, FormatSpec& spec)
+		{
+			const char*       p    = parseContext.begin();
+			const char* const pEnd = parseContext.end();
+
+			if(((p + 1) < pEnd) && IsFormatAlign(p[1]) && (*p != '{') && (*p != '}'))
+			{
+				spec.mFill  = p[0];
+				spec.mAlign = p[1];
+				p += 2;
+			}
+			else if((p != pEnd) && IsFormatAlign(*p))
+				spec.mAlign = *p++;
+
+			return ParseFormatDynamic(parseContext, p, pEnd, spec.mnWidth, spec.mnWidthArg);
+		}
+
+
+		inline const char* FinishCompositeSpec(format_parse_context& parseContext, const char* p)
+		{
+			if(!p || ((p != parseContext.end()) && (*p != '}')))
+			{
+				FormatError("format: invalid format spec");
+				return parseContext.end();
+			}
+			return p;
+		}
+
+
+		/// FormatComposite
+		///
+		/// Calls f.FormatContent(value, context), padded to the spec's width. The
+		/// content is measured with a counting pass first when there is a width.
+		///
+		template <typename Formatter, typename T>
+		inline void FormatComposite(const Formatter& f, const FormatSpec& specIn, const T& value, format_context& context)
+		{
+			FormatSpec spec(specIn);
+
+			if(!ResolveFormatSpec(spec, context))
+				return;
+
+			if(spec.mnWidth == 0)
+			{
+				f.FormatContent(value, context);
+				return;
+			}
+
+			FormatCountingSink counter;
+			format_context     counterContext(FormatSinkIterator(&counter), context.GetArgs());
+
+			f.FormatContent(value, counterContext);
+
+			FormatSink&  sink  = *context.out().GetSink();
+			const size_t n     = counter.count();
+			const size_t nPad  = ((size_t)spec.mnWidth > n) ? ((size_t)spec.mnWidth - n) : 0;
+			const size_t nLeft = (spec.mAlign == '>') ? nPad : (spec.mAlign == '^') ? (nPad / 2) : 0;
+
+			sink.fill(spec.mFill, nLeft);
+			f.FormatContent(value, context);
+			sink.fill(spec.mFill, nPad - nLeft);
+		}
+
+
+		template <typename F>
+		inline auto SetFormatterDebug(F& f, int) -> decltype(f.set_debug_format())
+			{ return f.set_debug_format(); }
+
+		template <typename F>
+		inline void SetFormatterDebug(F&, long)
+			{ }
+
+
+		/// FormatElement
+		///
+		/// Formats an element of a tuple with its default spec, quoting chars and
+		/// strings.
+		///
+		template <typename T>
+		inline void FormatElement(const T& value, format_context& context)
+		{
+			formatter<typename remove_cv<T>::type, char> f;
+			format_parse_context                          parseContext(basic_string_view<char>("", 0));
+
+			parseContext.advance_to(f.parse(parseContext));
+			SetFormatterDebug(f, 0);
+			f.format(value, context);
+		}
+
+
+		template <size_t I, size_t N>
+		struct FormatTupleElements
+		{
+			template <typename Tuple>
+			static void Write(const Tuple& t, format_context& context, basic_string_view<char> separator)
+			{
+				if(I != 0)
+					context.out().GetSink()->write(separator.data(), separator.size());
+				FormatElement(get<I>(t), context);
+				FormatTupleElements<I + 1, N>::Write(t, context, separator);
+			}
+		};
+
+		template <size_t N>
+		struct FormatTupleElements<N, N>
+		{
+			template <typename Tuple>
+			static void Write(const Tuple&, format_context&, basic_string_view<char>) { }
+		};
+
+
+		/// FormatTupleBase
+		///
+		/// The formatter of pair and tuple: "(a, b)". The 'n' type drops the
+		/// brackets and 'm' (pairs only) writes "a: b" as map elements do.
+		///
+		template <typename Tuple, size_t N>
+		class FormatTupleBase
+		{
+		public:
+			FormatTupleBase()
+				: mSeparator(", ", 2), mOpening("(", 1), mClosing(")", 1) { }
+
+			void set_separator(basic_string_view<char> separator)                    { mSeparator = separator; }
+			void set_brackets(basic_string_view<char> opening, basic_string_view<char> closing) { mOpening = opening; mClosing = closing; }
+
+			format_parse_context::iterator parse(format_parse_context& parseContext)
+			{
+				const char* p = ParseCompositeSpec(parseContext, mSpec);
+
+				if(p && (p != parseContext.end()))
+				{
+					if(*p == 'n')
+					{
+						set_brackets(basic_string_view<char>(), basic_string_view<char>());
+						++p;
+					}
+					else if((*p == 'm') && (N == 2))
+					{
+						set_brackets(basic_string_view<char>(), basic_string_view<char>());
+						set_separator(basic_string_view<char>(": ", 2));
+						++p;
+					}
+				}
+
+				return FinishCompositeSpec(parseContext, p);
+			}
+
+			format_context::iterator format(const Tuple& value, format_context& context) const
+			{
+				FormatComposite(*this, mSpec, value, context);
+				return context.out();
+			}
+
+			void FormatContent(const Tuple& value, format_context& context) const
+			{
+				FormatSink& sink = *context.out().GetSink();
+
+				sink.write(mOpening.data(), mOpening.size());
+				FormatTupleElements<0, N>::Write(value, context, mSeparator);
+				sink.write(mClosing.data(), mClosing.size());
+			}
+
+		protected:
+			FormatSpec              mSpec;
+			basic_string_view<char> mSeparator;
+			basic_string_view<char> mOpening;
+			basic_string_view<char> mClosing;
+		};
+
+
+		template <typename T, typename = void>
+		struct IsFormatRange : false_type { };
+
+		template <typename T>
+		struct IsFormatRange<T, void_t<decltype(declval<const T&>().begin()), decltype(declval<const T&>().end())>>
+			: integral_constant<bool, FormatArgKind<T>::value == kFormatArgCustom> { };
+
+		template <typename T, typename = void>
+		struct HasFormatKeyType : false_type { };
+
+		template <typename T>
+		struct HasFormatKeyType<T, void_t<typename T::key_type>> : true_type { };
+
+		template <typename T, typename = void>
+		struct HasFormatMappedType : false_type { };
+
+		template <typename T>
+		struct HasFormatMappedType<T, void_t<typename T::mapped_type>> : true_type { };
+
+		template <typename F>
+		inline void SetFormatterMapElement(F&) { }
+
+		template <typename T1, typename T2>
+		inline void SetFormatterMapElement(formatter<pair<T1, T2>, char>& f)
+		{
+			f.set_brackets(basic_string_view<char>(), basic_string_view<char>());
+			f.set_separator(basic_string_view<char>(": ", 2));
+		}
+
+	} // namespace Internal
+
+
+
+	/// formatter<pair>, formatter<tuple>
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/tuple_formatter
+	///
+	template <typename T1, typename T2>
+	struct formatter<pair<T1, T2>, char> : public Internal::FormatTupleBase<pair<T1, T2>, 2> { };
+
+	template <typename... Ts>
+	struct formatter<tuple<Ts...>, char> : public Internal::FormatTupleBase<tuple<Ts...>, sizeof...(Ts)> { };
+
+
+
+	/// formatter for ranges
+	///
+	/// Any type with begin() and end() that is not a string: "[1, 2, 3]", with
+	/// braces for sets and "{k: v, ...}" for maps. The spec is
+	///     [[fill]align][width][n][:element-spec]
+	/// where 'n' drops the brackets and the element spec is handed to the
+	/// element formatter. Char and string elements are quoted by default.
+	///
+	/// http://en.cppreference.com/w/cpp/utility/format/range_formatter
+	///
+	template <typename R>
+	struct formatter<R, char, typename enable_if<Internal::IsFormatRange<R>::value>::type>
+	{
+		typedef typename remove_cv<typename remove_reference<decltype(*declval<const R&>().begin())>::type>::type value_type;
+
+		formatter()
+			: mSeparator(", ", 2), mOpening("[", 1), mClosing("]", 1)
+		{
+			if(Internal::HasFormatKeyType<R>::value)
+			{
+				mOpening = basic_string_view<char>("{", 1);
+				mClosing = basic_string_view<char>("}", 1);
+
+				if(Internal::HasFormatMappedType<R>::value)
+					Internal::SetFormatterMapElement(mUnderlying);
+			}
+		}
+
+		void set_separator(basic_string_view<char> separator)                    { mSeparator = separator; }
+		void set_brackets(basic_string_view<char> opening, basic_string_view<char> closing) { mOpening = opening; mClosing = closing; }
+
+		format_parse_context::iterator parse(format_parse_context& parseContext)
+		{
+			const char* p = Internal::ParseCompositeSpec(parseContext, mSpec);
+
+			if(p && (p != parseContext.end()) && (*p == 'n'))
+			{
+				set_brackets(basic_string_view<char>(), basic_string_view<char>());
+				++p;
+			}
+
+			if(p && (p != parseContext.end()) && (*p == ':'))
+			{
+				parseContext.advance_to(p + 1);
+				p = mUnderlying.parse(parseContext);
+			}
+			else if(p)
+			{
+				parseContext.advance_to(p);
+				p = mUnderlying.parse(parseContext);
+				Internal::SetFormatterDebug(mUnderlying, 0);
+			}
+
+			return Internal::FinishCompositeSpec(parseContext, p);
+		}
+
+		format_context::iterator format(const R& range, format_context& context) const
+		{
+			Internal::FormatComposite(*this, mSpec, range, context);
+			return context.out();
+		}
+
+		void FormatContent(const R& range, format_context& context) const
+		{
+			Internal::FormatSink& sink = *context.out().GetSink();
+
+			bool bFirst = true;
+
+			sink.write(mOpening.data(), mOpening.size());
+			for(auto it = range.begin(), itEnd = range.end(); it != itEnd; ++it, bFirst = false)
+			{
+				if(!bFirst)
+					sink.write(mSeparator.data(), mSeparator.size());
+				mUnderlying.format(*it, context);
+			}
+			sink.write(mClosing.data(), mClosing.size());
+		}
+
+	protected:
+		formatter<value_type, char> mUnderlying;
+		Internal::FormatSpec        mSpec;
+		basic_string_view<char>     mSeparator;
+		basic_string_view<char>     mOpening;
+		basic_string_view<char>     mClosing;
+	};
+
+
+
+	namespace Internal
+	{
+		/// ChronoSuffix
+		///
+		/// The unit suffix of a duration with the given period, such as "ms".
+		///
+		inline basic_string_view<char> ChronoSuffix(intmax_t num, intmax_t den, char* pBuffer, size_t nCapacity)
+		{
+			if(num == 1)
+			{
+				switch(den)
+				{
+					case INTMAX_C(1):                   return basic_string_view<char>("s",  1);
+					case INTMAX_C(10):                  return basic_string_view<char>("ds", 2);
+					case INTMAX_C(100):                 return basic_string_view<char>("cs", 2);
+					case INTMAX_C(1000):                return basic_string_view<char>("ms", 2);
+					case INTMAX_C(1000000):             return basic_string_view<char>("us", 2);
+					case INTMAX_C(1000000000):          return basic_string_view<char>("ns", 2);
+					case INTMAX_C(1000000000000):       return basic_string_view<char>("ps", 2);
+					case INTMAX_C(1000000000000000):    return basic_string_view<char>("fs", 2);
+					case INTMAX_C(1000000000000000000): return basic_string_view<char>("as", 2);
+				}
+			}
+			else if(den == 1)
+			{
+				switch(num)
+				{
+					case INTMAX_C(60):                  return basic_string_view<char>("min", 3);
+					case INTMAX_C(3600):                return basic_string_view<char>("h",   1);
+					case INTMAX_C(86400):               return basic_string_view<char>("d",   1);
+					case INTMAX_C(10):                  return basic_string_view<char>("das", 3);
+					case INTMAX_C(100):                 return basic_string_view<char>("hs",  2);
+					case INTMAX_C(1000):                return basic_string_view<char>("ks",  2);
+					case INTMAX_C(1000000):             return basic_string_view<char>("Ms",  2);
+					case INTMAX_C(1000000000):          return basic_string_view<char>("Gs",  2);
+					case INTMAX_C(1000000000000):       return basic_string_view<char>("Ts",  2);
+					case INTMAX_C(1000000000000000):    return basic_string_view<char>("Ps",  2);
+					case INTMAX_C(1000000000000000000): return basic_string_view<char>("Es",  2);
+				}
+			}
+
+			// "[num]s" or "[num/den]s"
+			char* p = pBuffer + nCapacity;
+
+			memcpy(p -= 2, "]s", 2);
+			if(den != 1)
+			{
+				p = WriteDecimalBackward(p, (uint64_t)den);
+				*--p = '/';
+			}
+			p = WriteDecimalBackward(p, (uint64_t)num);
+			*--p = '[';
+
+			return basic_string_view<char>(p, (size_t)((pBuffer + nCapacity) - p));
+		}
+
+
+		inline void FormatTwoDigits(FormatSink& sink, uint64_t value)
+		{
+			char        buffer[20];
+			char* const pEnd = buffer + sizeof(buffer);
+			char*       p    = WriteDecimalBackward(pEnd, value);
+
+			if((pEnd - p) < 2)
+				*--p = '0';
+			sink.write(p, (size_t)(pEnd - p));
+		}
+
+	} // namespace Internal
+
+
+
+	/// formatter<chrono::duration>
+	///
+	/// Without conversion specs a duration is written as its count followed by
+	/// its unit suffix, "42ms". The spec is
+	///     [[fill]align][width][.precision][chrono-specs]
+	/// where precision applies to floating point counts and chrono-specs is
+	/// literal text mixed with these conversions:
+	///     %Q  the count        %q  the unit suffix
+	///     %H  hours            %M  minutes (00-59)
+	///     %S  seconds (00-59) with the fraction digits of the period
+	///     %R  %H:%M            %T  %H:%M:%S
+	///     %n  newline          %t  tab              %%  '%'
+	///
+	/// http://en.cppreference.com/w/cpp/chrono/duration/formatter
+	///
+	template <typename Rep, typename Period>
+	struct formatter<chrono::duration<Rep, Period>, char>
+	{
+		typedef chrono::duration<Rep, Period> duration_type;
+
+		format_parse_context::iterator parse(format_parse_context& parseContext)
+		{
+			const char* p    = Internal::ParseCompositeSpec(parseContext, mSpec);
+			const char* pEnd = parseContext.end();
+
+			if(p && (p != pEnd) && (*p == '.'))
+			{
+				if(!is_floating_point<Rep>::value)
+				{
+					Internal::FormatError("format: precision is only valid for floating point durations");
+					return pEnd;
+				}
+
+				++p;
+				p = Internal::ParseFormatDynamic(parseContext, p, pEnd, mValueSpec.mnPrecision, mValueSpec.mnPrecisionArg);
+				mValueSpec.mType = 'f';
+			}
+
+			const char* const pChrono = p;
+
+			for(; p && (p != pEnd) && (*p != '}'); ++p)
+			{
+				if(*p == '%')
+				{
+					if(((p + 1) == pEnd) || !p[1] || !strchr("QqHMSRTnt%", p[1]))
+					{
+						Internal::FormatError("format: invalid chrono conversion spec");
+						return pEnd;
+					}
+					++p;
+				}
+				else if(*p == '{')
+				{
+					Internal::FormatError("format: invalid chrono spec");
+					return pEnd;
+				}
+			}
+
+			if(p)
+				mChronoSpec = basic_string_view<char>(pChrono, (size_t)(p - pChrono));
+
+			return Internal::FinishCompositeSpec(parseContext, p);
+		}
+
+		format_context::iterator format(const duration_type& d, format_context& context) const
+		{
+			Internal::FormatComposite(*this, mSpec, d, context);
+			return context.out();
+		}
+
+		void FormatContent(const duration_type& d, format_context& context) const
+		{
+			Internal::FormatSink& sink = *context.out().GetSink();
+			char                  suffixBuffer[48];
+			const basic_string_view<char> suffix = Internal::ChronoSuffix(Period::num, Period::den, suffixBuffer, sizeof(suffixBuffer));
+
+			if(mChronoSpec.empty())
+			{
+				FormatCount(d.count(), context);
+				sink.write(suffix.data(), suffix.size());
+				return;
+			}
+
+			// Split the magnitude into whole seconds and a fraction of a second.
+			const bool     bNegative = d.count() < 0;
+			const uint64_t ticks     = (uint64_t)(bNegative ? -(long long)d.count() : (long long)d.count());
+			const uint64_t scaled    = ticks * (uint64_t)Period::num;
+			const uint64_t seconds   = scaled / (uint64_t)Period::den;
+			uint64_t       fraction  = scaled % (uint64_t)Period::den;
+			int            nFractionDigits = 0;
+
+			if(Period::den != 1)
+			{
+				uint64_t pow10 = 1;
+				while((pow10 < (uint64_t)Period::den) && (nFractionDigits < 18))
+				{
+					pow10 *= 10;
+					++nFractionDigits;
+				}
+
+				if(pow10 != (uint64_t)Period::den)
+				{
+					nFractionDigits = 6;
+					fraction        = (fraction * 1000000u) / (uint64_t)Period::den;
+				}
+			}
+
+			bool bSignWritten = false;
+
+			for(const char* p = mChronoSpec.begin(), *pEnd = mChronoSpec.end(); p != pEnd; ++p)
+			{
+				if(*p != '%')
+				{
+					sink.put(*p);
+					continue;
+				}
+
+				const char c = *++p;
+
+				if(bNegative && !bSignWritten && strchr("HMSRT", c))
+				{
+					sink.put('-');
+					bSignWritten = true;
+				}
+
+				switch(c)
+				{
+					case 'Q': FormatCount(d.count(), context);         break;
+					case 'q': sink.write(suffix.data(), suffix.size()); break;
+					case 'n': sink.put('\n');                           break;
+					case 't': sink.put('\t');                           break;
+					case '%': sink.put('%');                            break;
+					case 'H': Internal::FormatTwoDigits(sink, seconds / 3600u);      break;
+					case 'M': Internal::FormatTwoDigits(sink, (seconds / 60u) % 60u); break;
+
+					case 'R':
+					case 'T':
+						Internal::FormatTwoDigits(sink, seconds / 3600u);
+						sink.put(':');
+						Internal::FormatTwoDigits(sink, (seconds / 60u) % 60u);
+						if(c == 'R')
+							break;
+						sink.put(':');
+						// fall through
+
+					case 'S':
+						Internal::FormatTwoDigits(sink, seconds % 60u);
+						if(nFractionDigits)
+						{
+							char        buffer[24];
+							char* const pBufferEnd = buffer + sizeof(buffer);
+							char*       q          = Internal::WriteDecimalBackward(pBufferEnd, fraction);
+
+							while((pBufferEnd - q) < nFractionDigits)
+								*--q = '0';
+							*--q = '.';
+							sink.write(q, (size_t)(pBufferEnd - q));
+						}
+						break;
+				}
+			}
+		}
+
+	protected:
+		void FormatCount(const Rep& count, format_context& context) const
+		{
+			Internal::FormatSpec spec(mValueSpec);
+
+			if(Internal::ResolveFormatSpec(spec, context))
+				Internal::FormatArg(*context.out().GetSink(), spec, Internal::MakeFormatArg<format_context>(count));
+		}
+
+		Internal::FormatSpec    mSpec;
+		Internal::FormatSpec    mValueSpec;
+		basic_string_view<char> mChronoSpec;
+	};
+
+} // namespace std
+
+
+#endif // Header include guard
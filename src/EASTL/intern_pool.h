@@ -0,0 +1,495 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// intern_pool is a string interning table. Each distinct string that is
+// added to the pool is copied exactly once into an arena owned by the pool
+// and is identified from then on by a small integer handle, an atom.
+//
+// Atoms compare and hash in O(1) (they are just an index), so containers
+// keyed by a fixed vocabulary of names (parameter names, topic names, etc.)
+// can use hash_map<atom, T> or vector_map<atom, T> instead of string_hash_map
+// or string_map, which duplicate and hash or strcmp the full string on every
+// operation.
+//
+// Example usage:
+//     intern_pool<> pool;
+//     hash_map<atom, float> params;
+//
+//     atom gain = pool.find_or_insert("motor.gain");
+//     params[gain] = 1.5f;
+//
+//     atom same = pool.find_or_insert("motor.gain"); // same == gain
+//     const char* pName = pool.c_str(gain);           // "motor.gain"
+//
+// Strings stored in the pool never move, so the string_view and const char*
+// returned by reverse lookup remain valid until the pool is cleared or
+// destroyed. Atom ordering (operator <) is insertion order, not lexical order.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_INTERN_POOL_H
+#define EASTL_INTERN_POOL_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+#include <string.h>
+
+namespace std
+{
+	/// EASTL_INTERN_POOL_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_INTERN_POOL_DEFAULT_NAME
+		#define EASTL_INTERN_POOL_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " intern_pool" // Unless the user overrides something, this is "EASTL intern_pool".
+	#endif
+
+
+	/// EASTL_INTERN_POOL_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_INTERN_POOL_DEFAULT_ALLOCATOR
+		#define EASTL_INTERN_POOL_DEFAULT_ALLOCATOR allocator_type(EASTL_INTERN_POOL_DEFAULT_NAME)
+	#endif
+
+
+
+	/// basic_atom
+	///
+	/// A handle to a string stored in an intern_pool. IndexType is the
+	/// underlying integer (uint16_t or uint32_t); the all-ones value is
+	/// reserved to mean "no string".
+	///
+	template <typename IndexType>
+	class basic_atom
+	{
+	public:
+		typedef IndexType index_type;
+
+		static const index_type npos = (index_type)~(index_type)0;
+
+		EA_CONSTEXPR basic_atom() EA_NOEXCEPT : mIndex(npos) {}
+		EA_CONSTEXPR explicit basic_atom(index_type index) EA_NOEXCEPT : mIndex(index) {}
+
+		EA_CONSTEXPR index_type index() const EA_NOEXCEPT { return mIndex; }
+		EA_CONSTEXPR bool       valid() const EA_NOEXCEPT { return mIndex != npos; }
+
+		EA_CONSTEXPR explicit operator bool() const EA_NOEXCEPT { return valid(); }
+
+	protected:
+		index_type mIndex;
+	};
+
+	template <typename IndexType>
+	const IndexType basic_atom<IndexType>::npos;
+
+	template <typename IndexType>
+	inline EA_CONSTEXPR bool operator==(basic_atom<IndexType> a, basic_atom<IndexType> b) EA_NOEXCEPT
+		{ return a.index() == b.index(); }
+
+	template <typename IndexType>
+	inline EA_CONSTEXPR bool operator!=(basic_atom<IndexType> a, basic_atom<IndexType> b) EA_NOEXCEPT
+		{ return a.index() != b.index(); }
+
+	template <typename IndexType>
+	inline EA_CONSTEXPR bool operator<(basic_atom<IndexType> a, basic_atom<IndexType> b) EA_NOEXCEPT
+		{ return a.index() < b.index(); }
+
+	template <typename IndexType>
+	inline EA_CONSTEXPR bool operator>(basic_atom<IndexType> a, basic_atom<IndexType> b) EA_NOEXCEPT
+		{ return a.index() > b.index(); }
+
+	template <typename IndexType>
+	inline EA_CONSTEXPR bool operator<=(basic_atom<IndexType> a, basic_atom<IndexType> b) EA_NOEXCEPT
+		{ return a.index() <= b.index(); }
+
+	template <typename IndexType>
+	inline EA_CONSTEXPR bool operator>=(basic_atom<IndexType> a, basic_atom<IndexType> b) EA_NOEXCEPT
+		{ return a.index() >= b.index(); }
+
+	typedef basic_atom<uint16_t> atom;
+	typedef basic_atom<uint32_t> atom32;
+
+
+	/// hash<basic_atom>
+	///
+	/// Atoms are dense indices, so the index is already a perfect hash.
+	/// This is what lets hash_map<atom, T> and unordered_map<atom, T> work directly.
+	///
+	template <typename T> struct hash;
+
+	template <typename IndexType>
+	struct hash< basic_atom<IndexType> >
+	{
+		size_t operator()(basic_atom<IndexType> a) const EA_NOEXCEPT
+			{ return (size_t)a.index(); }
+	};
+
+
+
+	/// intern_pool
+	///
+	/// IndexType selects the atom width: uint16_t allows up to 65535 distinct
+	/// strings, uint32_t allows more at the cost of two extra bytes per atom.
+	/// BlockSize is the size of each arena block the string bytes are copied
+	/// into; strings longer than a block get a block of their own.
+	///
+	template <typename IndexType = uint16_t, size_t BlockSize = 256, typename Allocator = EASTLAllocatorType>
+	class intern_pool
+	{
+	public:
+		typedef intern_pool<IndexType, BlockSize, Allocator> this_type;
+		typedef basic_atom<IndexType>                         atom_type;
+		typedef IndexType                                     index_type;
+		typedef Allocator                                     allocator_type;
+		typedef eastl_size_t                                  size_type;
+		typedef std::string_view                              string_view_type;
+
+		static const size_type kBlockSize = BlockSize;
+		static const size_type kMaxSize   = (size_type)atom_type::npos;
+
+	public:
+		explicit intern_pool(const allocator_type& allocator = EASTL_INTERN_POOL_DEFAULT_ALLOCATOR);
+		~intern_pool();
+
+		atom_type        find_or_insert(string_view_type str);   // Returns an invalid atom if the string could not be stored.
+		atom_type        find(string_view_type str) const;
+		bool             contains(string_view_type str) const { return find(str).valid(); }
+
+		string_view_type str(atom_type a) const;
+		const char*      c_str(atom_type a) const;
+		string_view_type operator[](atom_type a) const { return str(a); }
+
+		size_type size() const EA_NOEXCEPT { return (size_type)mEntries.size(); }
+		bool      empty() const EA_NOEXCEPT { return mEntries.empty(); }
+		size_type bytes_used() const EA_NOEXCEPT { return mnBytesUsed; }
+
+		void reserve(size_type n);
+		void clear();
+
+		allocator_type&       get_allocator() EA_NOEXCEPT { return mAllocator; }
+		const allocator_type& get_allocator() const EA_NOEXCEPT { return mAllocator; }
+
+		bool validate() const;
+
+	protected:
+		struct Entry
+		{
+			const char* mpString;
+			size_type   mnLength;
+			size_t      mnHash;
+		};
+
+		struct Block
+		{
+			Block* mpNext;
+		};
+
+		typedef std::vector<Entry, Allocator>      EntryArray;
+		typedef std::vector<index_type, Allocator> BucketArray;
+
+		static size_t DoHash(string_view_type str) EA_NOEXCEPT;
+
+		size_type   DoFindBucket(string_view_type str, size_t h) const;
+		void        DoRehash(size_type nBucketCount);
+		const char* DoCopyString(string_view_type str);
+		void        DoFreeBlocks();
+
+	protected:
+		EntryArray     mEntries;    // Indexed by atom; holds the string location, length and cached hash.
+		BucketArray    mBuckets;    // Open addressing (linear probing) table of atom indices; npos marks an empty slot.
+		Block*         mpBlockHead; // Most recently allocated arena block. Older blocks are linked through mpNext.
+		char*          mpBlockPos;  // Next free byte in mpBlockHead.
+		char*          mpBlockEnd;  // End of mpBlockHead's usable space.
+		size_type      mnBytesUsed;
+		allocator_type mAllocator;
+
+	private:
+		// Atoms returned by one pool are meaningless in another, so copying is not supported.
+		intern_pool(const this_type&) = delete;
+		this_type& operator=(const this_type&) = delete;
+	};
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// intern_pool
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	const typename intern_pool<IndexType, BlockSize, Allocator>::size_type intern_pool<IndexType, BlockSize, Allocator>::kBlockSize;
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	const typename intern_pool<IndexType, BlockSize, Allocator>::size_type intern_pool<IndexType, BlockSize, Allocator>::kMaxSize;
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	inline intern_pool<IndexType, BlockSize, Allocator>::intern_pool(const allocator_type& allocator)
+		: mEntries(allocator)
+		, mBuckets(allocator)
+		, mpBlockHead(NULL)
+		, mpBlockPos(NULL)
+		, mpBlockEnd(NULL)
+		, mnBytesUsed(0)
+		, mAllocator(allocator)
+	{
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	inline intern_pool<IndexType, BlockSize, Allocator>::~intern_pool()
+	{
+		DoFreeBlocks();
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	inline size_t intern_pool<IndexType, BlockSize, Allocator>::DoHash(string_view_type str) EA_NOEXCEPT
+	{
+		return std::hash<string_view_type>()(str);
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	typename intern_pool<IndexType, BlockSize, Allocator>::size_type
+	intern_pool<IndexType, BlockSize, Allocator>::DoFindBucket(string_view_type str, size_t h) const
+	{
+		// Returns the bucket holding str, or the empty bucket where str would be inserted.
+		// The table is never completely full (see find_or_insert), so the probe always terminates.
+		const size_type mask = (size_type)mBuckets.size() - 1;
+
+		for(size_type i = (size_type)h & mask; ; i = (i + 1) & mask)
+		{
+			const index_type index = mBuckets[i];
+
+			if(index == atom_type::npos)
+				return i;
+
+			const Entry& entry = mEntries[index];
+
+			if((entry.mnHash == h) && (entry.mnLength == (size_type)str.size()) && (str.empty() || (memcmp(entry.mpString, str.data(), str.size()) == 0)))
+				return i;
+		}
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	typename intern_pool<IndexType, BlockSize, Allocator>::atom_type
+	intern_pool<IndexType, BlockSize, Allocator>::find(string_view_type str) const
+	{
+		if(mBuckets.empty())
+			return atom_type();
+
+		return atom_type(mBuckets[DoFindBucket(str, DoHash(str))]);
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	typename intern_pool<IndexType, BlockSize, Allocator>::atom_type
+	intern_pool<IndexType, BlockSize, Allocator>::find_or_insert(string_view_type str)
+	{
+		const size_t h = DoHash(str);
+
+		if(!mBuckets.empty())
+		{
+			const index_type index = mBuckets[DoFindBucket(str, h)];
+
+			if(index != atom_type::npos)
+				return atom_type(index);
+		}
+
+		if(mEntries.size() >= kMaxSize)
+		{
+			EASTL_FAIL_MSG("intern_pool::find_or_insert -- atom index space exhausted.");
+			return atom_type();
+		}
+
+		// Grow both tables before the string is copied, and drop the new entry if the
+		// copy fails, so that running out of memory leaves the same strings in the pool.
+		// Keep the load factor at or below 3/4.
+		if(((mEntries.size() + 1) * 4) > (mBuckets.size() * 3))
+			DoRehash(mBuckets.empty() ? 16 : (size_type)mBuckets.size() * 2);
+
+		const index_type index = (index_type)mEntries.size();
+		const Entry      entry = { NULL, (size_type)str.size(), h };
+		const char*      pString;
+
+		mEntries.push_back(entry);
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+				pString = DoCopyString(str);
+			}
+			catch(...)
+			{
+				mEntries.pop_back();
+				throw;
+			}
+		#else
+			pString = DoCopyString(str);
+		#endif
+
+		if(pString == NULL)
+		{
+			mEntries.pop_back();
+			return atom_type();
+		}
+
+		mEntries.back().mpString = pString;
+		mBuckets[DoFindBucket(str, h)] = index;
+
+		return atom_type(index);
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	inline typename intern_pool<IndexType, BlockSize, Allocator>::string_view_type
+	intern_pool<IndexType, BlockSize, Allocator>::str(atom_type a) const
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(a.index() >= mEntries.size()))
+				EASTL_FAIL_MSG("intern_pool::str -- atom does not belong to this pool.");
+		#endif
+
+		const Entry& entry = mEntries[a.index()];
+		return string_view_type(entry.mpString, entry.mnLength);
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	inline const char* intern_pool<IndexType, BlockSize, Allocator>::c_str(atom_type a) const
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(a.index() >= mEntries.size()))
+				EASTL_FAIL_MSG("intern_pool::c_str -- atom does not belong to this pool.");
+		#endif
+
+		return mEntries[a.index()].mpString;
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	void intern_pool<IndexType, BlockSize, Allocator>::reserve(size_type n)
+	{
+		if(n > kMaxSize)
+			n = kMaxSize;
+
+		mEntries.reserve(n);
+
+		size_type nBucketCount = 16;
+		while((n * 4) > (nBucketCount * 3))
+			nBucketCount *= 2;
+
+		if(nBucketCount > mBuckets.size())
+			DoRehash(nBucketCount);
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	void intern_pool<IndexType, BlockSize, Allocator>::clear()
+	{
+		DoFreeBlocks();
+		mEntries.clear();
+		mBuckets.clear();
+		mnBytesUsed = 0;
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	void intern_pool<IndexType, BlockSize, Allocator>::DoRehash(size_type nBucketCount)
+	{
+		mBuckets.assign(nBucketCount, atom_type::npos);
+
+		const size_type mask = nBucketCount - 1;
+
+		for(size_type index = 0, count = (size_type)mEntries.size(); index < count; ++index)
+		{
+			size_type i = (size_type)mEntries[index].mnHash & mask;
+
+			while(mBuckets[i] != atom_type::npos)
+				i = (i + 1) & mask;
+
+			mBuckets[i] = (index_type)index;
+		}
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	const char* intern_pool<IndexType, BlockSize, Allocator>::DoCopyString(string_view_type str)
+	{
+		const size_type n = (size_type)str.size() + 1; // Include the terminating 0 so that c_str works.
+
+		if((size_type)(mpBlockEnd - mpBlockPos) < n)
+		{
+			const size_type nCapacity = (n > kBlockSize) ? n : kBlockSize;
+			Block* const    pBlock    = (Block*)EASTLAlloc(mAllocator, sizeof(Block) + nCapacity);
+
+			if(pBlock == NULL)
+				return NULL;
+
+			pBlock->mpNext = mpBlockHead;
+			mpBlockHead    = pBlock;
+			mpBlockPos     = (char*)(pBlock + 1);
+			mpBlockEnd     = mpBlockPos + nCapacity;
+		}
+
+		char* const pResult = mpBlockPos;
+		if(!str.empty())
+			memcpy(pResult, str.data(), str.size());
+		pResult[str.size()] = 0;
+
+		mpBlockPos  += n;
+		mnBytesUsed += n;
+
+		return pResult;
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	void intern_pool<IndexType, BlockSize, Allocator>::DoFreeBlocks()
+	{
+		while(mpBlockHead)
+		{
+			Block* const pNext = mpBlockHead->mpNext;
+			EASTLFree(mAllocator, mpBlockHead, 0);
+			mpBlockHead = pNext;
+		}
+
+		mpBlockPos = mpBlockEnd = NULL;
+	}
+
+
+	template <typename IndexType, size_t BlockSize, typename Allocator>
+	bool intern_pool<IndexType, BlockSize, Allocator>::validate() const
+	{
+		if(mEntries.size() > kMaxSize)
+			return false;
+
+		if(!mBuckets.empty() && ((mBuckets.size() & (mBuckets.size() - 1)) != 0))
+			return false;
+
+		for(size_type index = 0, count = (size_type)mEntries.size(); index < count; ++index)
+		{
+			const Entry&           entry = mEntries[index];
+			const string_view_type str(entry.mpString, entry.mnLength);
+
+			if((entry.mnHash != DoHash(str)) || (entry.mpString[entry.mnLength] != 0))
+				return false;
+
+			if(mBuckets[DoFindBucket(str, entry.mnHash)] != (index_type)index)
+				return false;
+		}
+
+		return true;
+	}
+
+} // namespace std
+
+#endif // Header include guard
@@ -55,7 +55,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -85,21 +85,21 @@ namespace internal
 	template <typename T>
 	struct is_user_type_suitable_for_primary_template
 	{
-		static EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR_OR_CONST bool value = std::internal::is_atomic_lockfree_size<T>::value;
+		static EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR_OR_CONST bool value = std::Internal::is_atomic_lockfree_size<T>::value;
 	};
 
 
 	template <typename T>
-	using select_atomic_inherit_0 = typename std::conditional<std::is_same<bool, T>::value || std::internal::is_user_type_suitable_for_primary_template<T>::value,
-																std::internal::atomic_base_width<T>, /* True */
-																std::internal::atomic_invalid_type<T> /* False */
+	using select_atomic_inherit_0 = typename std::conditional<std::is_same<bool, T>::value || std::Internal::is_user_type_suitable_for_primary_template<T>::value,
+																std::Internal::atomic_base_width<T>, /* True */
+																std::Internal::atomic_invalid_type<T> /* False */
 																>::type;
 
 	template <typename T>
 	using select_atomic_inherit  = select_atomic_inherit_0<T>;
 
 
-} // namespace internal
+} // namespace Internal
 
 
 #define EASTL_ATOMIC_CLASS_IMPL(type, base, valueType, differenceType)	\
@@ -116,7 +116,7 @@ namespace internal
 																		\
 	public:																\
 																		\
-		static EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR_OR_CONST bool is_always_lock_free = std::internal::is_atomic_lockfree_size<type>::value; \
+		static EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR_OR_CONST bool is_always_lock_free = std::Internal::is_atomic_lockfree_size<type>::value; \
 																		\
 	public: /* deleted ctors && assignment operators */					\
 																		\
@@ -138,7 +138,7 @@ namespace internal
 																		\
 		bool is_lock_free() const EA_NOEXCEPT							\
 		{																\
-			return std::internal::is_atomic_lockfree_size<type>::value; \
+			return std::Internal::is_atomic_lockfree_size<type>::value; \
 		}																\
 																		\
 		bool is_lock_free() const volatile EA_NOEXCEPT					\
@@ -213,18 +213,18 @@ namespace internal
 
 
 template <typename T, typename = void>
-struct atomic : protected std::internal::select_atomic_inherit<T>
+struct atomic : protected std::Internal::select_atomic_inherit<T>
 {
-	EASTL_ATOMIC_CLASS_IMPL(T, std::internal::select_atomic_inherit<T>, T, T)
+	EASTL_ATOMIC_CLASS_IMPL(T, std::Internal::select_atomic_inherit<T>, T, T)
 
 	EASTL_ATOMIC_USING_ATOMIC_BASE(T)
 };
 
 
 template <typename T>
-struct atomic<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<bool, T>::value>> : protected std::internal::atomic_integral_width<T>
+struct atomic<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<bool, T>::value>> : protected std::Internal::atomic_integral_width<T>
 {
-	EASTL_ATOMIC_CLASS_IMPL(T, std::internal::atomic_integral_width<T>, T, T)
+	EASTL_ATOMIC_CLASS_IMPL(T, std::Internal::atomic_integral_width<T>, T, T)
 
 	EASTL_ATOMIC_USING_ATOMIC_BASE(T)
 
@@ -233,9 +233,9 @@ struct atomic<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<bo
 
 
 template <typename T>
-struct atomic<T*> : protected std::internal::atomic_pointer_width<T*>
+struct atomic<T*> : protected std::Internal::atomic_pointer_width<T*>
 {
-	EASTL_ATOMIC_CLASS_IMPL(T*, std::internal::atomic_pointer_width<T*>, T*, ptrdiff_t)
+	EASTL_ATOMIC_CLASS_IMPL(T*, std::Internal::atomic_pointer_width<T*>, T*, ptrdiff_t)
 
 	EASTL_ATOMIC_USING_ATOMIC_BASE(T*)
 
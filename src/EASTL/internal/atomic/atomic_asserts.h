@@ -30,7 +30,7 @@
 	static_assert(std::is_copy_assignable<type>::value, "std::atomic<T> : Template Typename T must be copy assignable!"); \
 	static_assert(std::is_move_assignable<type>::value, "std::atomic<T> : Template Typename T must be move assignable!"); \
 	static_assert(std::is_trivially_destructible<type>::value, "std::atomic<T> : Must be trivially destructible!"); \
-	static_assert(std::internal::is_atomic_lockfree_size<type>::value, "std::atomic<T> : Template Typename T must be a lockfree size!");
+	static_assert(std::Internal::is_atomic_lockfree_size<type>::value, "std::atomic<T> : Template Typename T must be a lockfree size!");
 
 #define EASTL_ATOMIC_STATIC_ASSERT_TYPE_IS_OBJECT(type) \
 	static_assert(std::is_object<type>::value, "std::atomic<T> : Template Typename T must be an object type!");
@@ -44,7 +44,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -66,7 +66,7 @@ namespace internal
 	};
 
 
-} // namespace internal
+} // namespace Internal
 
 
 } // namespace std
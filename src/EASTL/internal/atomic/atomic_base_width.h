@@ -18,7 +18,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -87,94 +87,94 @@ namespace internal
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _RELAXED_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_acquire_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_acquire_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _ACQUIRE_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_release_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_release_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _RELEASE_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_acq_rel_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_acq_rel_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _ACQ_REL_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _SEQ_CST_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_relaxed_s,				\
-				  std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_relaxed_s,				\
+				  std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _RELAXED_RELAXED_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_acquire_s,				\
-				  std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_acquire_s,				\
+				  std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _ACQUIRE_RELAXED_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_acquire_s,				\
-				  std::internal::memory_order_acquire_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_acquire_s,				\
+				  std::Internal::memory_order_acquire_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _ACQUIRE_ACQUIRE_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_release_s,				\
-				  std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_release_s,				\
+				  std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _RELEASE_RELAXED_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_acq_rel_s,				\
-				  std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_acq_rel_s,				\
+				  std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _ACQ_REL_RELAXED_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_acq_rel_s,				\
-				  std::internal::memory_order_acquire_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_acq_rel_s,				\
+				  std::Internal::memory_order_acquire_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _ACQ_REL_ACQUIRE_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_seq_cst_s,				\
-				  std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_seq_cst_s,				\
+				  std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _SEQ_CST_RELAXED_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_seq_cst_s,				\
-				  std::internal::memory_order_acquire_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_seq_cst_s,				\
+				  std::Internal::memory_order_acquire_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _SEQ_CST_ACQUIRE_), bits); \
 	}																	\
 																		\
 	bool funcName(T& expected, T desired,								\
-				  std::internal::memory_order_seq_cst_s,				\
-				  std::internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
+				  std::Internal::memory_order_seq_cst_s,				\
+				  std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
 	{																	\
 		EASTL_ATOMIC_CMPXCHG_FUNC_IMPL(EASTL_ATOMIC_BASE_OP_JOIN(cmpxchgOp, _SEQ_CST_SEQ_CST_), bits); \
 	}
@@ -216,17 +216,17 @@ namespace internal
 			EASTL_ATOMIC_STORE_FUNC_IMPL(EASTL_ATOMIC_STORE_SEQ_CST_, bits); \
 		}																\
 																		\
-		void store(T desired, std::internal::memory_order_relaxed_s) EA_NOEXCEPT	\
+		void store(T desired, std::Internal::memory_order_relaxed_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_STORE_FUNC_IMPL(EASTL_ATOMIC_STORE_RELAXED_, bits); \
 		}																\
 																		\
-		void store(T desired, std::internal::memory_order_release_s) EA_NOEXCEPT	\
+		void store(T desired, std::Internal::memory_order_release_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_STORE_FUNC_IMPL(EASTL_ATOMIC_STORE_RELEASE_, bits); \
 		}																\
 																		\
-		void store(T desired, std::internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
+		void store(T desired, std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_STORE_FUNC_IMPL(EASTL_ATOMIC_STORE_SEQ_CST_, bits); \
 		}																\
@@ -240,17 +240,17 @@ namespace internal
 			EASTL_ATOMIC_LOAD_FUNC_IMPL(EASTL_ATOMIC_LOAD_SEQ_CST_, bits); \
 		}																\
 																		\
-		T load(std::internal::memory_order_relaxed_s) const EA_NOEXCEPT \
+		T load(std::Internal::memory_order_relaxed_s) const EA_NOEXCEPT \
 		{																\
 			EASTL_ATOMIC_LOAD_FUNC_IMPL(EASTL_ATOMIC_LOAD_RELAXED_, bits); \
 		}																\
 																		\
-		T load(std::internal::memory_order_acquire_s) const EA_NOEXCEPT \
+		T load(std::Internal::memory_order_acquire_s) const EA_NOEXCEPT \
 		{																\
 			EASTL_ATOMIC_LOAD_FUNC_IMPL(EASTL_ATOMIC_LOAD_ACQUIRE_, bits); \
 		}																\
 																		\
-		T load(std::internal::memory_order_seq_cst_s) const EA_NOEXCEPT \
+		T load(std::Internal::memory_order_seq_cst_s) const EA_NOEXCEPT \
 		{																\
 			EASTL_ATOMIC_LOAD_FUNC_IMPL(EASTL_ATOMIC_LOAD_SEQ_CST_, bits); \
 		}																\
@@ -264,27 +264,27 @@ namespace internal
 			EASTL_ATOMIC_EXCHANGE_FUNC_IMPL(EASTL_ATOMIC_EXCHANGE_SEQ_CST_, bits); \
 		}																\
 																		\
-		T exchange(T desired, std::internal::memory_order_relaxed_s) EA_NOEXCEPT \
+		T exchange(T desired, std::Internal::memory_order_relaxed_s) EA_NOEXCEPT \
 		{																\
 			EASTL_ATOMIC_EXCHANGE_FUNC_IMPL(EASTL_ATOMIC_EXCHANGE_RELAXED_, bits); \
 		}																\
 																		\
-		T exchange(T desired, std::internal::memory_order_acquire_s) EA_NOEXCEPT	\
+		T exchange(T desired, std::Internal::memory_order_acquire_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_EXCHANGE_FUNC_IMPL(EASTL_ATOMIC_EXCHANGE_ACQUIRE_, bits); \
 		}																\
 																		\
-		T exchange(T desired, std::internal::memory_order_release_s) EA_NOEXCEPT	\
+		T exchange(T desired, std::Internal::memory_order_release_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_EXCHANGE_FUNC_IMPL(EASTL_ATOMIC_EXCHANGE_RELEASE_, bits); \
 		}																\
 																		\
-		T exchange(T desired, std::internal::memory_order_acq_rel_s) EA_NOEXCEPT	\
+		T exchange(T desired, std::Internal::memory_order_acq_rel_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_EXCHANGE_FUNC_IMPL(EASTL_ATOMIC_EXCHANGE_ACQ_REL_, bits); \
 		}																\
 																		\
-		T exchange(T desired, std::internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
+		T exchange(T desired, std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT	\
 		{																\
 			EASTL_ATOMIC_EXCHANGE_FUNC_IMPL(EASTL_ATOMIC_EXCHANGE_SEQ_CST_, bits); \
 		}																\
@@ -334,7 +334,7 @@ namespace internal
 #endif
 
 
-} // namespace internal
+} // namespace Internal
 
 
 } // namespace std
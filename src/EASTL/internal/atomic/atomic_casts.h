@@ -21,7 +21,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -153,7 +153,7 @@ EASTL_FORCE_INLINE ptrdiff_t AtomicNegateOperand(ptrdiff_t val) EA_NOEXCEPT
 }
 
 
-} // namespace internal
+} // namespace Internal
 
 
 } // namespace std
@@ -166,25 +166,25 @@ EASTL_FORCE_INLINE ptrdiff_t AtomicNegateOperand(ptrdiff_t val) EA_NOEXCEPT
  *  Also so that it fits with the style of the rest of the atomic macro implementation.
  */
 #define EASTL_ATOMIC_VOLATILE_CAST(ptr)			\
-	std::internal::AtomicVolatileCast((ptr))
+	std::Internal::AtomicVolatileCast((ptr))
 
 #define EASTL_ATOMIC_VOLATILE_INTEGRAL_CAST(IntegralType, ptr)		\
-	std::internal::AtomicVolatileIntegralCast<IntegralType>((ptr))
+	std::Internal::AtomicVolatileIntegralCast<IntegralType>((ptr))
 
 #define EASTL_ATOMIC_INTEGRAL_CAST(IntegralType, ptr)		\
-	std::internal::AtomicIntegralCast<IntegralType>((ptr))
+	std::Internal::AtomicIntegralCast<IntegralType>((ptr))
 
 #define EASTL_ATOMIC_VOLATILE_TYPE_CAST(ToType, ptr)		\
-	std::internal::AtomicVolatileTypeCast<ToType>((ptr))
+	std::Internal::AtomicVolatileTypeCast<ToType>((ptr))
 
 #define EASTL_ATOMIC_TYPE_CAST(ToType, ptr)			\
-	std::internal::AtomicTypeCast<ToType>((ptr))
+	std::Internal::AtomicTypeCast<ToType>((ptr))
 
 #define EASTL_ATOMIC_TYPE_PUN_CAST(PunType, fromType)		\
-	std::internal::AtomicTypePunCast<PunType>((fromType))
+	std::Internal::AtomicTypePunCast<PunType>((fromType))
 
 #define EASTL_ATOMIC_NEGATE_OPERAND(val)		\
-	std::internal::AtomicNegateOperand((val))
+	std::Internal::AtomicNegateOperand((val))
 
 
 #endif /* EASTL_ATOMIC_INTERNAL_CASTS_H */
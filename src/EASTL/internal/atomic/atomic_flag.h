@@ -53,17 +53,17 @@ public: /* clear */
 		EASTL_ATOMIC_STATIC_ASSERT_INVALID_MEMORY_ORDER(Order);
 	}
 
-	void clear(std::internal::memory_order_relaxed_s) EA_NOEXCEPT
+	void clear(std::Internal::memory_order_relaxed_s) EA_NOEXCEPT
 	{
 		mFlag.store(false, std::memory_order_relaxed);
 	}
 
-	void clear(std::internal::memory_order_release_s) EA_NOEXCEPT
+	void clear(std::Internal::memory_order_release_s) EA_NOEXCEPT
 	{
 		mFlag.store(false, std::memory_order_release);
 	}
 
-	void clear(std::internal::memory_order_seq_cst_s) EA_NOEXCEPT
+	void clear(std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT
 	{
 		mFlag.store(false, std::memory_order_seq_cst);
 	}
@@ -89,27 +89,27 @@ public: /* test_and_set */
 		return false;
 	}
 
-	bool test_and_set(std::internal::memory_order_relaxed_s) EA_NOEXCEPT
+	bool test_and_set(std::Internal::memory_order_relaxed_s) EA_NOEXCEPT
 	{
 		return mFlag.exchange(true, std::memory_order_relaxed);
 	}
 
-	bool test_and_set(std::internal::memory_order_acquire_s) EA_NOEXCEPT
+	bool test_and_set(std::Internal::memory_order_acquire_s) EA_NOEXCEPT
 	{
 		return mFlag.exchange(true, std::memory_order_acquire);
 	}
 
-	bool test_and_set(std::internal::memory_order_release_s) EA_NOEXCEPT
+	bool test_and_set(std::Internal::memory_order_release_s) EA_NOEXCEPT
 	{
 		return mFlag.exchange(true, std::memory_order_release);
 	}
 
-	bool test_and_set(std::internal::memory_order_acq_rel_s) EA_NOEXCEPT
+	bool test_and_set(std::Internal::memory_order_acq_rel_s) EA_NOEXCEPT
 	{
 		return mFlag.exchange(true, std::memory_order_acq_rel);
 	}
 
-	bool test_and_set(std::internal::memory_order_seq_cst_s) EA_NOEXCEPT
+	bool test_and_set(std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT
 	{
 		return mFlag.exchange(true, std::memory_order_seq_cst);
 	}
@@ -135,17 +135,17 @@ public: /* test */
 		return false;
 	}
 
-	bool test(std::internal::memory_order_relaxed_s) const EA_NOEXCEPT
+	bool test(std::Internal::memory_order_relaxed_s) const EA_NOEXCEPT
 	{
 		return mFlag.load(std::memory_order_relaxed);
 	}
 
-	bool test(std::internal::memory_order_acquire_s) const EA_NOEXCEPT
+	bool test(std::Internal::memory_order_acquire_s) const EA_NOEXCEPT
 	{
 		return mFlag.load(std::memory_order_acquire);
 	}
 
-	bool test(std::internal::memory_order_seq_cst_s) const EA_NOEXCEPT
+	bool test(std::Internal::memory_order_seq_cst_s) const EA_NOEXCEPT
 	{
 		return mFlag.load(std::memory_order_seq_cst);
 	}
@@ -18,7 +18,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -180,19 +180,19 @@ namespace internal
 																		\
 	EASTL_ATOMIC_INTEGRAL_FETCH_IMPL(funcName, EASTL_ATOMIC_INTEGRAL_FETCH_OP_JOIN(fetchOp, _SEQ_CST_), bits) \
 																		\
-	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::internal::memory_order_relaxed_s, \
+	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::Internal::memory_order_relaxed_s, \
 										   EASTL_ATOMIC_INTEGRAL_FETCH_OP_JOIN(fetchOp, _RELAXED_), bits) \
 																		\
-	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::internal::memory_order_acquire_s, \
+	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::Internal::memory_order_acquire_s, \
 										   EASTL_ATOMIC_INTEGRAL_FETCH_OP_JOIN(fetchOp, _ACQUIRE_), bits) \
 																		\
-	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::internal::memory_order_release_s, \
+	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::Internal::memory_order_release_s, \
 										   EASTL_ATOMIC_INTEGRAL_FETCH_OP_JOIN(fetchOp, _RELEASE_), bits) \
 																		\
-	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::internal::memory_order_acq_rel_s, \
+	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::Internal::memory_order_acq_rel_s, \
 										   EASTL_ATOMIC_INTEGRAL_FETCH_OP_JOIN(fetchOp, _ACQ_REL_), bits) \
 																		\
-	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::internal::memory_order_seq_cst_s, \
+	EASTL_ATOMIC_INTEGRAL_FETCH_ORDER_IMPL(funcName, std::Internal::memory_order_seq_cst_s, \
 										   EASTL_ATOMIC_INTEGRAL_FETCH_OP_JOIN(fetchOp, _SEQ_CST_), bits)
 
 #define EASTL_ATOMIC_INTEGRAL_FETCH_INC_DEC_OPERATOR_IMPL(operatorOp, preFuncName, postFuncName) \
@@ -331,7 +331,7 @@ namespace internal
 #endif
 
 
-} // namespace internal
+} // namespace Internal
 
 
 } // namespace std
@@ -15,7 +15,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -27,15 +27,15 @@ struct memory_order_acq_rel_s {};
 struct memory_order_seq_cst_s {};
 
 
-} // namespace internal
+} // namespace Internal
 
 
-EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_relaxed = internal::memory_order_relaxed_s{};
-EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_read_depends = internal::memory_order_read_depends_s{};
-EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_acquire = internal::memory_order_acquire_s{};
-EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_release = internal::memory_order_release_s{};
-EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_acq_rel = internal::memory_order_acq_rel_s{};
-EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_seq_cst = internal::memory_order_seq_cst_s{};
+EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_relaxed = Internal::memory_order_relaxed_s{};
+EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_read_depends = Internal::memory_order_read_depends_s{};
+EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_acquire = Internal::memory_order_acquire_s{};
+EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_release = Internal::memory_order_release_s{};
+EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_acq_rel = Internal::memory_order_acq_rel_s{};
+EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR auto memory_order_seq_cst = Internal::memory_order_seq_cst_s{};
 
 
 } // namespace std
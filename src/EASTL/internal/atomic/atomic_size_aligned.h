@@ -18,7 +18,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -185,7 +185,7 @@ namespace internal
 	};
 
 
-} // namespace internal
+} // namespace Internal
 
 
 } // namespace std
@@ -360,27 +360,27 @@ EASTL_FORCE_INLINE void atomic_thread_fence(Order) EA_NOEXCEPT
 	EASTL_ATOMIC_STATIC_ASSERT_INVALID_MEMORY_ORDER(Order);
 }
 
-EASTL_FORCE_INLINE void atomic_thread_fence(std::internal::memory_order_relaxed_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_thread_fence(std::Internal::memory_order_relaxed_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_THREAD_FENCE_RELAXED();
 }
 
-EASTL_FORCE_INLINE void atomic_thread_fence(std::internal::memory_order_acquire_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_thread_fence(std::Internal::memory_order_acquire_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_THREAD_FENCE_ACQUIRE();
 }
 
-EASTL_FORCE_INLINE void atomic_thread_fence(std::internal::memory_order_release_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_thread_fence(std::Internal::memory_order_release_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_THREAD_FENCE_RELEASE();
 }
 
-EASTL_FORCE_INLINE void atomic_thread_fence(std::internal::memory_order_acq_rel_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_thread_fence(std::Internal::memory_order_acq_rel_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_THREAD_FENCE_ACQ_REL();
 }
 
-EASTL_FORCE_INLINE void atomic_thread_fence(std::internal::memory_order_seq_cst_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_thread_fence(std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_THREAD_FENCE_SEQ_CST();
 }
@@ -396,27 +396,27 @@ EASTL_FORCE_INLINE void atomic_signal_fence(Order) EA_NOEXCEPT
 	EASTL_ATOMIC_STATIC_ASSERT_INVALID_MEMORY_ORDER(Order);
 }
 
-EASTL_FORCE_INLINE void atomic_signal_fence(std::internal::memory_order_relaxed_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_signal_fence(std::Internal::memory_order_relaxed_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_SIGNAL_FENCE_RELAXED();
 }
 
-EASTL_FORCE_INLINE void atomic_signal_fence(std::internal::memory_order_acquire_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_signal_fence(std::Internal::memory_order_acquire_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_SIGNAL_FENCE_ACQUIRE();
 }
 
-EASTL_FORCE_INLINE void atomic_signal_fence(std::internal::memory_order_release_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_signal_fence(std::Internal::memory_order_release_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_SIGNAL_FENCE_RELEASE();
 }
 
-EASTL_FORCE_INLINE void atomic_signal_fence(std::internal::memory_order_acq_rel_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_signal_fence(std::Internal::memory_order_acq_rel_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_SIGNAL_FENCE_ACQ_REL();
 }
 
-EASTL_FORCE_INLINE void atomic_signal_fence(std::internal::memory_order_seq_cst_s) EA_NOEXCEPT
+EASTL_FORCE_INLINE void atomic_signal_fence(std::Internal::memory_order_seq_cst_s) EA_NOEXCEPT
 {
 	EASTL_ATOMIC_SIGNAL_FENCE_SEQ_CST();
 }
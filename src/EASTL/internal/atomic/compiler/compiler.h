@@ -33,7 +33,7 @@ namespace std
 {
 
 
-namespace internal
+namespace Internal
 {
 
 
@@ -72,10 +72,10 @@ extern EASTL_API volatile CompilerBarrierDataDependencyFuncPtr gCompilerBarrierD
 
 
 #define EASTL_COMPILER_ATOMIC_COMPILER_BARRIER_DATA_DEPENDENCY_FUNC(ptr) \
-	std::internal::gCompilerBarrierDataDependencyFunc(ptr)
+	std::Internal::gCompilerBarrierDataDependencyFunc(ptr)
 
 
-} // namespace internal
+} // namespace Internal
 
 
 } // namespace std
@@ -40,7 +40,7 @@ EA_RESTORE_ALL_VC_WARNINGS();
 namespace std
 {
 
-namespace internal
+namespace Internal
 {
 
 struct FixedWidth128
@@ -48,11 +48,11 @@ struct FixedWidth128
 	__int64 value[2];
 };
 
-} // namespace internal
+} // namespace Internal
 
 } // namespace std
 
-#define EASTL_COMPILER_ATOMIC_FIXED_WIDTH_TYPE_128 std::internal::FixedWidth128
+#define EASTL_COMPILER_ATOMIC_FIXED_WIDTH_TYPE_128 std::Internal::FixedWidth128
 
 
 /////////////////////////////////////////////////////////////////////////////////
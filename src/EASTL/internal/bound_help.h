@@ -0,0 +1,361 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Binary search kernels behind lower_bound and upper_bound in algorithm.h,
+// for pointer ranges of arithmetic types compared with operator<, less or
+// greater.
+//
+// The loops branch on each comparison, and for keys that aren't known in
+// advance that branch goes either way at random, so about every other step
+// pays a misprediction. The kernels instead halve the range without
+// branching: the comparison only selects which half to keep, which compilers
+// turn into a conditional move. The loop then depends only on the length, and
+// it can also prefetch the two elements the next step may probe, so ranges
+// beyond the caches wait on memory less.
+//
+// interpolation_lower_bound also lives here: it guesses the position of the
+// value from the values at the ends of the range, which for uniformly
+// distributed keys leaves a few elements after two or three guesses.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_BOUND_HELP_H
+#define EASTL_INTERNAL_BOUND_HELP_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/functional.h>
+#include <stddef.h>
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_BOUND_BRANCHLESS
+//
+// Defined as 0 or 1. Enables the branchless kernels below. AVR neither
+// predicts branches nor has a conditional move, so there the loops are
+// already as fast and the kernels would only add code.
+//
+#ifndef EASTL_BOUND_BRANCHLESS
+	#if defined(__AVR__)
+		#define EASTL_BOUND_BRANCHLESS 0
+	#else
+		#define EASTL_BOUND_BRANCHLESS 1
+	#endif
+#endif
+
+#if defined(EA_COMPILER_GNUC) || defined(__clang__)
+	#define EASTL_BOUND_PREFETCH(p) __builtin_prefetch(p)
+#else
+	#define EASTL_BOUND_PREFETCH(p)
+#endif
+
+
+
+namespace std
+{
+	// Defined in algorithm.h.
+	template <typename ForwardIterator, typename T>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T& value);
+
+	namespace Internal
+	{
+		/// is_bound_compare
+		///
+		/// True for the comparisons the kernels may evaluate unconditionally:
+		/// operator< (Compare is void), less and greater.
+		///
+		template <typename Compare>
+		struct is_bound_compare
+		{
+			static const bool value = false;
+		};
+
+		template <>           struct is_bound_compare<void>               { static const bool value = true; };
+		template <typename T> struct is_bound_compare<std::less<T> >      { static const bool value = std::is_arithmetic<T>::value || std::is_void<T>::value; };
+		template <typename T> struct is_bound_compare<std::greater<T> >   { static const bool value = std::is_arithmetic<T>::value || std::is_void<T>::value; };
+
+
+		/// is_bound_branchless
+		///
+		/// True when Iterator is a pointer to an arithmetic type, the searched
+		/// value is arithmetic and Compare is one of is_bound_compare's, so the
+		/// kernels below may stand in for the loops.
+		///
+		template <typename Iterator, typename T, typename Compare = void>
+		struct is_bound_branchless
+		{
+			static const bool value = false;
+		};
+
+		template <typename U, typename T, typename Compare>
+		struct is_bound_branchless<U*, T, Compare>
+		{
+			static const bool value = EASTL_BOUND_BRANCHLESS && !std::is_volatile<U>::value &&
+			                          std::is_arithmetic<U>::value && std::is_arithmetic<T>::value && is_bound_compare<Compare>::value;
+		};
+
+
+		/// bound_imp
+		///
+		/// lower_bound and upper_bound dispatch here, choosing the kernels when
+		/// is_bound_branchless holds.
+		///
+		template <bool bBranchless>
+		struct bound_imp
+		{
+			template <typename ForwardIterator, typename T>
+			static ForwardIterator do_lower_bound(ForwardIterator first, ForwardIterator last, const T& value)
+			{
+				typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
+
+				DifferenceType d = std::distance(first, last); // This will be efficient for a random access iterator such as an array.
+
+				while(d > 0)
+				{
+					ForwardIterator i  = first;
+					DifferenceType  d2 = d >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
+
+					std::advance(i, d2); // This will be efficient for a random access iterator such as an array.
+
+					if(*i < value)
+					{
+						// Disabled because std::lower_bound doesn't specify (23.3.3.3, p3) this can be done: EASTL_VALIDATE_COMPARE(!(value < *i)); // Validate that the compare function is sane.
+						first = ++i;
+						d    -= d2 + 1;
+					}
+					else
+						d = d2;
+				}
+				return first;
+			}
+
+			template <typename ForwardIterator, typename T, typename Compare>
+			static ForwardIterator do_lower_bound(ForwardIterator first, ForwardIterator last, const T& value, Compare compare)
+			{
+				typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
+
+				DifferenceType d = std::distance(first, last); // This will be efficient for a random access iterator such as an array.
+
+				while(d > 0)
+				{
+					ForwardIterator i  = first;
+					DifferenceType  d2 = d >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
+
+					std::advance(i, d2); // This will be efficient for a random access iterator such as an array.
+
+					if(compare(*i, value))
+					{
+						// Disabled because std::lower_bound doesn't specify (23.3.3.1, p3) this can be done: EASTL_VALIDATE_COMPARE(!compare(value, *i)); // Validate that the compare function is sane.
+						first = ++i;
+						d    -= d2 + 1;
+					}
+					else
+						d = d2;
+				}
+				return first;
+			}
+
+			template <typename ForwardIterator, typename T>
+			static ForwardIterator do_upper_bound(ForwardIterator first, ForwardIterator last, const T& value)
+			{
+				typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
+
+				DifferenceType len = std::distance(first, last);
+
+				while(len > 0)
+				{
+					ForwardIterator i    = first;
+					DifferenceType  len2 = len >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
+
+					std::advance(i, len2);
+
+					if(!(value < *i)) // Note that we always express value comparisons in terms of < or ==.
+					{
+						first = ++i;
+						len -= len2 + 1;
+					}
+					else
+					{
+						// Disabled because std::upper_bound doesn't specify (23.3.3.2, p3) this can be done: EASTL_VALIDATE_COMPARE(!(*i < value)); // Validate that the compare function is sane.
+						len = len2;
+					}
+				}
+				return first;
+			}
+
+			template <typename ForwardIterator, typename T, typename Compare>
+			static ForwardIterator do_upper_bound(ForwardIterator first, ForwardIterator last, const T& value, Compare compare)
+			{
+				typedef typename std::iterator_traits<ForwardIterator>::difference_type DifferenceType;
+
+				DifferenceType len = std::distance(first, last);
+
+				while(len > 0)
+				{
+					ForwardIterator i    = first;
+					DifferenceType  len2 = len >> 1; // We use '>>1' here instead of '/2' because MSVC++ for some reason generates significantly worse code for '/2'. Go figure.
+
+					std::advance(i, len2);
+
+					if(!compare(value, *i))
+					{
+						first = ++i;
+						len -= len2 + 1;
+					}
+					else
+					{
+						// Disabled because std::upper_bound doesn't specify (23.3.3.2, p3) this can be done: EASTL_VALIDATE_COMPARE(!compare(*i, value)); // Validate that the compare function is sane.
+						len = len2;
+					}
+				}
+				return first;
+			}
+		};
+
+		template <>
+		struct bound_imp<true>
+		{
+			// The bound lies in [first, first + n]. Each step keeps the upper
+			// half when its first element is before value, so that a length of
+			// n always leaves ceil(n / 2).
+			template <typename U, typename T, typename Compare>
+			static U* do_lower_bound(U* first, U* last, const T& value, Compare compare)
+			{
+				size_t n = size_t(last - first);
+
+				if(n == 0)
+					return first;
+
+				while(n > 1)
+				{
+					const size_t nHalf = n >> 1;
+
+					EASTL_BOUND_PREFETCH(first + (nHalf >> 1));
+					EASTL_BOUND_PREFETCH(first + nHalf + (nHalf >> 1));
+					first += compare(first[nHalf], value) ? nHalf : 0;
+					n     -= nHalf;
+				}
+				return first + (compare(*first, value) ? 1 : 0);
+			}
+
+			template <typename U, typename T, typename Compare>
+			static U* do_upper_bound(U* first, U* last, const T& value, Compare compare)
+			{
+				size_t n = size_t(last - first);
+
+				if(n == 0)
+					return first;
+
+				while(n > 1)
+				{
+					const size_t nHalf = n >> 1;
+
+					EASTL_BOUND_PREFETCH(first + (nHalf >> 1));
+					EASTL_BOUND_PREFETCH(first + nHalf + (nHalf >> 1));
+					first += compare(value, first[nHalf]) ? 0 : nHalf;
+					n     -= nHalf;
+				}
+				return first + (compare(value, *first) ? 0 : 1);
+			}
+
+			// less<void> is operator<, for the overloads without a Compare.
+			template <typename U, typename T>
+			static U* do_lower_bound(U* first, U* last, const T& value)
+				{ return do_lower_bound(first, last, value, std::less<void>()); }
+
+			template <typename U, typename T>
+			static U* do_upper_bound(U* first, U* last, const T& value)
+				{ return do_upper_bound(first, last, value, std::less<void>()); }
+		};
+
+
+		/// do_interpolation_lower_bound
+		///
+		/// Probes where value would be if the values grew linearly from *first to
+		/// *(last - 1). For uniformly distributed values the probe misses by
+		/// about the square root of the length, so a second probe that far past
+		/// it usually brackets the bound and leaves that many elements. A round
+		/// that shrinks the range less than eightfold means the values aren't
+		/// uniform, and lower_bound searches the whole range instead: the middle
+		/// elements it visits first stay cached across searches, which those of
+		/// the narrowed range wouldn't. Other distributions thus cost a round
+		/// more than lower_bound.
+		///
+		template <typename RandomAccessIterator, typename T>
+		RandomAccessIterator do_interpolation_lower_bound(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+		{
+			typedef typename std::iterator_traits<RandomAccessIterator>::difference_type DifferenceType;
+
+			const RandomAccessIterator begin = first;
+			DifferenceType             n     = last - first;
+
+			while(n > 16)
+			{
+				if(!(*first < value))
+					return first;
+				if(first[n - 1] < value)
+					return first + n;
+
+				// *first < value <= first[n - 1], so the bound is in [1, n - 1].
+				const double         fProbe = (double(value) - double(*first)) / (double(first[n - 1]) - double(*first)) * double(n - 1);
+				const DifferenceType i      = (fProbe < double(n - 1)) ? DifferenceType(fProbe) : (n - 1); // Also catches a NaN from infinite values.
+				DifferenceType       nGuard = 1;
+				DifferenceType       nLow   = 0;
+				DifferenceType       nHigh  = n;
+
+				while((nGuard * nGuard) < n)
+					nGuard <<= 1;
+
+				if(first[i] < value)
+				{
+					const DifferenceType j = i + nGuard;
+
+					nLow = i + 1;
+					if(j < n)
+					{
+						if(first[j] < value)
+							nLow = j + 1;
+						else
+							nHigh = j;
+					}
+				}
+				else
+				{
+					const DifferenceType j = i - nGuard;
+
+					nHigh = i;
+					if(j > 0)
+					{
+						if(first[j] < value)
+							nLow = j + 1;
+						else
+							nHigh = j;
+					}
+				}
+
+				// The bound is now in [nLow, nHigh].
+				const DifferenceType nPrevious = n;
+
+				first += nLow;
+				n      = nHigh - nLow;
+
+				if(n > (nPrevious >> 3))
+					return std::lower_bound(begin, last, value);
+			}
+
+			return std::lower_bound(first, first + n, value);
+		}
+
+	} // namespace Internal
+
+} // namespace std
+
+
+#endif // Header include guard
@@ -121,7 +121,7 @@ namespace std
 	};
 
 
-	namespace internal {
+	namespace Internal {
 		// This exists to handle the case when EASTL_ITC_NS is `std`
 		// and the C++ version is older than C++20, in this case
 		// std::contiguous_iterator_tag does not exist so we can't use
@@ -154,7 +154,7 @@ namespace std
 	{
 		typedef typename std::iterator_traits<InputIterator>::iterator_category  IIC;
 
-		const bool canBeMemmoved = internal::can_be_memmoved_helper<InputIterator, OutputIterator>::value;
+		const bool canBeMemmoved = Internal::can_be_memmoved_helper<InputIterator, OutputIterator>::value;
 
 		return std::move_and_copy_helper<IIC, isMove, canBeMemmoved>::move_or_copy(first, last, result); // Need to chose based on the input iterator tag and not the output iterator tag, because containers accept input ranges of iterator types different than self.
 	}
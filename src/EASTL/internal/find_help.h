@@ -0,0 +1,550 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Kernels behind the contiguous-range fast paths of find, count, mismatch,
+// adjacent_find, equal and lexicographical_compare in algorithm.h. They apply
+// to pointer ranges of integral types (and, for the two-range algorithms, of
+// enums and pointers), where equality is equality of the object
+// representation, so many elements can be compared at once:
+//    - find on bytes calls memchr, equal calls memcmp, and so does
+//      lexicographical_compare on unsigned bytes, whose order is memcmp's.
+//    - With SSE2 (and AVX2 when the compiler targets it) they compare a
+//      vector of elements per instruction and turn the result into a bit mask.
+//    - Otherwise they compare a machine word of elements at a time (SWAR).
+// AVR keeps the plain loops apart from memchr, as it has no vector unit and
+// its word is a byte.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_FIND_HELP_H
+#define EASTL_INTERNAL_FIND_HELP_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/utility.h>
+#include <stddef.h>
+#include <string.h> // memchr, memcmp, memcpy
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_FIND_VECTORIZED
+//
+// Defined as 0 or 1. Enables the SSE2/AVX2 and word-at-a-time kernels. They
+// need the GCC/Clang bit scan builtins and a little-endian target.
+//
+#ifndef EASTL_FIND_VECTORIZED
+	#if (defined(EA_COMPILER_GNUC) || defined(__clang__)) && defined(EA_SYSTEM_LITTLE_ENDIAN) && !defined(__AVR__)
+		#define EASTL_FIND_VECTORIZED 1
+	#else
+		#define EASTL_FIND_VECTORIZED 0
+	#endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_FIND_CONSTANT_EVALUATED
+//
+// True while the compiler evaluates a constant expression. equal is
+// constexpr and memcmp can't be evaluated there. Where this can't be known
+// and equal is constexpr, it is always true, and equal keeps its loop.
+//
+#if defined(EA_NO_CPP14_CONSTEXPR)
+	#define EASTL_FIND_CONSTANT_EVALUATED() false
+#elif EA_COMPILER_HAS_BUILTIN(__builtin_is_constant_evaluated) || (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 9))
+	#define EASTL_FIND_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+	#define EASTL_FIND_CONSTANT_EVALUATED() true
+#endif
+
+#if EASTL_FIND_VECTORIZED
+	#if defined(__AVX2__)
+		#define EASTL_FIND_VECTOR_AVX2 1
+		#include <immintrin.h>
+	#elif defined(EA_SSE2) && EA_SSE2
+		#define EASTL_FIND_VECTOR_SSE2 1
+		#include <emmintrin.h>
+	#endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_FIND_VECTOR_BYTES
+//
+// The width of the vector or word the kernels compare at once. Elements
+// wider than that, such as 64 bit integers on 32 bit targets, keep the loops.
+//
+#if defined(EASTL_FIND_VECTOR_AVX2)
+	#define EASTL_FIND_VECTOR_BYTES 32
+#elif defined(EASTL_FIND_VECTOR_SSE2)
+	#define EASTL_FIND_VECTOR_BYTES 16
+#elif EASTL_FIND_VECTORIZED && (EA_PLATFORM_PTR_SIZE != 8)
+	#define EASTL_FIND_VECTOR_BYTES 4
+#else
+	#define EASTL_FIND_VECTOR_BYTES 8
+#endif
+
+
+
+namespace std
+{
+	namespace Internal
+	{
+		/// is_find_vectorizable
+		///
+		/// True when Iterator is a pointer to an integral type of 1, 2, 4 or 8
+		/// bytes, no wider than EASTL_FIND_VECTOR_BYTES, so the kernels below
+		/// may stand in for the element loops.
+		///
+		template <typename Iterator>
+		struct is_find_vectorizable
+		{
+			static const bool value = false;
+		};
+
+		template <typename T>
+		struct is_find_vectorizable<T*>
+		{
+			static const bool value = std::is_integral<T>::value && !std::is_volatile<T>::value &&
+			                          ((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8)) &&
+			                          (sizeof(T) <= EASTL_FIND_VECTOR_BYTES);
+		};
+
+
+		/// is_memcmp_comparable
+		///
+		/// True when Iterator1 and Iterator2 are pointers to the same integral,
+		/// enum or pointer type. Two such ranges are equal exactly when their
+		/// bytes are, which is what equal, mismatch and lexicographical_compare
+		/// need to compare them a block at a time. vector, array, basic_string,
+		/// string_view and span iterators are plain pointers, so they qualify.
+		///
+		template <typename Iterator1, typename Iterator2>
+		struct is_memcmp_comparable
+		{
+			static const bool value = false;
+		};
+
+		template <typename T1, typename T2>
+		struct is_memcmp_comparable<T1*, T2*>
+		{
+			typedef typename std::remove_const<T1>::type value_type;
+
+			static const bool value = std::is_same<value_type, typename std::remove_const<T2>::type>::value && !std::is_volatile<value_type>::value &&
+			                          (std::is_integral<value_type>::value || std::is_enum<value_type>::value || std::is_pointer<value_type>::value);
+		};
+
+
+		#if EASTL_FIND_VECTORIZED
+			inline int find_count_trailing_zeros(uint32_t x) { return __builtin_ctz(x); }
+			inline int find_count_trailing_zeros(uint64_t x) { return __builtin_ctzll(x); }
+			inline int find_popcount(uint32_t x)             { return __builtin_popcount(x); }
+			inline int find_popcount(uint64_t x)             { return __builtin_popcountll(x); }
+
+			template <size_t Size> struct find_lane_bits;
+			template <> struct find_lane_bits<1> { typedef uint8_t  type; };
+			template <> struct find_lane_bits<2> { typedef uint16_t type; };
+			template <> struct find_lane_bits<4> { typedef uint32_t type; };
+			template <> struct find_lane_bits<8> { typedef uint64_t type; };
+
+			template <typename T>
+			inline typename find_lane_bits<sizeof(T)>::type find_lane_value(T value)
+			{
+				typename find_lane_bits<sizeof(T)>::type bits;
+				memcpy(&bits, &value, sizeof(T));
+				return bits;
+			}
+
+			#if defined(EASTL_FIND_VECTOR_AVX2)
+				// Vector policy: load, broadcast, lane compare and one mask bit per byte.
+				template <size_t Size>
+				struct find_vector
+				{
+					typedef __m256i  type;
+					typedef uint32_t mask_type;
+					static const size_t kBytes = 32;
+
+					static type      load(const void* p)     { return _mm256_loadu_si256((const __m256i*)p); }
+					static mask_type mask(type a)            { return (mask_type)_mm256_movemask_epi8(a); }
+					static type      splat(uint8_t v)        { return _mm256_set1_epi8((char)v); }
+					static type      splat(uint16_t v)       { return _mm256_set1_epi16((short)v); }
+					static type      splat(uint32_t v)       { return _mm256_set1_epi32((int)v); }
+					static type      splat(uint64_t v)       { return _mm256_set1_epi64x((long long)v); }
+					static type      equal(type a, type b)
+					{
+						return (Size == 1) ? _mm256_cmpeq_epi8(a, b)  : (Size == 2) ? _mm256_cmpeq_epi16(a, b) :
+						       (Size == 4) ? _mm256_cmpeq_epi32(a, b) : _mm256_cmpeq_epi64(a, b);
+					}
+				};
+			#elif defined(EASTL_FIND_VECTOR_SSE2)
+				template <size_t Size>
+				struct find_vector
+				{
+					typedef __m128i  type;
+					typedef uint32_t mask_type;
+					static const size_t kBytes = 16;
+
+					static type      load(const void* p)     { return _mm_loadu_si128((const __m128i*)p); }
+					static mask_type mask(type a)            { return (mask_type)_mm_movemask_epi8(a); }
+					static type      splat(uint8_t v)        { return _mm_set1_epi8((char)v); }
+					static type      splat(uint16_t v)       { return _mm_set1_epi16((short)v); }
+					static type      splat(uint32_t v)       { return _mm_set1_epi32((int)v); }
+					static type      splat(uint64_t v)       { return _mm_set1_epi64x((long long)v); }
+					static type      equal(type a, type b)
+					{
+						if(Size == 1) return _mm_cmpeq_epi8(a, b);
+						if(Size == 2) return _mm_cmpeq_epi16(a, b);
+
+						const type e = _mm_cmpeq_epi32(a, b);
+						if(Size == 4) return e;
+
+						// SSE2 has no 64 bit compare: both halves of a lane must match.
+						return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+					}
+				};
+			#else
+				// Word-at-a-time policy. mask() leaves the top bit of each all-zero
+				// lane set, so equal() is an xor and the mask marks equal lanes.
+				template <size_t Size>
+				struct find_vector
+				{
+					#if (EA_PLATFORM_PTR_SIZE == 8)
+						typedef uint64_t type;
+					#else
+						typedef uint32_t type;
+					#endif
+					typedef type mask_type;
+					static const size_t kBytes = EASTL_FIND_VECTOR_BYTES;
+
+					static const type kOnes = type(~type(0)) / type(typename find_lane_bits<Size>::type(~0));
+					static const type kHigh = kOnes << (Size * 8 - 1);
+
+					static type load(const void* p)        { type x; memcpy(&x, p, sizeof(x)); return x; }
+					static type splat(type v)              { return v * kOnes; }
+					static type equal(type a, type b)      { return a ^ b; }
+					static mask_type mask(type x)          { return ~(((x & ~kHigh) + ~kHigh) | x) & kHigh; }
+				};
+			#endif
+
+			// The vector masks have a bit per byte, so lane = bit / Size. The word
+			// masks have the top bit of each lane, so lane = bit / (Size * 8).
+			template <typename T>
+			inline const T* find_vectorized(const T* first, const T* last, T value)
+			{
+				typedef find_vector<sizeof(T)> Vector;
+
+				const size_t                 kLanes   = Vector::kBytes / sizeof(T);
+				const int                    kScale   = (sizeof(typename Vector::type) > 8) ? int(sizeof(T)) : int(sizeof(T) * 8);
+				const typename Vector::type  needle   = Vector::splat(find_lane_value(value));
+
+				for(; size_t(last - first) >= kLanes; first += kLanes)
+				{
+					const typename Vector::mask_type mask = Vector::mask(Vector::equal(Vector::load(first), needle));
+
+					if(mask)
+						return first + (find_count_trailing_zeros(mask) / kScale);
+				}
+
+				while((first != last) && !(*first == value))
+					++first;
+				return first;
+			}
+
+			template <typename T>
+			inline size_t count_vectorized(const T* first, const T* last, T value)
+			{
+				typedef find_vector<sizeof(T)> Vector;
+
+				const size_t                 kLanes   = Vector::kBytes / sizeof(T);
+				const int                    kScale   = (sizeof(typename Vector::type) > 8) ? int(sizeof(T)) : 1;
+				const typename Vector::type  needle   = Vector::splat(find_lane_value(value));
+				size_t                       nBits    = 0;
+
+				for(; size_t(last - first) >= kLanes; first += kLanes)
+					nBits += size_t(find_popcount(Vector::mask(Vector::equal(Vector::load(first), needle))));
+
+				size_t result = nBits / size_t(kScale);
+
+				for(; first != last; ++first)
+				{
+					if(*first == value)
+						++result;
+				}
+				return result;
+			}
+
+			// Index of the first element where [first1, first1 + n) and [first2, first2 + n) differ, or n.
+			// This compares bytes, so elements may be wider than the vector; the
+			// element holding the first differing byte is the first that differs.
+			template <typename T>
+			inline size_t mismatch_vectorized(const T* first1, const T* first2, size_t n)
+			{
+				typedef find_vector<1> Vector;
+
+				const unsigned char* const p1     = (const unsigned char*)first1;
+				const unsigned char* const p2     = (const unsigned char*)first2;
+				const size_t               nBytes = n * sizeof(T);
+				size_t                     b      = 0;
+
+				for(; (nBytes - b) >= Vector::kBytes; b += Vector::kBytes)
+				{
+					#if defined(EASTL_FIND_VECTOR_AVX2) || defined(EASTL_FIND_VECTOR_SSE2)
+						const typename Vector::mask_type kAll = typename Vector::mask_type((uint64_t(1) << Vector::kBytes) - 1);
+						const typename Vector::mask_type mask = Vector::mask(Vector::equal(Vector::load(p1 + b), Vector::load(p2 + b))) ^ kAll;
+
+						if(mask)
+							return (b + size_t(find_count_trailing_zeros(mask))) / sizeof(T);
+					#else
+						const typename Vector::type diff = Vector::load(p1 + b) ^ Vector::load(p2 + b);
+
+						if(diff)
+							return (b + size_t(find_count_trailing_zeros(diff) / 8)) / sizeof(T);
+					#endif
+				}
+
+				size_t i = b / sizeof(T);
+
+				while((i != n) && (first1[i] == first2[i]))
+					++i;
+				return i;
+			}
+
+			// Index of the first element equal to the one after it in [first, first + n), or n.
+			template <typename T>
+			inline size_t adjacent_find_vectorized(const T* first, size_t n)
+			{
+				typedef find_vector<sizeof(T)> Vector;
+
+				const size_t kLanes = Vector::kBytes / sizeof(T);
+				const int    kScale = (sizeof(typename Vector::type) > 8) ? int(sizeof(T)) : int(sizeof(T) * 8);
+				size_t       i      = 0;
+
+				for(; (n - i) > kLanes; i += kLanes)
+				{
+					const typename Vector::mask_type mask = Vector::mask(Vector::equal(Vector::load(first + i), Vector::load(first + i + 1)));
+
+					if(mask)
+						return i + size_t(find_count_trailing_zeros(mask) / kScale);
+				}
+
+				for(; (i + 1) < n; ++i)
+				{
+					if(first[i] == first[i + 1])
+						return i;
+				}
+				return n;
+			}
+		#endif
+
+
+		/// find_imp
+		///
+		/// find, count and adjacent_find dispatch here, choosing the kernels
+		/// above when is_find_vectorizable holds. mismatch, equal and
+		/// lexicographical_compare do the same when is_memcmp_comparable holds.
+		///
+		template <bool bVectorizable>
+		struct find_imp
+		{
+			template <typename InputIterator, typename T>
+			static InputIterator do_find(InputIterator first, InputIterator last, const T& value)
+			{
+				while((first != last) && !(*first == value)) // Note that we always express value comparisons in terms of < or ==.
+					++first;
+				return first;
+			}
+
+			template <typename InputIterator, typename T>
+			static typename std::iterator_traits<InputIterator>::difference_type
+			do_count(InputIterator first, InputIterator last, const T& value)
+			{
+				typename std::iterator_traits<InputIterator>::difference_type result = 0;
+
+				for(; first != last; ++first)
+				{
+					if(*first == value)
+						++result;
+				}
+				return result;
+			}
+
+			template <typename InputIterator1, typename InputIterator2>
+			static std::pair<InputIterator1, InputIterator2>
+			do_mismatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+			{
+				while((first1 != last1) && (*first1 == *first2)) // && (first2 != last2) <- C++ standard mismatch function doesn't check first2/last2.
+				{
+					++first1;
+					++first2;
+				}
+
+				return std::pair<InputIterator1, InputIterator2>(first1, first2);
+			}
+
+			template <typename ForwardIterator>
+			static ForwardIterator do_adjacent_find(ForwardIterator first, ForwardIterator last)
+			{
+				if(first != last)
+				{
+					ForwardIterator i = first;
+
+					for(++i; i != last; ++i)
+					{
+						if(*first == *i)
+							return first;
+						first = i;
+					}
+				}
+				return last;
+			}
+
+			template <typename InputIterator1, typename InputIterator2>
+			static EA_CPP14_CONSTEXPR bool do_equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+			{
+				for(; first1 != last1; ++first1, ++first2)
+				{
+					if(!(*first1 == *first2)) // Note that we always express value comparisons in terms of < or ==.
+						return false;
+				}
+				return true;
+			}
+
+			template <typename InputIterator1, typename InputIterator2>
+			static bool do_lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+			{
+				for(; (first1 != last1) && (first2 != last2); ++first1, ++first2)
+				{
+					if(*first1 < *first2)
+						return true;
+					if(*first2 < *first1)
+						return false;
+				}
+				return (first1 == last1) && (first2 != last2);
+			}
+		};
+
+		template <>
+		struct find_imp<true>
+		{
+			// A value that doesn't survive conversion to the element type can't
+			// equal any element, as integral conversions to the wider type used
+			// by == keep distinct values distinct.
+			EA_DISABLE_GCC_WARNING(-Wsign-compare) // The comparison is meant to be the one find's == would make.
+			template <typename T, typename U>
+			static bool representable(const U& value, T& converted)
+			{
+				converted = static_cast<T>(value);
+				return converted == value;
+			}
+			EA_RESTORE_GCC_WARNING()
+
+			template <typename T, typename U>
+			static T* do_find(T* first, T* last, const U& value)
+			{
+				typedef typename std::remove_const<T>::type value_type;
+				value_type v;
+
+				if(!representable(value, v))
+					return last;
+
+				if(sizeof(T) == 1)
+				{
+					const void* p = (first != last) ? memchr(first, find_lane_value_byte(v), size_t(last - first)) : NULL;
+					return p ? first + ((const unsigned char*)p - (const unsigned char*)first) : last;
+				}
+
+				#if EASTL_FIND_VECTORIZED
+					return first + (find_vectorized<value_type>(first, last, v) - first);
+				#else
+					return find_imp<false>::do_find(first, last, v);
+				#endif
+			}
+
+			template <typename T, typename U>
+			static ptrdiff_t do_count(T* first, T* last, const U& value)
+			{
+				typedef typename std::remove_const<T>::type value_type;
+				value_type v;
+
+				if(!representable(value, v))
+					return 0;
+
+				#if EASTL_FIND_VECTORIZED
+					// Compilers already vectorize the plain loop for wide lanes; mask popcounts only pay off for narrow ones.
+					if(sizeof(value_type) <= 2)
+						return ptrdiff_t(count_vectorized<value_type>(first, last, v));
+				#endif
+				return find_imp<false>::do_count(first, last, v);
+			}
+
+			template <typename T1, typename T2>
+			static std::pair<T1*, T2*> do_mismatch(T1* first1, T1* last1, T2* first2)
+			{
+				#if EASTL_FIND_VECTORIZED
+					const size_t i = mismatch_vectorized<typename std::remove_const<T1>::type>(first1, first2, size_t(last1 - first1));
+					return std::pair<T1*, T2*>(first1 + i, first2 + i);
+				#else
+					return find_imp<false>::do_mismatch(first1, last1, first2);
+				#endif
+			}
+
+			// memcmp isn't given the null pointers of empty containers, even with a size of 0.
+			template <typename T1, typename T2>
+			static EA_CPP14_CONSTEXPR bool do_equal(T1* first1, T1* last1, T2* first2)
+			{
+				if(!EASTL_FIND_CONSTANT_EVALUATED())
+					return (first1 == last1) || (memcmp(first1, first2, size_t(last1 - first1) * sizeof(T1)) == 0);
+				return find_imp<false>::do_equal(first1, last1, first2);
+			}
+
+			// memcmp orders unsigned bytes the way < does. Other types compare
+			// only the first elements that differ.
+			template <typename T1, typename T2>
+			static bool do_lexicographical_compare(T1* first1, T1* last1, T2* first2, T2* last2)
+			{
+				typedef typename std::remove_const<T1>::type value_type;
+
+				const size_t n1 = size_t(last1 - first1);
+				const size_t n2 = size_t(last2 - first2);
+				const size_t n  = (n1 < n2) ? n1 : n2;
+
+				if(std::is_unsigned<value_type>::value && (sizeof(value_type) == 1))
+				{
+					const int result = n ? memcmp(first1, first2, n) : 0;
+					return result ? (result < 0) : (n1 < n2);
+				}
+
+				const size_t i = size_t(do_mismatch(first1, first1 + n, first2).first - first1);
+				return (i != n) ? (first1[i] < first2[i]) : (n1 < n2);
+			}
+
+			template <typename T>
+			static T* do_adjacent_find(T* first, T* last)
+			{
+				#if EASTL_FIND_VECTORIZED
+					return first + adjacent_find_vectorized(first, size_t(last - first));
+				#else
+					return find_imp<false>::do_adjacent_find(first, last);
+				#endif
+			}
+
+		private:
+			template <typename T>
+			static int find_lane_value_byte(T value)
+			{
+				unsigned char c;
+				memcpy(&c, &value, 1);
+				return c;
+			}
+		};
+
+	} // namespace Internal
+
+} // namespace std
+
+
+#endif // Header include guard
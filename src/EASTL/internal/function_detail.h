@@ -48,7 +48,7 @@ namespace std
 		};
 	#endif
 
-	namespace internal
+	namespace Internal
 	{
 		class unused_class {};
 
@@ -626,7 +626,7 @@ namespace std
 				using DecayedFunctorType = typename std::decay<Functor>::type;
 				using FunctionManagerType = typename Base::template function_manager<DecayedFunctorType, R, Args...>;
 
-				if (internal::is_null(functor))
+				if (Internal::is_null(functor))
 				{
 					mMgrFuncPtr = nullptr;
 					mInvokeFuncPtr = &DefaultInvoker;
@@ -666,7 +666,7 @@ namespace std
 			InvokeFuncPtr mInvokeFuncPtr = &DefaultInvoker;
 		};
 
-	} // namespace internal
+	} // namespace Internal
 
 } // namespace std
 
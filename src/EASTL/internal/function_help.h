@@ -14,7 +14,7 @@
 
 namespace std
 {
-	namespace internal
+	namespace Internal
 	{
 
 		//////////////////////////////////////////////////////////////////////
@@ -44,7 +44,7 @@ namespace std
 			return function_pointer == nullptr;
 		}
 
-	} // namespace internal
+	} // namespace Internal
 } // namespace std
 
 #endif // Header include guard
@@ -81,7 +81,7 @@ using make_index_sequence = make_integer_sequence<size_t, N>;
 template<typename... T>
 using index_sequence_for = make_index_sequence<sizeof...(T)>;
 
-namespace internal
+namespace Internal
 {
 
 template <typename T>
@@ -110,7 +110,7 @@ template <typename T>
 EASTL_CPP17_INLINE_VARIABLE EA_CONSTEXPR size_t index_sequence_size_v = index_sequence_size<T>::value;
 #endif
 
-} // namespace internal
+} // namespace Internal
 
 #endif  // EASTL_VARIADIC_TEMPLATES_ENABLED
 
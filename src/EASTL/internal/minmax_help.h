@@ -0,0 +1,397 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Kernels behind the contiguous-range fast paths of min_element, max_element,
+// minmax_element and clamp_transform in algorithm.h, for pointer ranges of
+// arithmetic types. The scalar loops branch on every element; these instead
+// reduce a vector of lanes at a time to the smallest and largest values, then
+// find the first (or, for minmax_element's largest, the last) element that
+// equals the result. That is the element the loops return, as both keep the
+// first of any equal candidates.
+//
+// A NaN compares false with everything, which makes the loops' answer depend
+// on where it sits. The reductions notice NaNs and leave those ranges to the
+// loops, so the result is always theirs. clamp_transform needs no such care:
+// its selects keep a NaN where clamp does.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_MINMAX_HELP_H
+#define EASTL_INTERNAL_MINMAX_HELP_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/functional_base.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/utility.h>
+#include <stddef.h>
+#include <string.h> // memcpy
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_MINMAX_VECTORIZED
+//
+// Defined as 0 or 1. Enables the kernels below, written with the GCC/Clang
+// vector extensions. They are only worthwhile with a vector unit (SSE2 or
+// NEON); elsewhere the compiler would split every vector into scalars.
+//
+#ifndef EASTL_MINMAX_VECTORIZED
+	#if (defined(EA_COMPILER_GNUC) || defined(__clang__)) && !defined(__AVR__) && ((defined(EA_SSE2) && EA_SSE2) || defined(__ARM_NEON))
+		#define EASTL_MINMAX_VECTORIZED 1
+	#else
+		#define EASTL_MINMAX_VECTORIZED 0
+	#endif
+#endif
+
+#if EASTL_MINMAX_VECTORIZED
+	#if defined(__AVX2__)
+		#define EASTL_MINMAX_VECTOR_BYTES 32
+	#else
+		#define EASTL_MINMAX_VECTOR_BYTES 16
+	#endif
+#endif
+
+// SSE2 and 32 bit NEON have no 64 bit integer compare, and emulating it is
+// slower than the loops.
+#if EASTL_MINMAX_VECTORIZED && (defined(__SSE4_2__) || defined(__aarch64__))
+	#define EASTL_MINMAX_VECTOR_INT64 1
+#else
+	#define EASTL_MINMAX_VECTOR_INT64 0
+#endif
+
+
+
+namespace std
+{
+	// Defined in algorithm.h.
+	template <typename ForwardIterator, typename Compare>
+	std::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last, Compare compare);
+
+	namespace Internal
+	{
+		/// minmax_lane
+		///
+		/// The type the kernels compute T in: T itself for float and double,
+		/// and the standard integer of T's size and signedness otherwise, so
+		/// that char16_t and the like order the same way in a vector lane.
+		///
+		template <typename T, bool bFloat = std::is_floating_point<T>::value>
+		struct minmax_lane
+		{
+			typedef T type;
+		};
+
+		template <typename T>
+		struct minmax_lane<T, false>
+		{
+			typedef typename std::conditional<std::is_signed<T>::value, typename std::make_signed<T>::type,
+			                                                            typename std::make_unsigned<T>::type>::type type;
+		};
+
+
+		/// is_minmax_vectorizable
+		///
+		/// True when Iterator is a pointer to an arithmetic type other than bool
+		/// and long double, so the kernels below may stand in for the loops.
+		/// 64 bit integers need EASTL_MINMAX_VECTOR_INT64.
+		///
+		template <typename Iterator>
+		struct is_minmax_vectorizable
+		{
+			static const bool value = false;
+		};
+
+		template <typename T>
+		struct is_minmax_vectorizable<T*>
+		{
+			typedef typename std::remove_const<T>::type value_type;
+
+			static const bool value = EASTL_MINMAX_VECTORIZED && !std::is_volatile<value_type>::value &&
+			                          (std::is_integral<value_type>::value || std::is_same<value_type, float>::value || std::is_same<value_type, double>::value) &&
+			                          !std::is_same<value_type, bool>::value &&
+			                          ((sizeof(value_type) == 1) || (sizeof(value_type) == 2) || (sizeof(value_type) == 4) || (sizeof(value_type) == 8)) &&
+			                          ((sizeof(value_type) != 8) || std::is_floating_point<value_type>::value || EASTL_MINMAX_VECTOR_INT64);
+		};
+
+
+		/// is_clamp_vectorizable
+		///
+		/// True when clamp_transform reads and writes pointer ranges of the same
+		/// type for which is_minmax_vectorizable holds.
+		///
+		template <typename InputIterator, typename OutputIterator>
+		struct is_clamp_vectorizable
+		{
+			static const bool value = false;
+		};
+
+		template <typename T, typename U>
+		struct is_clamp_vectorizable<T*, U*>
+		{
+			static const bool value = is_minmax_vectorizable<T*>::value && !std::is_const<U>::value &&
+			                          std::is_same<typename std::remove_const<T>::type, U>::value;
+		};
+
+
+		#if EASTL_MINMAX_VECTORIZED
+			// Vector of the lanes of T, with the mask type its comparisons produce.
+			template <typename T>
+			struct minmax_vector
+			{
+				typedef typename minmax_lane<T>::type lane_type;
+				typedef lane_type type __attribute__((vector_size(EASTL_MINMAX_VECTOR_BYTES)));
+				typedef decltype(type() < type()) mask_type;
+
+				static const size_t kLanes = EASTL_MINMAX_VECTOR_BYTES / sizeof(T);
+
+				static type load(const T* p)       { type v; memcpy(&v, p, sizeof(v)); return v; }
+				static void store(T* p, type v)    { memcpy(p, &v, sizeof(v)); }
+				static type splat(lane_type value) { return value - type(); } // Not type() + value, which makes -0.0 into 0.0.
+
+				static lane_type lane(T value)     { lane_type x; memcpy(&x, &value, sizeof(x)); return x; }
+
+				static bool any(mask_type mask)
+				{
+					for(size_t k = 0; k < kLanes; ++k)
+					{
+						if(mask[k])
+							return true;
+					}
+					return false;
+				}
+			};
+
+			// Reduces [first, first + n), n > 0, to its smallest and largest values.
+			// Returns false, leaving the range to the loops, if it holds a NaN.
+			template <typename T, bool bMin, bool bMax>
+			inline bool minmax_reduce(const T* first, size_t n, typename minmax_vector<T>::lane_type& lo, typename minmax_vector<T>::lane_type& hi)
+			{
+				typedef minmax_vector<T>              Vector;
+				typedef typename Vector::lane_type    lane_type;
+				typedef typename Vector::type         vector_type;
+				typedef typename Vector::mask_type    mask_type;
+
+				const bool bFloat = std::is_floating_point<T>::value;
+				size_t     i      = 0;
+
+				lo = hi = Vector::lane(first[0]);
+
+				if(n >= Vector::kLanes)
+				{
+					vector_type vlo       = Vector::load(first);
+					vector_type vhi       = vlo;
+					mask_type   unordered = (vlo != vlo);
+
+					for(i = Vector::kLanes; (n - i) >= Vector::kLanes; i += Vector::kLanes)
+					{
+						const vector_type v = Vector::load(first + i);
+
+						if(bMin)
+							vlo = (v < vlo) ? v : vlo;
+						if(bMax)
+							vhi = (vhi < v) ? v : vhi;
+						if(bFloat)
+							unordered |= (v != v);
+					}
+
+					if(bFloat && Vector::any(unordered))
+						return false;
+
+					for(size_t k = 0; k < Vector::kLanes; ++k)
+					{
+						if(vlo[k] < lo)
+							lo = vlo[k];
+						if(hi < vhi[k])
+							hi = vhi[k];
+					}
+				}
+
+				for(; i < n; ++i)
+				{
+					const lane_type x = Vector::lane(first[i]);
+
+					if(bFloat && (x != x))
+						return false;
+					if(x < lo)
+						lo = x;
+					if(hi < x)
+						hi = x;
+				}
+				return true;
+			}
+
+			// First element of [first, first + n) equal to value, which must be present.
+			template <typename T>
+			inline size_t minmax_find_first(const T* first, size_t n, typename minmax_vector<T>::lane_type value)
+			{
+				typedef minmax_vector<T> Vector;
+
+				const typename Vector::type needle = Vector::splat(value);
+				size_t                      i      = 0;
+
+				while(((n - i) >= Vector::kLanes) && !Vector::any(Vector::load(first + i) == needle))
+					i += Vector::kLanes;
+				while(!(Vector::lane(first[i]) == value))
+					++i;
+				return i;
+			}
+
+			// Last element of [first, first + n) equal to value, which must be present.
+			template <typename T>
+			inline size_t minmax_find_last(const T* first, size_t n, typename minmax_vector<T>::lane_type value)
+			{
+				typedef minmax_vector<T> Vector;
+
+				const typename Vector::type needle = Vector::splat(value);
+				size_t                      i      = n;
+
+				while((i >= Vector::kLanes) && !Vector::any(Vector::load(first + i - Vector::kLanes) == needle))
+					i -= Vector::kLanes;
+				while(!(Vector::lane(first[i - 1]) == value))
+					--i;
+				return i - 1;
+			}
+		#endif
+
+
+		/// minmax_imp
+		///
+		/// min_element, max_element, minmax_element and clamp_transform dispatch
+		/// here, choosing the kernels above when is_minmax_vectorizable holds.
+		///
+		template <bool bVectorizable>
+		struct minmax_imp
+		{
+			template <typename ForwardIterator>
+			static ForwardIterator do_min_element(ForwardIterator first, ForwardIterator last)
+			{
+				if(first != last)
+				{
+					ForwardIterator currentMin = first;
+
+					while(++first != last)
+					{
+						if(*first < *currentMin)
+							currentMin = first;
+					}
+					return currentMin;
+				}
+				return first;
+			}
+
+			template <typename ForwardIterator>
+			static ForwardIterator do_max_element(ForwardIterator first, ForwardIterator last)
+			{
+				if(first != last)
+				{
+					ForwardIterator currentMax = first;
+
+					while(++first != last)
+					{
+						if(*currentMax < *first)
+							currentMax = first;
+					}
+					return currentMax;
+				}
+				return first;
+			}
+
+			template <typename ForwardIterator>
+			static std::pair<ForwardIterator, ForwardIterator> do_minmax_element(ForwardIterator first, ForwardIterator last)
+			{
+				typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+
+				return std::minmax_element(first, last, std::less<value_type>());
+			}
+
+			template <typename InputIterator, typename OutputIterator, typename T>
+			static OutputIterator do_clamp_transform(InputIterator first, InputIterator last, OutputIterator result, const T& lo, const T& hi)
+			{
+				for(; first != last; ++first, ++result)
+					*result = (*first < lo) ? lo : ((hi < *first) ? hi : *first);
+				return result;
+			}
+		};
+
+		#if EASTL_MINMAX_VECTORIZED
+			template <>
+			struct minmax_imp<true>
+			{
+				template <typename T>
+				static T* do_min_element(T* first, T* last)
+				{
+					typedef typename std::remove_const<T>::type                  value_type;
+					typedef typename minmax_vector<value_type>::lane_type        lane_type;
+
+					const size_t n = size_t(last - first);
+					lane_type    lo, hi;
+
+					if(n && minmax_reduce<value_type, true, false>(first, n, lo, hi))
+						return first + minmax_find_first(first, n, lo);
+					return minmax_imp<false>::do_min_element(first, last);
+				}
+
+				template <typename T>
+				static T* do_max_element(T* first, T* last)
+				{
+					typedef typename std::remove_const<T>::type                  value_type;
+					typedef typename minmax_vector<value_type>::lane_type        lane_type;
+
+					const size_t n = size_t(last - first);
+					lane_type    lo, hi;
+
+					if(n && minmax_reduce<value_type, false, true>(first, n, lo, hi))
+						return first + minmax_find_first(first, n, hi);
+					return minmax_imp<false>::do_max_element(first, last);
+				}
+
+				// minmax_element returns the last of the largest elements.
+				template <typename T>
+				static std::pair<T*, T*> do_minmax_element(T* first, T* last)
+				{
+					typedef typename std::remove_const<T>::type                  value_type;
+					typedef typename minmax_vector<value_type>::lane_type        lane_type;
+
+					const size_t n = size_t(last - first);
+					lane_type    lo, hi;
+
+					if(n && minmax_reduce<value_type, true, true>(first, n, lo, hi))
+						return std::pair<T*, T*>(first + minmax_find_first(first, n, lo), first + minmax_find_last(first, n, hi));
+					return minmax_imp<false>::do_minmax_element(first, last);
+				}
+
+				// Selecting lo where x < lo, then hi where hi < that, is clamp, NaNs included.
+				template <typename T, typename U>
+				static U* do_clamp_transform(T* first, T* last, U* result, const U& lo, const U& hi)
+				{
+					typedef minmax_vector<U>            Vector;
+					typedef typename Vector::type       vector_type;
+
+					const vector_type vlo = Vector::splat(Vector::lane(lo));
+					const vector_type vhi = Vector::splat(Vector::lane(hi));
+
+					for(; size_t(last - first) >= Vector::kLanes; first += Vector::kLanes, result += Vector::kLanes)
+					{
+						vector_type v = Vector::load(first);
+
+						v = (v < vlo) ? vlo : v;
+						v = (vhi < v) ? vhi : v;
+						Vector::store(result, v);
+					}
+					return minmax_imp<false>::do_clamp_transform(first, last, result, lo, hi);
+				}
+			};
+		#endif
+
+	} // namespace Internal
+
+} // namespace std
+
+
+#endif // Header include guard
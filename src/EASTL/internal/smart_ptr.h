@@ -163,7 +163,7 @@ namespace std
 
 		void operator()(T* p) const EA_NOEXCEPT
 		{
-			static_assert(std::internal::is_complete_type<T>::value, "Attempting to call the destructor of an incomplete type");
+			static_assert(std::Internal::is_complete_type<T>::value, "Attempting to call the destructor of an incomplete type");
 			delete p;
 		}
 	};
@@ -128,7 +128,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_is_member_function_pointer_CONFORMANCE 1    // is_member_function_pointer is conforming; doesn't make mistakes.
 
-	namespace internal
+	namespace Internal
 	{
 		template<typename T>
 		struct is_member_function_pointer_helper : false_type {};
@@ -139,7 +139,7 @@ namespace std
 
 	template<typename T>
 	struct is_member_function_pointer
-		: internal::is_member_function_pointer_helper<typename remove_cv<T>::type> {};
+		: Internal::is_member_function_pointer_helper<typename remove_cv<T>::type> {};
 
 	#if EASTL_VARIABLE_TEMPLATES_ENABLED
 		template<typename T>
@@ -158,7 +158,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_is_member_pointer_CONFORMANCE 1    // is_member_pointer is conforming; doesn't make mistakes.
 
-	namespace internal {
+	namespace Internal {
 		template <typename T>
 		struct is_member_pointer_helper
 			: public std::false_type {};
@@ -170,7 +170,7 @@ namespace std
 
 	template<typename T>
 	struct is_member_pointer
-		: public internal::is_member_pointer_helper<typename remove_cv<T>::type>::type {};
+		: public Internal::is_member_pointer_helper<typename remove_cv<T>::type>::type {};
 
 	#if EASTL_VARIABLE_TEMPLATES_ENABLED
 		template<typename T>
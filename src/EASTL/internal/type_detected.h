@@ -31,7 +31,7 @@ namespace std
 		void operator=(nonesuch const&) = delete;
 	};
 
-	namespace internal
+	namespace Internal
 	{
 		template <class Default, class AlwaysVoid, template <class...> class Op, class... Args>
 		struct detector
@@ -46,7 +46,7 @@ namespace std
 			using type = Op<Args...>;
 			using value_t = true_type;
 		};
-	} // namespace internal
+	} // namespace Internal
 
 	///////////////////////////////////////////////////////////////////////
 	// is_detected
@@ -72,7 +72,7 @@ namespace std
 	//
 	///////////////////////////////////////////////////////////////////////
 	template <template <class...> class Op, class... Args>
-	using is_detected = typename internal::detector<nonesuch, void, Op, Args...>::value_t;
+	using is_detected = typename Internal::detector<nonesuch, void, Op, Args...>::value_t;
 
 #if EASTL_VARIABLE_TEMPLATES_ENABLED
 	template <template <class...> class Op, class... Args>
@@ -98,7 +98,7 @@ namespace std
 	//
 	///////////////////////////////////////////////////////////////////////
 	template <template <class...> class Op, class... Args>
-	using detected_t = typename internal::detector<nonesuch, void, Op, Args...>::type;
+	using detected_t = typename Internal::detector<nonesuch, void, Op, Args...>::type;
 
 	///////////////////////////////////////////////////////////////////////
 	// detected_or
@@ -122,7 +122,7 @@ namespace std
 	//
 	///////////////////////////////////////////////////////////////////////
 	template <class Default, template <class...> class Op, class... Args>
-	using detected_or = internal::detector<Default, void, Op, Args...>;
+	using detected_or = Internal::detector<Default, void, Op, Args...>;
 
 	///////////////////////////////////////////////////////////////////////
 	// detected_or_t
@@ -411,7 +411,7 @@ namespace std
 		EA_CONSTEXPR auto has_equality_v = has_equality<T>::value;
 	#endif
 
-	namespace internal
+	namespace Internal
 	{
 		///////////////////////////////////////////////////////////////////////
 		// is_complete_type
@@ -121,7 +121,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_make_signed_CONFORMANCE 1
 
-	namespace internal
+	namespace Internal
 	{
 		template <typename T, bool = std::is_enum<T>::value || std::is_integral<T>::value>
 		struct make_signed_helper_0
@@ -201,15 +201,15 @@ namespace std
 		template <typename T>
 		struct make_signed_helper
 		{
-			typedef typename std::internal::make_signed_helper_1<typename std::internal::make_signed_helper_0<T>::type>::type type;
+			typedef typename std::Internal::make_signed_helper_1<typename std::Internal::make_signed_helper_0<T>::type>::type type;
 		};
 
-	} // namespace internal
+	} // namespace Internal
 
 	template <typename T>
 	struct make_signed
 	{
-		typedef typename std::internal::make_signed_helper<T>::type type;
+		typedef typename std::Internal::make_signed_helper<T>::type type;
 	};
 
 	template <> struct make_signed<bool> {};
@@ -283,7 +283,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_make_unsigned_CONFORMANCE 1
 
-	namespace internal
+	namespace Internal
 	{
 
 		template <typename T, bool = std::is_enum<T>::value || std::is_integral<T>::value>
@@ -366,15 +366,15 @@ namespace std
 		template <typename T>
 		struct make_unsigned_helper
 		{
-			typedef typename std::internal::make_unsigned_helper_1<typename std::internal::make_unsigned_helper_0<T>::type>::type type;
+			typedef typename std::Internal::make_unsigned_helper_1<typename std::Internal::make_unsigned_helper_0<T>::type>::type type;
 		};
 
-	} // namespace internal
+	} // namespace Internal
 
 	template <typename T>
 	struct make_unsigned
 	{
-		typedef typename std::internal::make_unsigned_helper<T>::type type;
+		typedef typename std::Internal::make_unsigned_helper<T>::type type;
 	};
 
 	template <> struct make_unsigned<bool> {};
@@ -488,7 +488,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_add_pointer_CONFORMANCE 1
 
-	namespace internal
+	namespace Internal
 	{
 		template <typename T>
 		auto try_add_pointer(int) -> type_identity<std::remove_reference_t<T>*>;
@@ -497,7 +497,7 @@ namespace std
 	}
 
 	template <typename T>
-	struct add_pointer : decltype(internal::try_add_pointer<T>(0)) {};
+	struct add_pointer : decltype(Internal::try_add_pointer<T>(0)) {};
 
 	template <class T>
 	using add_pointer_t = typename add_pointer<T>::type;
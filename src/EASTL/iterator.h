@@ -95,7 +95,7 @@ namespace std
 
 
 	// struct iterator_traits
-	namespace internal
+	namespace Internal
 	{
 		// Helper to make iterator_traits SFINAE friendly as N3844 requires.
 		template <typename Iterator, class = void>
@@ -122,7 +122,7 @@ namespace std
 	}
 
 	template <typename Iterator>
-	struct iterator_traits : internal::default_iterator_traits<Iterator> {};
+	struct iterator_traits : Internal::default_iterator_traits<Iterator> {};
 
 	template <typename T>
 	struct iterator_traits<T*>
@@ -675,8 +675,8 @@ namespace std
 	public:
 		//back_insert_iterator(); // Not valid. Must construct with a Container.
 
-		//back_insert_iterator(const this_type& x) // Compiler-implemented
-		//    : container(x.container) { }
+		back_insert_iterator(const this_type& x) // Declared because the protected operator= below makes the implicit one deprecated.
+			: container(x.container) { }
 
 		explicit back_insert_iterator(Container& x)
 			: container(x) { }
@@ -732,8 +732,8 @@ namespace std
 	public:
 		//front_insert_iterator(); // Not valid. Must construct with a Container.
 
-		//front_insert_iterator(const this_type& x) // Compiler-implemented
-		//    : container(x.container) { }
+		front_insert_iterator(const this_type& x) // Declared because the protected operator= below makes the implicit one deprecated.
+			: container(x.container) { }
 
 		explicit front_insert_iterator(Container& x)
 			: container(x) { }
@@ -14,12 +14,31 @@
 
 #include <EASTL/internal/config.h>
 #include <EASTL/iterator.h>
+#include <EASTL/functional.h>
+#include <EASTL/type_traits.h>
 
 #if defined(EA_PRAGMA_ONCE_SUPPORTED)
 	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
 #endif
 
 
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_REDUCE_UNROLLED
+//
+// Defined as 0 or 1. When 1, reduce and transform_reduce sum random access
+// ranges of arithmetic values with several accumulators (see
+// Internal::reduce_pairwise). AVR can neither overlap nor vectorize the
+// additions, so there the plain loop is as fast and smaller.
+//
+#ifndef EASTL_REDUCE_UNROLLED
+	#if defined(__AVR__)
+		#define EASTL_REDUCE_UNROLLED 0
+	#else
+		#define EASTL_REDUCE_UNROLLED 1
+	#endif
+#endif
+
+
 
 namespace std
 {
@@ -233,6 +252,350 @@ namespace std
 	}
 
 
+	namespace Internal
+	{
+		/// is_reduce_unrollable
+		///
+		/// True when reduce and transform_reduce may split [first, last) over
+		/// several accumulators: the range is random access and the sum is
+		/// arithmetic, so reordering the additions only costs registers.
+		///
+		template <typename Iterator1, typename Iterator2, typename T>
+		struct is_reduce_unrollable
+		{
+			static const bool value = EASTL_REDUCE_UNROLLED && is_arithmetic<T>::value &&
+			                          is_base_of<EASTL_ITC_NS::random_access_iterator_tag, typename iterator_traits<Iterator1>::iterator_category>::value &&
+			                          is_base_of<EASTL_ITC_NS::random_access_iterator_tag, typename iterator_traits<Iterator2>::iterator_category>::value;
+		};
+
+
+		// The element i of a reduction, so that one unrolled loop serves reduce
+		// and both forms of transform_reduce.
+		template <typename RandomAccessIterator>
+		struct reduce_source
+		{
+			RandomAccessIterator mFirst;
+
+			typename iterator_traits<RandomAccessIterator>::reference operator()(size_t i)
+				{ return mFirst[typename iterator_traits<RandomAccessIterator>::difference_type(i)]; }
+		};
+
+		template <typename RandomAccessIterator, typename UnaryOperation>
+		struct transform_reduce_source
+		{
+			RandomAccessIterator mFirst;
+			UnaryOperation       mTransform;
+
+			auto operator()(size_t i) -> decltype(mTransform(*mFirst))
+				{ return mTransform(mFirst[typename iterator_traits<RandomAccessIterator>::difference_type(i)]); }
+		};
+
+		template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation>
+		struct transform_reduce2_source
+		{
+			RandomAccessIterator1 mFirst1;
+			RandomAccessIterator2 mFirst2;
+			BinaryOperation       mTransform;
+
+			auto operator()(size_t i) -> decltype(mTransform(*mFirst1, *mFirst2))
+				{ return mTransform(mFirst1[typename iterator_traits<RandomAccessIterator1>::difference_type(i)],
+				                    mFirst2[typename iterator_traits<RandomAccessIterator2>::difference_type(i)]); }
+		};
+
+
+		static const size_t kReduceBlock = 512;
+
+		// Reduces the n >= 8 elements from i on. Four accumulators hide the
+		// latency of op and let the compiler vectorize it; halving down to
+		// blocks of kReduceBlock bounds the floating point rounding error by
+		// O(log n) instead of the O(n) of a left fold.
+		template <typename T, typename Source, typename BinaryOperation>
+		T reduce_pairwise(Source& source, size_t i, size_t n, BinaryOperation& op)
+		{
+			if(n > kReduceBlock)
+			{
+				const size_t nHalf = (n / 2) & ~size_t(3);
+
+				return op(Internal::reduce_pairwise<T>(source, i, nHalf, op), Internal::reduce_pairwise<T>(source, i + nHalf, n - nHalf, op));
+			}
+
+			const size_t iEnd = i + n;
+			T a0(op(source(i + 0), source(i + 4)));
+			T a1(op(source(i + 1), source(i + 5)));
+			T a2(op(source(i + 2), source(i + 6)));
+			T a3(op(source(i + 3), source(i + 7)));
+
+			for(i += 8; (i + 4) <= iEnd; i += 4)
+			{
+				a0 = op(a0, source(i + 0));
+				a1 = op(a1, source(i + 1));
+				a2 = op(a2, source(i + 2));
+				a3 = op(a3, source(i + 3));
+			}
+
+			T result(op(T(op(a0, a1)), T(op(a2, a3))));
+
+			for(; i < iEnd; ++i)
+				result = op(result, source(i));
+			return result;
+		}
+
+
+		/// reduce_imp
+		///
+		/// reduce_imp<false> is a left fold; reduce_imp<true> reduces ranges
+		/// of 8 or more elements with reduce_pairwise.
+		///
+		template <bool bUnrolled>
+		struct reduce_imp
+		{
+			template <typename InputIterator, typename T, typename BinaryOperation>
+			static T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op)
+			{
+				for(; first != last; ++first)
+					init = op(init, *first);
+				return init;
+			}
+
+			template <typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+			static T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init, BinaryOperation1 reduce, BinaryOperation2 transform)
+			{
+				for(; first1 != last1; ++first1, ++first2)
+					init = reduce(init, transform(*first1, *first2));
+				return init;
+			}
+
+			template <typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+			static T transform_reduce(InputIterator first, InputIterator last, T init, BinaryOperation reduce, UnaryOperation transform)
+			{
+				for(; first != last; ++first)
+					init = reduce(init, transform(*first));
+				return init;
+			}
+		};
+
+		template <>
+		struct reduce_imp<true>
+		{
+			template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+			static T reduce(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op)
+			{
+				const size_t n = size_t(last - first);
+
+				if(n < 8)
+					return reduce_imp<false>::reduce(first, last, init, op);
+
+				reduce_source<RandomAccessIterator> source = { first };
+				return op(init, Internal::reduce_pairwise<T>(source, 0, n, op));
+			}
+
+			template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+			static T transform_reduce(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, T init, BinaryOperation1 reduce, BinaryOperation2 transform)
+			{
+				const size_t n = size_t(last1 - first1);
+
+				if(n < 8)
+					return reduce_imp<false>::transform_reduce(first1, last1, first2, init, reduce, transform);
+
+				transform_reduce2_source<RandomAccessIterator1, RandomAccessIterator2, BinaryOperation2> source = { first1, first2, transform };
+				return reduce(init, Internal::reduce_pairwise<T>(source, 0, n, reduce));
+			}
+
+			template <typename RandomAccessIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+			static T transform_reduce(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation reduce, UnaryOperation transform)
+			{
+				const size_t n = size_t(last - first);
+
+				if(n < 8)
+					return reduce_imp<false>::transform_reduce(first, last, init, reduce, transform);
+
+				transform_reduce_source<RandomAccessIterator, UnaryOperation> source = { first, transform };
+				return reduce(init, Internal::reduce_pairwise<T>(source, 0, n, reduce));
+			}
+		};
+	}
+
+
+	/// reduce
+	///
+	/// Reduces the values in the range [first, last) and init using op,
+	/// which must be associative and commutative. Unlike accumulate, the
+	/// values are not processed in order, which allows sums of arithmetic
+	/// values to be split over several accumulators.
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/reduce
+	///
+	template <typename InputIterator, typename T, typename BinaryOperation>
+	T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op)
+	{
+		return Internal::reduce_imp<Internal::is_reduce_unrollable<InputIterator, InputIterator, T>::value>::reduce(first, last, init, op);
+	}
+
+	template <typename InputIterator, typename T>
+	T reduce(InputIterator first, InputIterator last, T init)
+	{
+		return std::reduce(first, last, init, std::plus<>());
+	}
+
+	template <typename InputIterator>
+	typename iterator_traits<InputIterator>::value_type reduce(InputIterator first, InputIterator last)
+	{
+		typedef typename iterator_traits<InputIterator>::value_type value_type;
+
+		return std::reduce(first, last, value_type(), std::plus<>());
+	}
+
+
+	/// transform_reduce
+	///
+	/// Applies transform to each pair of values of the ranges [first1, last1)
+	/// and [first2, first2 + (last1 - first1)), or to each value of [first, last),
+	/// and reduces the results and init as reduce does. With no operations
+	/// given, this is an inner_product whose additions may be reordered.
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/transform_reduce
+	///
+	template <typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+	T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init, BinaryOperation1 reduce, BinaryOperation2 transform)
+	{
+		return Internal::reduce_imp<Internal::is_reduce_unrollable<InputIterator1, InputIterator2, T>::value>::transform_reduce(first1, last1, first2, init, reduce, transform);
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename T>
+	T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init)
+	{
+		return std::transform_reduce(first1, last1, first2, init, std::plus<>(), std::multiplies<>());
+	}
+
+	template <typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+	T transform_reduce(InputIterator first, InputIterator last, T init, BinaryOperation reduce, UnaryOperation transform)
+	{
+		return Internal::reduce_imp<Internal::is_reduce_unrollable<InputIterator, InputIterator, T>::value>::transform_reduce(first, last, init, reduce, transform);
+	}
+
+
+	/// inclusive_scan
+	///
+	/// Like partial_sum, writes to result the sums of the values in the range
+	/// [first, last) up to and including each value, starting from init if
+	/// given. op must be associative. result may be equal to first.
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/inclusive_scan
+	///
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation, typename T>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result, BinaryOperation op, T init)
+	{
+		for(; first != last; ++first, ++result)
+		{
+			init = op(init, *first);
+			*result = init;
+		}
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result, BinaryOperation op)
+	{
+		typedef typename iterator_traits<InputIterator>::value_type value_type;
+
+		if(first != last)
+		{
+			value_type value(*first);
+
+			*result = value;
+			return std::inclusive_scan(++first, last, ++result, op, value);
+		}
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		return std::inclusive_scan(first, last, result, std::plus<>());
+	}
+
+
+	/// exclusive_scan
+	///
+	/// Writes to result the sums of init and the values in the range
+	/// [first, last) that come before each value, so the first value in
+	/// result is init. op must be associative. result may be equal to first.
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/exclusive_scan
+	///
+	template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation>
+	OutputIterator exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, T init, BinaryOperation op)
+	{
+		for(; first != last; ++first, ++result)
+		{
+			T value(op(init, *first));
+
+			*result = init;
+			init = std::move(value);
+		}
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator, typename T>
+	OutputIterator exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, T init)
+	{
+		return std::exclusive_scan(first, last, result, init, std::plus<>());
+	}
+
+
+	/// transform_inclusive_scan
+	///
+	/// inclusive_scan of the values of the range [first, last) passed
+	/// through transform.
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/transform_inclusive_scan
+	///
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation, typename UnaryOperation, typename T>
+	OutputIterator transform_inclusive_scan(InputIterator first, InputIterator last, OutputIterator result, BinaryOperation op, UnaryOperation transform, T init)
+	{
+		for(; first != last; ++first, ++result)
+		{
+			init = op(init, transform(*first));
+			*result = init;
+		}
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation, typename UnaryOperation>
+	OutputIterator transform_inclusive_scan(InputIterator first, InputIterator last, OutputIterator result, BinaryOperation op, UnaryOperation transform)
+	{
+		if(first != last)
+		{
+			auto value(transform(*first));
+
+			*result = value;
+			return std::transform_inclusive_scan(++first, last, ++result, op, transform, value);
+		}
+		return result;
+	}
+
+
+	/// transform_exclusive_scan
+	///
+	/// exclusive_scan of the values of the range [first, last) passed
+	/// through transform.
+	///
+	/// http://en.cppreference.com/w/cpp/algorithm/transform_exclusive_scan
+	///
+	template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+	OutputIterator transform_exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, T init, BinaryOperation op, UnaryOperation transform)
+	{
+		for(; first != last; ++first, ++result)
+		{
+			T value(op(init, transform(*first)));
+
+			*result = init;
+			init = std::move(value);
+		}
+		return result;
+	}
+
+
 	#if defined(EA_COMPILER_CPP20_ENABLED)
 	/// midpoint
 	///
@@ -0,0 +1,800 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// static_regex: regular expressions compiled by the C++ compiler.
+//
+// EASTL_STATIC_REGEX("pattern") names a type whose static match(), search()
+// and starts_with() are a backtracking matcher generated from the pattern at
+// compile time. Nothing is parsed at run time, nothing is allocated, and the
+// pattern itself is not stored: each character test is an immediate compare.
+// A malformed pattern is a compile error.
+//
+// The results hold a string_view over the input for the whole match and for
+// each capture group, so the input must outlive them.
+//
+// Supported syntax (ECMAScript semantics, a subset):
+//     .                    any character
+//     \d \D \w \W \s \S    digit, word and space classes and their complements
+//     \n \r \t \f \v \0    control characters; any other escaped character is
+//                          itself
+//     [abc] [^a-z0-9_\d]   character classes
+//     ^ $                  start and end of the input
+//     * + ? {n} {n,} {n,m} greedy quantifiers, and lazy with a trailing ?
+//     (...) (?:...)        capturing and non-capturing groups
+//     a|b                  alternation
+// There are no backreferences, lookarounds or flags. Patterns are limited to
+// EASTL_STATIC_REGEX_MAX_LENGTH characters.
+//
+// Example usage:
+//     typedef EASTL_STATIC_REGEX("set ([a-z]+) (-?\\d+)") SetCommand;
+//
+//     if(SetCommand::results_type m = SetCommand::match(line))
+//         set(m.get<1>(), atoi(m.get<2>().data()));
+//
+// This is not std::regex: there is no basic_regex object and no runtime
+// pattern.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_REGEX_H
+#define EASTL_REGEX_H
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/string_view.h>
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_STATIC_REGEX_MAX_LENGTH
+//
+// The longest pattern EASTL_STATIC_REGEX accepts. The macro spells out one
+// template argument per character, so this can't be raised without
+// extending EASTL_STATIC_REGEX_CHARS_.
+//
+#define EASTL_STATIC_REGEX_MAX_LENGTH 64
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_STATIC_REGEX
+//
+// EASTL_STATIC_REGEX("pattern") is the static_regex type for a string literal.
+//
+#define EASTL_STATIC_REGEX(pattern) \
+	std::static_regex<std::Internal::RegexPattern<int(sizeof(pattern) - 1), EASTL_STATIC_REGEX_CHARS_(pattern)> >
+
+#define EASTL_STATIC_REGEX_CHARS_(s) \
+	EASTL_STATIC_REGEX_CHARS16_(s, 0), EASTL_STATIC_REGEX_CHARS16_(s, 16), EASTL_STATIC_REGEX_CHARS16_(s, 32), EASTL_STATIC_REGEX_CHARS16_(s, 48)
+
+#define EASTL_STATIC_REGEX_CHARS16_(s, i)                                                                                                          \
+	std::Internal::RegexCharAt(s, i +  0), std::Internal::RegexCharAt(s, i +  1), std::Internal::RegexCharAt(s, i +  2), std::Internal::RegexCharAt(s, i +  3), \
+	std::Internal::RegexCharAt(s, i +  4), std::Internal::RegexCharAt(s, i +  5), std::Internal::RegexCharAt(s, i +  6), std::Internal::RegexCharAt(s, i +  7), \
+	std::Internal::RegexCharAt(s, i +  8), std::Internal::RegexCharAt(s, i +  9), std::Internal::RegexCharAt(s, i + 10), std::Internal::RegexCharAt(s, i + 11), \
+	std::Internal::RegexCharAt(s, i + 12), std::Internal::RegexCharAt(s, i + 13), std::Internal::RegexCharAt(s, i + 14), std::Internal::RegexCharAt(s, i + 15)
+
+
+
+namespace std
+{
+	/// static_regex_results
+	///
+	/// What a static_regex found: index 0 is the whole match, 1..N the capture
+	/// groups. A group that did not take part in the match is an empty view
+	/// with a null data(). Converts to true if there was a match.
+	///
+	template <size_t N>
+	class static_regex_results
+	{
+	public:
+		typedef basic_string_view<char> view_type;
+
+		static_regex_results()
+		{
+			for(size_t i = 0; i < 2 * (N + 1); ++i)
+				mCaptures[i] = NULL;
+		}
+
+		explicit operator bool() const { return mCaptures[0] != NULL; }
+
+		bool matched(size_t i = 0) const { return mCaptures[2 * i] != NULL; }
+
+		view_type operator[](size_t i) const
+		{
+			return matched(i) ? view_type(mCaptures[2 * i], size_t(mCaptures[2 * i + 1] - mCaptures[2 * i])) : view_type();
+		}
+
+		template <size_t I>
+		view_type get() const
+		{
+			static_assert(I <= N, "static_regex_results::get: no such group.");
+			return (*this)[I];
+		}
+
+		view_type str() const      { return (*this)[0]; }
+		static EA_CONSTEXPR size_t size() { return N + 1; }
+
+	public:
+		const char* mCaptures[2 * (N + 1)];   // Begin and end of each group; written by the matcher.
+	};
+
+
+	namespace Internal
+	{
+		template <size_t N>
+		constexpr char RegexCharAt(const char (&s)[N], size_t i)
+		{
+			return (i < N) ? s[i] : 0;
+		}
+
+		template <int N, char... Cs>
+		struct RegexPattern
+		{
+			static_assert(N <= EASTL_STATIC_REGEX_MAX_LENGTH, "EASTL_STATIC_REGEX pattern longer than EASTL_STATIC_REGEX_MAX_LENGTH.");
+
+			static const int size = N;
+			static constexpr char kChars[sizeof...(Cs)] = { Cs... };
+
+			static constexpr char at(int i) { return ((i >= 0) && (i < N)) ? kChars[i] : 0; }
+		};
+
+		template <int N, char... Cs>
+		constexpr char RegexPattern<N, Cs...>::kChars[sizeof...(Cs)];
+
+		const int kRegexUnbounded = -1;
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Pattern scanning. Each returns an index into the pattern; an index
+		// past P::size means the construct is not terminated.
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename P>
+		constexpr int RegexClassScan(int j)
+		{
+			return (j >= P::size)       ? P::size + 1
+			     : (P::at(j) == ']')    ? j + 1
+			     : (P::at(j) == '\\')   ? RegexClassScan<P>(j + 2)
+			                            : RegexClassScan<P>(j + 1);
+		}
+
+		// The first item of the class opened at i, after any ^.
+		template <typename P>
+		constexpr int RegexClassFirst(int i)
+		{
+			return i + 1 + (P::at(i + 1) == '^' ? 1 : 0);
+		}
+
+		// Just past the ] closing the class opened at i. A ] first in the
+		// class is a member.
+		template <typename P>
+		constexpr int RegexClassEnd(int i)
+		{
+			return RegexClassScan<P>(RegexClassFirst<P>(i) + (P::at(RegexClassFirst<P>(i)) == ']' ? 1 : 0));
+		}
+
+		template <typename P>
+		constexpr int RegexGroupScan(int j, int depth)
+		{
+			return (j >= P::size)       ? P::size + 1
+			     : (P::at(j) == '\\')   ? RegexGroupScan<P>(j + 2, depth)
+			     : (P::at(j) == '[')    ? RegexGroupScan<P>(RegexClassEnd<P>(j), depth)
+			     : (P::at(j) == '(')    ? RegexGroupScan<P>(j + 1, depth + 1)
+			     : (P::at(j) != ')')    ? RegexGroupScan<P>(j + 1, depth)
+			     : (depth == 0)         ? j + 1
+			                            : RegexGroupScan<P>(j + 1, depth - 1);
+		}
+
+		// Just past the ) closing the group opened at i.
+		template <typename P>
+		constexpr int RegexGroupEnd(int i)
+		{
+			return RegexGroupScan<P>(i + 1, 0);
+		}
+
+		template <typename P>
+		constexpr bool RegexGroupCaptures(int i)
+		{
+			return P::at(i + 1) != '?';
+		}
+
+		template <typename P>
+		constexpr int RegexGroupBody(int i)
+		{
+			return RegexGroupCaptures<P>(i) ? i + 1 : i + 3;
+		}
+
+		template <typename P>
+		constexpr int RegexAtomEnd(int i)
+		{
+			return (P::at(i) == '\\') ? i + 2
+			     : (P::at(i) == '[')  ? RegexClassEnd<P>(i)
+			     : (P::at(i) == '(')  ? RegexGroupEnd<P>(i)
+			                          : i + 1;
+		}
+
+		template <typename P>
+		constexpr bool RegexIsDigit(int j)
+		{
+			return (P::at(j) >= '0') && (P::at(j) <= '9');
+		}
+
+		template <typename P>
+		constexpr int RegexNumber(int j, int value)
+		{
+			return RegexIsDigit<P>(j) ? RegexNumber<P>(j + 1, value * 10 + (P::at(j) - '0')) : value;
+		}
+
+		template <typename P>
+		constexpr int RegexNumberEnd(int j)
+		{
+			return RegexIsDigit<P>(j) ? RegexNumberEnd<P>(j + 1) : j;
+		}
+
+		// {n}, {n,} and {n,m} starting at j; just past the }, or past the
+		// pattern if malformed.
+		template <typename P>
+		constexpr int RegexBraceEnd(int j)
+		{
+			return !RegexIsDigit<P>(j + 1)                                       ? P::size + 1
+			     : (P::at(RegexNumberEnd<P>(j + 1)) == '}')                      ? RegexNumberEnd<P>(j + 1) + 1
+			     : (P::at(RegexNumberEnd<P>(j + 1)) != ',')                      ? P::size + 1
+			     : (P::at(RegexNumberEnd<P>(RegexNumberEnd<P>(j + 1) + 1)) == '}') ? RegexNumberEnd<P>(RegexNumberEnd<P>(j + 1) + 1) + 1
+			                                                                     : P::size + 1;
+		}
+
+		template <typename P>
+		constexpr bool RegexIsQuantifier(int j)
+		{
+			return (P::at(j) == '*') || (P::at(j) == '+') || (P::at(j) == '?') || (P::at(j) == '{');
+		}
+
+		template <typename P>
+		constexpr int RegexQuantifierMin(int j)
+		{
+			return (P::at(j) == '*') || (P::at(j) == '?') ? 0
+			     : (P::at(j) == '{')                      ? RegexNumber<P>(j + 1, 0)
+			                                              : 1;
+		}
+
+		template <typename P>
+		constexpr int RegexQuantifierMax(int j)
+		{
+			return (P::at(j) == '*') || (P::at(j) == '+')           ? kRegexUnbounded
+			     : (P::at(j) != '{')                                ? 1
+			     : (P::at(RegexNumberEnd<P>(j + 1)) == '}')         ? RegexNumber<P>(j + 1, 0)
+			     : (P::at(RegexNumberEnd<P>(j + 1) + 1) == '}')     ? kRegexUnbounded
+			                                                        : RegexNumber<P>(RegexNumberEnd<P>(j + 1) + 1, 0);
+		}
+
+		template <typename P>
+		constexpr int RegexQuantifierEnd0(int j)
+		{
+			return (P::at(j) == '{') ? RegexBraceEnd<P>(j) : RegexIsQuantifier<P>(j) ? j + 1 : j;
+		}
+
+		template <typename P>
+		constexpr bool RegexQuantifierLazy(int j)
+		{
+			return RegexIsQuantifier<P>(j) && (P::at(RegexQuantifierEnd0<P>(j)) == '?');
+		}
+
+		// Just past the quantifier (if any) starting at j.
+		template <typename P>
+		constexpr int RegexQuantifierEnd(int j)
+		{
+			return RegexQuantifierEnd0<P>(j) + (RegexQuantifierLazy<P>(j) ? 1 : 0);
+		}
+
+		// The first | outside groups and classes in [i, end), or end.
+		template <typename P>
+		constexpr int RegexFindAlternative(int i, int end)
+		{
+			return (i >= end) ? end : (P::at(i) == '|') ? i : RegexFindAlternative<P>(RegexAtomEnd<P>(i), end);
+		}
+
+		// The number of capture groups opened in [i, end).
+		template <typename P>
+		constexpr int RegexCountGroups(int i, int end)
+		{
+			return (i >= end)            ? 0
+			     : (P::at(i) == '\\')    ? RegexCountGroups<P>(i + 2, end)
+			     : (P::at(i) == '[')     ? RegexCountGroups<P>(RegexClassEnd<P>(i), end)
+			     : (P::at(i) == '(')     ? (RegexGroupCaptures<P>(i) ? 1 : 0) + RegexCountGroups<P>(i + 1, end)
+			                             : RegexCountGroups<P>(i + 1, end);
+		}
+
+		// The number of quantified groups opened in [i, end); each keeps an
+		// iteration count while matching.
+		template <typename P>
+		constexpr int RegexCountRepeats(int i, int end)
+		{
+			return (i >= end)            ? 0
+			     : (P::at(i) == '\\')    ? RegexCountRepeats<P>(i + 2, end)
+			     : (P::at(i) == '[')     ? RegexCountRepeats<P>(RegexClassEnd<P>(i), end)
+			     : (P::at(i) == '(')     ? (RegexIsQuantifier<P>(RegexGroupEnd<P>(i)) ? 1 : 0) + RegexCountRepeats<P>(i + 1, end)
+			                             : RegexCountRepeats<P>(i + 1, end);
+		}
+
+		template <typename P>
+		constexpr bool RegexValid(int i, int end)
+		{
+			return (i == end) ? true
+			     : (i > end)  ? false
+			     : (P::at(i) == ')') || RegexIsQuantifier<P>(i) ? false
+			     : (P::at(i) == '|')  ? RegexValid<P>(i + 1, end)
+			     : (P::at(i) == '^') || (P::at(i) == '$') ? !RegexIsQuantifier<P>(i + 1) && RegexValid<P>(i + 1, end)
+			     : (P::at(i) == '(')  ? (RegexGroupEnd<P>(i) <= end) &&
+			                            (RegexGroupCaptures<P>(i) || (P::at(i + 2) == ':')) &&
+			                            RegexValid<P>(RegexGroupBody<P>(i), RegexGroupEnd<P>(i) - 1) &&
+			                            RegexValid<P>(RegexQuantifierEnd<P>(RegexGroupEnd<P>(i)), end)
+			                          : RegexValid<P>(RegexQuantifierEnd<P>(RegexAtomEnd<P>(i)), end);
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Character tests
+		///////////////////////////////////////////////////////////////////////
+
+		constexpr char RegexEscapedChar(char e)
+		{
+			return (e == 'n') ? '\n' : (e == 'r') ? '\r' : (e == 't') ? '\t' :
+			       (e == 'f') ? '\f' : (e == 'v') ? '\v' : (e == '0') ? '\0' : e;
+		}
+
+		inline bool RegexIsDigitChar(char c) { return (unsigned char)(c - '0') < 10; }
+		inline bool RegexIsSpaceChar(char c) { return (c == ' ') || ((unsigned char)(c - '\t') < 5); }
+		inline bool RegexIsWordChar(char c)  { return RegexIsDigitChar(c) || ((unsigned char)((c | 0x20) - 'a') < 26) || (c == '_'); }
+
+		template <char E>
+		struct RegexEscape { static bool test(char c) { return c == RegexEscapedChar(E); } };
+
+		template <> struct RegexEscape<'d'> { static bool test(char c) { return  RegexIsDigitChar(c); } };
+		template <> struct RegexEscape<'D'> { static bool test(char c) { return !RegexIsDigitChar(c); } };
+		template <> struct RegexEscape<'w'> { static bool test(char c) { return  RegexIsWordChar(c); } };
+		template <> struct RegexEscape<'W'> { static bool test(char c) { return !RegexIsWordChar(c); } };
+		template <> struct RegexEscape<'s'> { static bool test(char c) { return  RegexIsSpaceChar(c); } };
+		template <> struct RegexEscape<'S'> { static bool test(char c) { return !RegexIsSpaceChar(c); } };
+
+		// A class item at i: an escape, a range or a single character.
+		enum RegexClassItemKind { kRegexItemChar, kRegexItemEscape, kRegexItemRange };
+
+		template <typename P>
+		constexpr int RegexClassItemKindAt(int i, int end)
+		{
+			return (P::at(i) == '\\') ? kRegexItemEscape
+			     : ((P::at(i + 1) == '-') && (i + 2 < end)) ? kRegexItemRange
+			                                                : kRegexItemChar;
+		}
+
+		template <typename P>
+		constexpr int RegexClassItemEnd(int i, int end)
+		{
+			return (RegexClassItemKindAt<P>(i, end) == kRegexItemChar) ? i + 1
+			     : (RegexClassItemKindAt<P>(i, end) == kRegexItemEscape) ? i + 2 : i + 3;
+		}
+
+		template <typename P, int I, int Kind>
+		struct RegexClassItem { static bool test(char c) { return c == P::at(I); } };
+
+		template <typename P, int I>
+		struct RegexClassItem<P, I, kRegexItemEscape> : public RegexEscape<P::at(I + 1)> {};
+
+		template <typename P, int I>
+		struct RegexClassItem<P, I, kRegexItemRange>
+		{
+			static bool test(char c)
+			{
+				return (unsigned char)((unsigned char)c - (unsigned char)P::at(I)) <= (unsigned char)((unsigned char)P::at(I + 2) - (unsigned char)P::at(I));
+			}
+		};
+
+		template <typename P, int I, int End, bool bDone = (I >= End)>
+		struct RegexClassItems
+		{
+			static bool test(char c)
+			{
+				return RegexClassItem<P, I, RegexClassItemKindAt<P>(I, End)>::test(c) ||
+				       RegexClassItems<P, RegexClassItemEnd<P>(I, End), End>::test(c);
+			}
+		};
+
+		template <typename P, int I, int End>
+		struct RegexClassItems<P, I, End, true> { static bool test(char) { return false; } };
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Matching
+		//
+		// Every node has static bool match(Context&, const char* cur), which
+		// matches its part of the pattern at cur and then calls its
+		// continuation, Next, with where it ended. Alternatives and
+		// quantifiers backtrack by trying Next from each candidate position.
+		// Capture groups and repeat counts are restored on the way back out
+		// of a failed attempt.
+		///////////////////////////////////////////////////////////////////////
+
+		template <size_t Groups, size_t Repeats>
+		struct RegexContext
+		{
+			const char*  mpBegin;
+			const char*  mpEnd;
+			const char** mpCaptures;
+			size_t       mCount[Repeats + 1];
+			const char*  mpIteration[Repeats + 1];
+		};
+
+		enum RegexAtomKind
+		{
+			kRegexAny,
+			kRegexLiteral,
+			kRegexEscape,
+			kRegexClass,
+			kRegexGroup,
+			kRegexBegin,
+			kRegexEnd
+		};
+
+		template <typename P>
+		constexpr int RegexAtomKindAt(int i)
+		{
+			return (P::at(i) == '.')  ? kRegexAny
+			     : (P::at(i) == '\\') ? kRegexEscape
+			     : (P::at(i) == '[')  ? kRegexClass
+			     : (P::at(i) == '(')  ? kRegexGroup
+			     : (P::at(i) == '^')  ? kRegexBegin
+			     : (P::at(i) == '$')  ? kRegexEnd
+			                          : kRegexLiteral;
+		}
+
+		// Single character atoms.
+		template <typename P, int Pos, int Kind = RegexAtomKindAt<P>(Pos)>
+		struct RegexChar { static bool test(char c) { return c == P::at(Pos); } };
+
+		template <typename P, int Pos>
+		struct RegexChar<P, Pos, kRegexAny> { static bool test(char) { return true; } };
+
+		template <typename P, int Pos>
+		struct RegexChar<P, Pos, kRegexEscape> : public RegexEscape<P::at(Pos + 1)> {};
+
+		template <typename P, int Pos>
+		struct RegexChar<P, Pos, kRegexClass>
+		{
+			static bool test(char c)
+			{
+				return RegexClassItems<P, RegexClassFirst<P>(Pos), RegexClassEnd<P>(Pos) - 1>::test(c) != (P::at(Pos + 1) == '^');
+			}
+		};
+
+
+		struct RegexAcceptEnd
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				if(cur != context.mpEnd)
+					return false;
+				context.mpCaptures[1] = cur;
+				return true;
+			}
+		};
+
+		struct RegexAcceptAny
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				context.mpCaptures[1] = cur;
+				return true;
+			}
+		};
+
+
+		enum RegexSequenceKind { kRegexSequenceEmpty, kRegexSequenceAlternative, kRegexSequenceAtom };
+
+		template <typename P>
+		constexpr int RegexSequenceKindAt(int pos, int end)
+		{
+			return (pos >= end) ? kRegexSequenceEmpty
+			     : (RegexFindAlternative<P>(pos, end) < end) ? kRegexSequenceAlternative : kRegexSequenceAtom;
+		}
+
+		template <typename P, int Pos, int Atom, typename Next, int Kind = RegexAtomKindAt<P>(Pos),
+		          bool bQuantified = RegexIsQuantifier<P>(Atom)>
+		struct RegexAtom;
+
+		// The pattern in [Pos, End), then Next.
+		template <typename P, int Pos, int End, typename Next, int Kind = RegexSequenceKindAt<P>(Pos, End)>
+		struct RegexSequence
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				return Next::match(context, cur);
+			}
+		};
+
+		template <typename P, int Pos, int End, typename Next>
+		struct RegexSequence<P, Pos, End, Next, kRegexSequenceAlternative>
+		{
+			static const int kBar = RegexFindAlternative<P>(Pos, End);
+
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				return RegexSequence<P, Pos, kBar, Next>::match(context, cur) ||
+				       RegexSequence<P, kBar + 1, End, Next>::match(context, cur);
+			}
+		};
+
+		template <typename P, int Pos, int End, typename Next>
+		struct RegexSequence<P, Pos, End, Next, kRegexSequenceAtom>
+			: public RegexAtom<P, Pos, RegexAtomEnd<P>(Pos),
+			                   RegexSequence<P, RegexQuantifierEnd<P>(RegexAtomEnd<P>(Pos)), End, Next> > {};
+
+
+		// A single character atom, not quantified.
+		template <typename P, int Pos, int Atom, typename Next, int Kind, bool bQuantified>
+		struct RegexAtom
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				return (cur != context.mpEnd) && RegexChar<P, Pos>::test(*cur) && Next::match(context, cur + 1);
+			}
+		};
+
+		// A single character atom, quantified: count the run, then try Next
+		// from the longest (greedy) or shortest (lazy) end of it.
+		template <typename P, int Pos, int Atom, typename Next, int Kind>
+		struct RegexAtom<P, Pos, Atom, Next, Kind, true>
+		{
+			static const int  kMin  = RegexQuantifierMin<P>(Atom);
+			static const int  kMax  = RegexQuantifierMax<P>(Atom);
+			static const bool bLazy = RegexQuantifierLazy<P>(Atom);
+
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				const char* p = cur;
+
+				if(bLazy)
+				{
+					for(int n = 0; ; ++n, ++p)
+					{
+						if((n >= kMin) && Next::match(context, p))
+							return true;
+						if(((kMax != kRegexUnbounded) && (n >= kMax)) || (p == context.mpEnd) || !RegexChar<P, Pos>::test(*p))
+							return false;
+					}
+				}
+
+				while(((kMax == kRegexUnbounded) || (p - cur < kMax)) && (p != context.mpEnd) && RegexChar<P, Pos>::test(*p))
+					++p;
+
+				for(; p - cur >= kMin; --p)
+				{
+					if(Next::match(context, p))
+						return true;
+					if(p == cur)
+						break;
+				}
+				return false;
+			}
+		};
+
+		template <typename P, int Pos, int Atom, typename Next, bool bQuantified>
+		struct RegexAtom<P, Pos, Atom, Next, kRegexBegin, bQuantified>
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				return (cur == context.mpBegin) && Next::match(context, cur);
+			}
+		};
+
+		template <typename P, int Pos, int Atom, typename Next, bool bQuantified>
+		struct RegexAtom<P, Pos, Atom, Next, kRegexEnd, bQuantified>
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				return (cur == context.mpEnd) && Next::match(context, cur);
+			}
+		};
+
+
+		template <int Group, typename Next>
+		struct RegexGroupClose
+		{
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				const char* pSaved = context.mpCaptures[2 * Group + 1];
+
+				context.mpCaptures[2 * Group + 1] = cur;
+				if(Next::match(context, cur))
+					return true;
+				context.mpCaptures[2 * Group + 1] = pSaved;
+				return false;
+			}
+		};
+
+		template <typename P, int Pos, int Atom, typename Next, bool bCaptures = RegexGroupCaptures<P>(Pos)>
+		struct RegexGroup
+			: public RegexSequence<P, RegexGroupBody<P>(Pos), Atom - 1, Next> {};
+
+		template <typename P, int Pos, int Atom, typename Next>
+		struct RegexGroup<P, Pos, Atom, Next, true>
+		{
+			static const int kGroup = 1 + RegexCountGroups<P>(0, Pos);
+
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				const char* pSavedBegin = context.mpCaptures[2 * kGroup];
+				const char* pSavedEnd   = context.mpCaptures[2 * kGroup + 1];
+
+				context.mpCaptures[2 * kGroup] = cur;
+				if(RegexSequence<P, Pos + 1, Atom - 1, RegexGroupClose<kGroup, Next> >::match(context, cur))
+					return true;
+				context.mpCaptures[2 * kGroup]     = pSavedBegin;
+				context.mpCaptures[2 * kGroup + 1] = pSavedEnd;
+				return false;
+			}
+		};
+
+		template <typename P, int Pos, int Atom, typename Next>
+		struct RegexAtom<P, Pos, Atom, Next, kRegexGroup, false>
+			: public RegexGroup<P, Pos, Atom, Next> {};
+
+		// A quantified group. The iteration count lives in the context, so
+		// the group's own continuation can come back here for another round.
+		template <typename P, int Pos, int Atom, typename Next>
+		struct RegexAtom<P, Pos, Atom, Next, kRegexGroup, true>
+		{
+			typedef RegexAtom<P, Pos, Atom, Next, kRegexGroup, true> this_type;
+
+			static const int  kRepeat = RegexCountRepeats<P>(0, Pos);
+			static const int  kMin    = RegexQuantifierMin<P>(Atom);
+			static const int  kMax    = RegexQuantifierMax<P>(Atom);
+			static const bool bLazy   = RegexQuantifierLazy<P>(Atom);
+
+			struct Again
+			{
+				template <typename Context>
+				static bool match(Context& context, const char* cur)
+				{
+					// An iteration that matched nothing can't make progress.
+					if((cur == context.mpIteration[kRepeat]) && (context.mCount[kRepeat] >= size_t(kMin)))
+						return false;
+
+					++context.mCount[kRepeat];
+					const bool bResult = this_type::Step(context, cur);
+					--context.mCount[kRepeat];
+					return bResult;
+				}
+			};
+
+			template <typename Context>
+			static bool Iterate(Context& context, const char* cur)
+			{
+				if((kMax != kRegexUnbounded) && (context.mCount[kRepeat] >= size_t(kMax)))
+					return false;
+
+				const char* pSaved = context.mpIteration[kRepeat];
+
+				context.mpIteration[kRepeat] = cur;
+				if(RegexGroup<P, Pos, Atom, Again>::match(context, cur))
+					return true;
+				context.mpIteration[kRepeat] = pSaved;
+				return false;
+			}
+
+			template <typename Context>
+			static bool Step(Context& context, const char* cur)
+			{
+				const bool bEnough = context.mCount[kRepeat] >= size_t(kMin);
+
+				if(bLazy)
+					return (bEnough && Next::match(context, cur)) || Iterate(context, cur);
+				return Iterate(context, cur) || (bEnough && Next::match(context, cur));
+			}
+
+			template <typename Context>
+			static bool match(Context& context, const char* cur)
+			{
+				const size_t nSaved = context.mCount[kRepeat];
+
+				context.mCount[kRepeat] = 0;
+				const bool bResult = Step(context, cur);
+				context.mCount[kRepeat] = nSaved;
+				return bResult;
+			}
+		};
+
+	} // namespace Internal
+
+
+
+	/// static_regex
+	///
+	/// The matcher for one pattern; see EASTL_STATIC_REGEX. All members are
+	/// static.
+	///
+	template <typename Pattern>
+	class static_regex
+	{
+		static_assert(Internal::RegexValid<Pattern>(0, Pattern::size), "EASTL_STATIC_REGEX: malformed pattern.");
+
+	public:
+		static const size_t kGroups  = size_t(Internal::RegexCountGroups<Pattern>(0, Pattern::size));
+		static const size_t kRepeats = size_t(Internal::RegexCountRepeats<Pattern>(0, Pattern::size));
+
+		typedef static_regex_results<kGroups>      results_type;
+		typedef basic_string_view<char>            view_type;
+
+		/// The whole of [first, last) matches.
+		static results_type match(const char* first, const char* last)
+		{
+			return Find<Internal::RegexAcceptEnd>(first, last, false);
+		}
+
+		static results_type match(view_type s) { return match(s.data(), s.data() + s.size()); }
+
+		/// Some prefix of [first, last) matches.
+		static results_type starts_with(const char* first, const char* last)
+		{
+			return Find<Internal::RegexAcceptAny>(first, last, false);
+		}
+
+		static results_type starts_with(view_type s) { return starts_with(s.data(), s.data() + s.size()); }
+
+		/// The leftmost match anywhere in [first, last).
+		static results_type search(const char* first, const char* last)
+		{
+			return Find<Internal::RegexAcceptAny>(first, last, true);
+		}
+
+		static results_type search(view_type s) { return search(s.data(), s.data() + s.size()); }
+
+	protected:
+		typedef Internal::RegexContext<kGroups, kRepeats> context_type;
+
+		template <typename Accept>
+		static results_type Find(const char* first, const char* last, bool bSearch)
+		{
+			typedef Internal::RegexSequence<Pattern, 0, Pattern::size, Accept> root_type;
+
+			results_type results;
+			context_type context;
+
+			context.mpBegin    = first;
+			context.mpEnd      = last;
+			context.mpCaptures = results.mCaptures;
+			for(size_t i = 0; i <= kRepeats; ++i)
+			{
+				context.mCount[i]      = 0;
+				context.mpIteration[i] = NULL;
+			}
+
+			for(const char* p = first; ; ++p)
+			{
+				if(root_type::match(context, p))
+				{
+					results.mCaptures[0] = p;
+					return results;
+				}
+				if(!bSearch || (p == last))
+					break;
+			}
+
+			return results;
+		}
+	};
+
+} // namespace std
+
+#endif // Header include guard
@@ -7,25 +7,29 @@
 // std C++ sorting algorithms, while others don't have equivalents in the
 // C++ standard. We implement the following sorting algorithms:
 //    is_sorted             --
-//    sort                  -- Unstable.    The implementation of this is mapped to quick_sort by default.
+//    sort                  -- Unstable.    The implementation of this is mapped to pdq_sort by default.
 //    quick_sort            -- Unstable.    This is actually an intro-sort (quick sort with switch to insertion sort).
+//    pdq_sort              -- Unstable.    Pattern-defeating quicksort; linear on sorted input, no recursion.
 //    tim_sort              -- Stable.
 //    tim_sort_buffer       -- Stable.
 //    partial_sort          -- Unstable.
 //    insertion_sort        -- Stable.
 //    shell_sort            -- Unstable.
 //    heap_sort             -- Unstable.
-//    stable_sort           -- Stable.      The implementation of this is simply mapped to merge_sort.
+//    stable_sort           -- Stable.      The implementation of this is simply mapped to merge_sort (in_place_merge_sort on AVR).
 //    merge                 --
 //    merge_sort            -- Stable.
 //    merge_sort_buffer     -- Stable.
+//    in_place_merge_sort   -- Stable.      Allocates nothing; merge_sort falls back to it when allocation fails.
 //    nth_element           -- Unstable.
 //    radix_sort            -- Stable.      Important and useful sort for integral data, and faster than all others for this.
+//    in_place_radix_sort   -- Unstable.    MSD radix sort that needs no buffer.
 //    comb_sort             -- Unstable.    Possibly the best combination of small code size but fast sort.
 //    bubble_sort           -- Stable.      Useful in practice for sorting tiny sets of data (<= 10 elements).
 //    selection_sort*       -- Unstable.
 //    shaker_sort*          -- Stable.
 //    bucket_sort*          -- Stable.
+//    static_sort*          -- Unstable.    Sorting network for a fixed number of elements.
 //
 // * Found in sort_extra.h.
 //
@@ -537,6 +541,193 @@ namespace std
 
 
 
+	/// in_place_merge_sort
+	///
+	/// A stable merge sort that allocates no memory.
+	///
+	/// Runs of kInPlaceMergeSortRunSize elements are insertion sorted and then
+	/// merged bottom-up. A merge that finds its runs already in order costs one
+	/// compare, so sorted input is O(n). Other merges first trim the elements
+	/// that are already in place, then move the shorter run into a small buffer
+	/// on the stack if it fits and merge linearly. Runs too long for the buffer
+	/// are merged by rotation (SymMerge, Kim and Kutzner): each run is split
+	/// around a binary searched point, the middle is rotated and the two
+	/// smaller merges continue. That makes the worst case O(n log^2 n) moves
+	/// instead of merge_sort's O(n log n), which the buffer keeps from
+	/// mattering until the runs get long.
+	///
+	/// The rotation merges recurse into the smaller half and loop on the larger,
+	/// so the stack depth is at most log2(n) frames.
+	///
+	/// EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE
+	/// The size in bytes of the stack buffer. Types larger than it are merged
+	/// by rotation only. 0 disables the buffer.
+	///
+	#ifndef EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE
+		#if defined(__AVR__)
+			#define EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE 32
+		#else
+			#define EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE 512
+		#endif
+	#endif
+
+	namespace Internal
+	{
+		static const int kInPlaceMergeSortRunSize = 16;
+
+		// Merges [first, middle) and [middle, last) with [first, middle) moved out to pBuffer.
+		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+		void in_place_merge_lower(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, T* pBuffer, StrictWeakOrdering& compare)
+		{
+			T* pBufferEnd = pBuffer;
+
+			for(RandomAccessIterator i = first; i != middle; ++i)
+				::new((void*)pBufferEnd++) T(std::move(*i));
+
+			T* b = pBuffer;
+
+			while((b != pBufferEnd) && (middle != last))
+			{
+				if(compare(*middle, *b))
+					*first++ = std::move(*middle++);
+				else
+					*first++ = std::move(*b++);
+			}
+
+			while(b != pBufferEnd)
+				*first++ = std::move(*b++);
+
+			std::destruct(pBuffer, pBufferEnd);
+		}
+
+		// Merges [first, middle) and [middle, last) with [middle, last) moved out to pBuffer.
+		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+		void in_place_merge_upper(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, T* pBuffer, StrictWeakOrdering& compare)
+		{
+			T* pBufferEnd = pBuffer;
+
+			for(RandomAccessIterator i = middle; i != last; ++i)
+				::new((void*)pBufferEnd++) T(std::move(*i));
+
+			T* b = pBufferEnd;
+
+			while((b != pBuffer) && (middle != first))
+			{
+				if(compare(*(b - 1), *(middle - 1)))
+					*--last = std::move(*--middle);
+				else
+					*--last = std::move(*--b);
+			}
+
+			while(b != pBuffer)
+				*--last = std::move(*--b);
+
+			std::destruct(pBuffer, pBufferEnd);
+		}
+
+		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+		void in_place_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		                    T* pBuffer, typename std::iterator_traits<RandomAccessIterator>::difference_type nBufferCount, StrictWeakOrdering& compare)
+		{
+			typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			for(;;)
+			{
+				if((first == middle) || (middle == last) || !compare(*middle, *(middle - 1)))
+					return;
+
+				// Elements of the first run not greater than the start of the second,
+				// and of the second not less than the end of the first, are in place.
+				first = std::upper_bound(first, middle, *middle, compare);
+				last  = std::lower_bound(middle, last, *(middle - 1), compare);
+
+				const difference_type nCount1 = middle - first;
+				const difference_type nCount2 = last - middle;
+
+				if(nCount1 <= nBufferCount)
+				{
+					in_place_merge_lower(first, middle, last, pBuffer, compare);
+					return;
+				}
+
+				if(nCount2 <= nBufferCount)
+				{
+					in_place_merge_upper(first, middle, last, pBuffer, compare);
+					return;
+				}
+
+				RandomAccessIterator cut1, cut2;
+
+				// Split the longer run. Ties split the first, as a second run of one cannot be split.
+				if(nCount1 >= nCount2)
+				{
+					cut1 = first + (nCount1 / 2);
+					cut2 = std::lower_bound(middle, last, *cut1, compare);
+				}
+				else
+				{
+					cut2 = middle + (nCount2 / 2);
+					cut1 = std::upper_bound(first, middle, *cut2, compare);
+				}
+
+				const RandomAccessIterator newMiddle = std::rotate(cut1, middle, cut2);
+
+				if((newMiddle - first) < (last - newMiddle))
+				{
+					in_place_merge(first, cut1, newMiddle, pBuffer, nBufferCount, compare);
+					first  = newMiddle;
+					middle = cut2;
+				}
+				else
+				{
+					in_place_merge(newMiddle, cut2, last, pBuffer, nBufferCount, compare);
+					last   = newMiddle;
+					middle = cut1;
+				}
+			}
+		}
+	}
+
+	template <typename RandomAccessIterator, typename StrictWeakOrdering>
+	void in_place_merge_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type      value_type;
+		typedef typename std::aligned_storage<sizeof(value_type), EASTL_ALIGN_OF(value_type)>::type storage_type;
+
+		const difference_type kRunSize     = std::Internal::kInPlaceMergeSortRunSize;
+		const difference_type nBufferCount = difference_type(EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE / sizeof(value_type));
+		const difference_type nCount       = last - first;
+
+		storage_type buffer[(EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE / sizeof(value_type)) ? (EASTL_IN_PLACE_MERGE_SORT_BUFFER_SIZE / sizeof(value_type)) : 1];
+
+		RandomAccessIterator run = first;
+
+		for(; (last - run) > kRunSize; run += kRunSize)
+			std::insertion_sort<RandomAccessIterator, StrictWeakOrdering>(run, run + kRunSize, compare);
+		std::insertion_sort<RandomAccessIterator, StrictWeakOrdering>(run, last, compare);
+
+		for(difference_type nWidth = kRunSize; nWidth < nCount; nWidth *= 2)
+		{
+			for(difference_type i = 0; (nCount - i) > nWidth; i += (nWidth * 2))
+			{
+				const difference_type nEnd = ((nCount - i) > (nWidth * 2)) ? (i + (nWidth * 2)) : nCount;
+
+				std::Internal::in_place_merge(first + i, first + (i + nWidth), first + nEnd, (value_type*)buffer, nBufferCount, compare);
+			}
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	inline void in_place_merge_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef std::less<typename std::iterator_traits<RandomAccessIterator>::value_type> Less;
+
+		std::in_place_merge_sort<RandomAccessIterator, Less>(first, last, Less());
+	}
+
+
+
 	/// merge_sort
 	///
 	/// Implements the MergeSort algorithm.
@@ -545,6 +736,21 @@ namespace std
 	/// Note that merge_sort requires a random access iterator, which usually means
 	/// an array (eg. vector, deque).
 	///
+	/// If the allocation fails, or is disabled, it sorts with in_place_merge_sort instead.
+	///
+	/// EASTL_MERGE_SORT_ALLOCATION_ENABLED
+	/// Defined as 0 or 1. When 0, merge_sort and stable_sort never allocate
+	/// and always use in_place_merge_sort. It is 0 for AVR, where a heap
+	/// buffer the size of the array is rarely available.
+	///
+	#ifndef EASTL_MERGE_SORT_ALLOCATION_ENABLED
+		#if defined(__AVR__)
+			#define EASTL_MERGE_SORT_ALLOCATION_ENABLED 0
+		#else
+			#define EASTL_MERGE_SORT_ALLOCATION_ENABLED 1
+		#endif
+	#endif
+
 	template <typename RandomAccessIterator, typename Allocator, typename StrictWeakOrdering>
 	void merge_sort(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator, StrictWeakOrdering compare)
 	{
@@ -556,7 +762,19 @@ namespace std
 		if(nCount > 1)
 		{
 			// We need to allocate an array of nCount value_type objects as a temporary buffer.
-			value_type* const pBuffer = (value_type*)allocate_memory(allocator, nCount * sizeof(value_type), EASTL_ALIGN_OF(value_type), 0);
+			#if EASTL_MERGE_SORT_ALLOCATION_ENABLED
+				value_type* const pBuffer = (value_type*)allocate_memory(allocator, nCount * sizeof(value_type), EASTL_ALIGN_OF(value_type), 0);
+			#else
+				value_type* const pBuffer = NULL;
+				EA_UNUSED(allocator);
+			#endif
+
+			if(!pBuffer)
+			{
+				std::in_place_merge_sort<RandomAccessIterator, StrictWeakOrdering>(first, last, compare);
+				return;
+			}
+
 			std::uninitialized_fill(pBuffer, pBuffer + nCount, value_type());
 
 			std::merge_sort_buffer<RandomAccessIterator, value_type, StrictWeakOrdering>
@@ -1081,6 +1299,501 @@ namespace std
 
 
 
+	/// pdq_sort
+	///
+	/// This is an unstable sort, and the default implementation of sort.
+	///
+	/// Pattern-defeating quicksort (Orson Peters, https://github.com/orlp/pdqsort).
+	/// It is an introsort that also:
+	///     - Detects partitions that needed no swaps and tries to finish them
+	///       with a bounded insertion sort, so sorted, reversed-then-partitioned
+	///       and mostly sorted input runs in linear time.
+	///     - Partitions equal elements out of the way, so inputs with few
+	///       unique values run in O(n * k) for k unique values.
+	///     - Shuffles a few elements after an unbalanced partition, which
+	///       defeats inputs built to make median-of-three pick bad pivots,
+	///       and falls back to heap sort after log2(n) of those.
+	///     - For arithmetic types compared with less or greater, partitions in
+	///       blocks with branchless compares (BlockQuicksort, Edelkamp and
+	///       Weiss), which avoids branch mispredictions on random data.
+	///
+	/// Instead of recursing, it keeps the partitions still to be sorted on a
+	/// small fixed stack, always deferring the larger one, so its stack use is
+	/// bounded by log2(n) entries whatever the input.
+	///
+	/// EASTL_PDQ_SORT_BRANCHLESS
+	/// Defined as 0 or 1. Enables the block partitioning. It uses two 64 byte
+	/// offset buffers on the stack and only pays off on CPUs with branch
+	/// prediction, so it is off for AVR.
+	///
+	#ifndef EASTL_PDQ_SORT_BRANCHLESS
+		#if defined(__AVR__)
+			#define EASTL_PDQ_SORT_BRANCHLESS 0
+		#else
+			#define EASTL_PDQ_SORT_BRANCHLESS 1
+		#endif
+	#endif
+
+	namespace Internal
+	{
+		static const int    kPdqSortInsertionLimit        = 24;  // Partitions smaller than this are insertion sorted.
+		static const int    kPdqSortNintherLimit          = 128; // Partitions larger than this use the median of 3 medians of 3 as pivot.
+		static const size_t kPdqSortPartialInsertionLimit = 8;   // Moves allowed when trying to finish a partition that was already in order.
+		static const size_t kPdqSortBlockSize             = 64;
+
+		template <typename RandomAccessIterator, typename Compare>
+		inline void pdq_sort2(RandomAccessIterator a, RandomAccessIterator b, Compare& compare)
+		{
+			if(compare(*b, *a))
+				std::iter_swap(a, b);
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		inline void pdq_sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare& compare)
+		{
+			pdq_sort2(a, b, compare);
+			pdq_sort2(b, c, compare);
+			pdq_sort2(a, b, compare);
+		}
+
+		// Insertion sort; if bGuarded is false, *(first - 1) must not be greater than any element.
+		template <bool bGuarded, typename RandomAccessIterator, typename Compare>
+		inline void pdq_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			if(first == last)
+				return;
+
+			for(RandomAccessIterator current = first + 1; current != last; ++current)
+			{
+				RandomAccessIterator sift = current, siftPrev = current - 1;
+
+				if(compare(*sift, *siftPrev))
+				{
+					value_type temp(std::move(*sift));
+
+					do { *sift-- = std::move(*siftPrev); }
+					while((!bGuarded || (sift != first)) && compare(temp, *--siftPrev));
+
+					*sift = std::move(temp);
+				}
+			}
+		}
+
+		// Insertion sorts [first, last) unless that takes more than
+		// kPdqSortPartialInsertionLimit moves, in which case it stops and
+		// returns false.
+		template <typename RandomAccessIterator, typename Compare>
+		inline bool pdq_partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			if(first == last)
+				return true;
+
+			size_t nMoves = 0;
+
+			for(RandomAccessIterator current = first + 1; current != last; ++current)
+			{
+				RandomAccessIterator sift = current, siftPrev = current - 1;
+
+				if(compare(*sift, *siftPrev))
+				{
+					value_type temp(std::move(*sift));
+
+					do { *sift-- = std::move(*siftPrev); }
+					while((sift != first) && compare(temp, *--siftPrev));
+
+					*sift = std::move(temp);
+					nMoves += size_t(current - sift);
+
+					if(nMoves > kPdqSortPartialInsertionLimit)
+						return false;
+				}
+			}
+
+			return true;
+		}
+
+		// Partitions around *first, putting elements equal to it on the right.
+		// Returns the pivot position and whether no elements had to move.
+		// Requires an element not less than the pivot after the median-of-3
+		// selection, which the callers guarantee.
+		template <typename RandomAccessIterator, typename Compare>
+		inline std::pair<RandomAccessIterator, bool> pdq_partition_right(RandomAccessIterator begin, RandomAccessIterator end, Compare& compare)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			value_type           pivot(std::move(*begin));
+			RandomAccessIterator first = begin, last = end;
+
+			while(compare(*++first, pivot))
+				{ }
+
+			if(first - 1 == begin)
+				while((first < last) && !compare(*--last, pivot)) { }
+			else
+				while(!compare(*--last, pivot)) { }
+
+			const bool bAlreadyPartitioned = (first >= last);
+
+			while(first < last)
+			{
+				std::iter_swap(first, last);
+				while(compare(*++first, pivot)) { }
+				while(!compare(*--last, pivot)) { }
+			}
+
+			RandomAccessIterator pivotPosition = first - 1;
+			*begin         = std::move(*pivotPosition);
+			*pivotPosition = std::move(pivot);
+
+			return std::pair<RandomAccessIterator, bool>(pivotPosition, bAlreadyPartitioned);
+		}
+
+		template <typename RandomAccessIterator>
+		inline void pdq_swap_offsets(RandomAccessIterator first, RandomAccessIterator last, const unsigned char* pOffsetsL,
+		                             const unsigned char* pOffsetsR, size_t n, bool bUseSwaps)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			if(bUseSwaps)
+			{
+				// With as many elements on both sides a cyclic permutation
+				// would leave one element unmatched, so swap pairwise.
+				for(size_t i = 0; i < n; ++i)
+					std::iter_swap(first + pOffsetsL[i], last - pOffsetsR[i]);
+			}
+			else if(n > 0)
+			{
+				RandomAccessIterator l = first + pOffsetsL[0], r = last - pOffsetsR[0];
+				value_type           temp(std::move(*l));
+
+				*l = std::move(*r);
+				for(size_t i = 1; i < n; ++i)
+				{
+					l  = first + pOffsetsL[i];
+					*r = std::move(*l);
+					r  = last - pOffsetsR[i];
+					*l = std::move(*r);
+				}
+				*r = std::move(temp);
+			}
+		}
+
+		// pdq_partition_right, but comparing a block of elements at a time
+		// into offset buffers without branching on the results.
+		template <typename RandomAccessIterator, typename Compare>
+		inline std::pair<RandomAccessIterator, bool> pdq_partition_right_branchless(RandomAccessIterator begin, RandomAccessIterator end, Compare& compare)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			value_type           pivot(std::move(*begin));
+			RandomAccessIterator first = begin, last = end;
+
+			while(compare(*++first, pivot))
+				{ }
+
+			if(first - 1 == begin)
+				while((first < last) && !compare(*--last, pivot)) { }
+			else
+				while(!compare(*--last, pivot)) { }
+
+			const bool bAlreadyPartitioned = (first >= last);
+
+			if(!bAlreadyPartitioned)
+			{
+				std::iter_swap(first, last);
+				++first;
+
+				unsigned char        offsetsL[kPdqSortBlockSize];
+				unsigned char        offsetsR[kPdqSortBlockSize];
+				unsigned char*       pOffsetsL = offsetsL;
+				unsigned char*       pOffsetsR = offsetsR;
+				RandomAccessIterator baseL = first, baseR = last;
+				size_t               nL = 0, nR = 0, startL = 0, startR = 0;
+
+				while(first < last)
+				{
+					// Fill whichever offset buffers are empty, splitting what
+					// is left between them if both are.
+					const size_t nUnknown = size_t(last - first);
+					const size_t nSplitL  = (nL == 0) ? ((nR == 0) ? nUnknown / 2 : nUnknown) : 0;
+					const size_t nSplitR  = (nR == 0) ? (nUnknown - nSplitL) : 0;
+
+					if(nSplitL >= kPdqSortBlockSize)
+					{
+						for(size_t i = 0; i < kPdqSortBlockSize; )
+						{
+							offsetsL[nL] = (unsigned char)i++; nL += !compare(*first, pivot); ++first;
+							offsetsL[nL] = (unsigned char)i++; nL += !compare(*first, pivot); ++first;
+							offsetsL[nL] = (unsigned char)i++; nL += !compare(*first, pivot); ++first;
+							offsetsL[nL] = (unsigned char)i++; nL += !compare(*first, pivot); ++first;
+						}
+					}
+					else
+					{
+						for(size_t i = 0; i < nSplitL; )
+						{
+							offsetsL[nL] = (unsigned char)i++; nL += !compare(*first, pivot); ++first;
+						}
+					}
+
+					if(nSplitR >= kPdqSortBlockSize)
+					{
+						for(size_t i = 0; i < kPdqSortBlockSize; )
+						{
+							offsetsR[nR] = (unsigned char)++i; nR += compare(*--last, pivot);
+							offsetsR[nR] = (unsigned char)++i; nR += compare(*--last, pivot);
+							offsetsR[nR] = (unsigned char)++i; nR += compare(*--last, pivot);
+							offsetsR[nR] = (unsigned char)++i; nR += compare(*--last, pivot);
+						}
+					}
+					else
+					{
+						for(size_t i = 0; i < nSplitR; )
+						{
+							offsetsR[nR] = (unsigned char)++i; nR += compare(*--last, pivot);
+						}
+					}
+
+					const size_t n = std::min(nL, nR);
+
+					pdq_swap_offsets(baseL, baseR, pOffsetsL + startL, pOffsetsR + startR, n, nL == nR);
+					nL -= n; nR -= n;
+					startL += n; startR += n;
+
+					if(nL == 0)
+					{
+						startL = 0;
+						baseL  = first;
+					}
+					if(nR == 0)
+					{
+						startR = 0;
+						baseR  = last;
+					}
+				}
+
+				// Elements misplaced in the last block go next to the partition point.
+				if(nL)
+				{
+					pOffsetsL += startL;
+					while(nL--)
+						std::iter_swap(baseL + pOffsetsL[nL], --last);
+					first = last;
+				}
+				if(nR)
+				{
+					pOffsetsR += startR;
+					while(nR--)
+					{
+						std::iter_swap(baseR - pOffsetsR[nR], first);
+						++first;
+					}
+					last = first;
+				}
+			}
+
+			RandomAccessIterator pivotPosition = first - 1;
+			*begin         = std::move(*pivotPosition);
+			*pivotPosition = std::move(pivot);
+
+			return std::pair<RandomAccessIterator, bool>(pivotPosition, bAlreadyPartitioned);
+		}
+
+		// Partitions around *first, putting elements equal to it on the left.
+		// Used when the pivot equals the element before the partition, so
+		// all of its equals end up in place and are not looked at again.
+		template <typename RandomAccessIterator, typename Compare>
+		inline RandomAccessIterator pdq_partition_left(RandomAccessIterator begin, RandomAccessIterator end, Compare& compare)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			value_type           pivot(std::move(*begin));
+			RandomAccessIterator first = begin, last = end;
+
+			while(compare(pivot, *--last))
+				{ }
+
+			if(last + 1 == end)
+				while((first < last) && !compare(pivot, *++first)) { }
+			else
+				while(!compare(pivot, *++first)) { }
+
+			while(first < last)
+			{
+				std::iter_swap(first, last);
+				while(compare(pivot, *--last)) { }
+				while(!compare(pivot, *++first)) { }
+			}
+
+			RandomAccessIterator pivotPosition = last;
+			*begin         = std::move(*pivotPosition);
+			*pivotPosition = std::move(pivot);
+
+			return pivotPosition;
+		}
+
+		// Swaps a few elements of a partition that came out too small, to
+		// break up the pattern that made it so.
+		template <typename RandomAccessIterator, typename difference_type>
+		inline void pdq_shuffle(RandomAccessIterator first, RandomAccessIterator last, difference_type n)
+		{
+			if(n >= kPdqSortInsertionLimit)
+			{
+				std::iter_swap(first, first + n / 4);
+				std::iter_swap(last - 1, last - n / 4);
+
+				if(n > kPdqSortNintherLimit)
+				{
+					std::iter_swap(first + 1, first + (n / 4 + 1));
+					std::iter_swap(first + 2, first + (n / 4 + 2));
+					std::iter_swap(last - 2, last - (n / 4 + 1));
+					std::iter_swap(last - 3, last - (n / 4 + 2));
+				}
+			}
+		}
+
+		template <typename T, typename Compare>
+		struct pdq_sort_is_branchless
+		{
+			static const bool value = EASTL_PDQ_SORT_BRANCHLESS && is_arithmetic<T>::value &&
+				(is_same<Compare, std::less<T> >::value || is_same<Compare, std::greater<T> >::value ||
+				 is_same<Compare, std::less<void> >::value || is_same<Compare, std::greater<void> >::value);
+		};
+
+		template <bool bBranchless, typename RandomAccessIterator, typename Compare>
+		void pdq_sort_impl(RandomAccessIterator begin, RandomAccessIterator end, Compare& compare)
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			struct Partition
+			{
+				RandomAccessIterator mBegin;
+				RandomAccessIterator mEnd;
+				int                  mnBadAllowed;
+				bool                 mbLeftmost;
+			};
+
+			// The larger side of each split waits here while the smaller is
+			// sorted, so each entry covers less than half of the one below it.
+			Partition stack[sizeof(difference_type) * 8];
+			size_t    nStack = 0;
+
+			int  nBadAllowed = (int)Log2(end - begin);
+			bool bLeftmost   = true;
+
+			for(;;)
+			{
+				const difference_type size = end - begin;
+
+				if(size < kPdqSortInsertionLimit)
+				{
+					if(bLeftmost)
+						pdq_insertion_sort<true>(begin, end, compare);
+					else
+						pdq_insertion_sort<false>(begin, end, compare);
+				}
+				else
+				{
+					const difference_type half = size / 2;
+
+					if(size > kPdqSortNintherLimit)
+					{
+						pdq_sort3(begin, begin + half, end - 1, compare);
+						pdq_sort3(begin + 1, begin + (half - 1), end - 2, compare);
+						pdq_sort3(begin + 2, begin + (half + 1), end - 3, compare);
+						pdq_sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+						std::iter_swap(begin, begin + half);
+					}
+					else
+						pdq_sort3(begin + half, begin, end - 1, compare);
+
+					// A pivot equal to the element before this partition (the
+					// previous pivot) means many equal elements: put them all
+					// on the left, where they are done, and go on with the rest.
+					if(!bLeftmost && !compare(*(begin - 1), *begin))
+					{
+						begin = pdq_partition_left(begin, end, compare) + 1;
+						continue;
+					}
+
+					const std::pair<RandomAccessIterator, bool> result = bBranchless ? pdq_partition_right_branchless(begin, end, compare)
+					                                                                 : pdq_partition_right(begin, end, compare);
+					const RandomAccessIterator pivot = result.first;
+					const difference_type      sizeL = pivot - begin;
+					const difference_type      sizeR = end - (pivot + 1);
+
+					bool bDone = false;
+
+					if((sizeL < size / 8) || (sizeR < size / 8))
+					{
+						if(--nBadAllowed == 0)
+						{
+							std::make_heap(begin, end, compare);
+							std::sort_heap(begin, end, compare);
+							bDone = true;
+						}
+						else
+						{
+							pdq_shuffle(begin, pivot, sizeL);
+							pdq_shuffle(pivot + 1, end, sizeR);
+						}
+					}
+					else if(result.second && pdq_partial_insertion_sort(begin, pivot, compare) &&
+					                         pdq_partial_insertion_sort(pivot + 1, end, compare))
+						bDone = true;
+
+					if(!bDone)
+					{
+						const Partition left  = { begin, pivot, nBadAllowed, bLeftmost };
+						const Partition right = { pivot + 1, end, nBadAllowed, false };
+
+						EASTL_ASSERT(nStack < sizeof(stack) / sizeof(stack[0]));
+						stack[nStack++] = (sizeL > sizeR) ? left : right;
+
+						const Partition& next = (sizeL > sizeR) ? right : left;
+						begin       = next.mBegin;
+						end         = next.mEnd;
+						bLeftmost   = next.mbLeftmost;
+						continue;
+					}
+				}
+
+				if(nStack == 0)
+					return;
+
+				const Partition& next = stack[--nStack];
+				begin       = next.mBegin;
+				end         = next.mEnd;
+				nBadAllowed = next.mnBadAllowed;
+				bLeftmost   = next.mbLeftmost;
+			}
+		}
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	void pdq_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		if(first != last)
+			std::Internal::pdq_sort_impl<std::Internal::pdq_sort_is_branchless<value_type, Compare>::value>(first, last, compare);
+	}
+
+	template <typename RandomAccessIterator>
+	void pdq_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		std::pdq_sort<RandomAccessIterator, std::less<value_type> >(first, last, std::less<value_type>());
+	}
+
+
+
+
 	namespace Internal
 	{
 		// Portions of the tim_sort code were originally written by Christopher Swenson.
@@ -1622,6 +2335,22 @@ namespace std
 	///
 	///     radix_sort<Element*, extract_radix_key<Element> >(elementArray, elementArray + 100, buffer);
 	///
+	/// radix_type may be any integral or floating point type. Signed integers
+	/// and floats are mapped to unsigned keys that sort in the same order
+	/// (negative values first, -0.0 before 0.0 and NaNs after infinity when the
+	/// sign bit is clear), so int64_t timestamps or float distances sort directly.
+	/// Arrays of plain arithmetic values can omit ExtractKey:
+	///     float distances[100], buffer[100];
+	///     radix_sort(distances, distances + 100, buffer);
+	///
+	/// DigitBits is the number of key bits sorted per pass: 8, 11 and 16 are
+	/// typical, and the key size need not be a multiple of it. Each pass costs
+	/// two arrays of 2^DigitBits counters on the stack, so 16 bit digits are
+	/// for hosts only. A pass in which every key has the same digit is skipped.
+	///
+	/// in_place_radix_sort is the MSD (American flag) variant, which needs no
+	/// buffer but is not stable.
+	///
 	/// To consider: A static linked-list implementation may be faster than the version here.
 
 	namespace Internal
@@ -1640,6 +2369,74 @@ namespace std
 				{ return x.mKey; }
 		};
 
+		// Key reader for sorting plain arithmetic values.
+		template <typename T>
+		struct extract_radix_value
+		{
+			typedef T radix_type;
+
+			const radix_type operator()(const T& x) const
+				{ return x; }
+		};
+
+		/// radix_key
+		///
+		/// Maps a radix_type to an unsigned integer type whose order matches it.
+		/// Unsigned types map to themselves. Signed types flip the sign bit.
+		/// IEEE floats flip all bits of negative values and the sign bit of
+		/// the rest.
+		///
+		template <typename T, typename Enable = void>
+		struct radix_key
+		{
+			typedef T type;
+
+			static type encode(T x)
+				{ return x; }
+		};
+
+		template <typename T>
+		struct radix_key<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type>
+		{
+			typedef typename std::make_unsigned<T>::type type;
+
+			static type encode(T x)
+				{ return type(type(x) ^ (type(1) << (sizeof(T) * 8 - 1))); }
+		};
+
+		template <typename T>
+		struct radix_key<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+		{
+			static_assert((sizeof(T) == 4) || (sizeof(T) == 8), "radix_sort supports 32 and 64 bit IEEE floating point keys");
+
+			typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type type;
+
+			static type encode(T x)
+			{
+				type bits;
+				memcpy(&bits, &x, sizeof(bits));
+
+				const type signBit = type(1) << (sizeof(T) * 8 - 1);
+				return (bits & signBit) ? type(~bits) : type(bits | signBit);
+			}
+		};
+
+		// Wraps a user ExtractKey so that it returns the encoded radix_key.
+		template <typename ExtractKey>
+		struct extract_radix_key_encoded
+		{
+			typedef typename radix_key<typename ExtractKey::radix_type>::type radix_type;
+
+			ExtractKey mExtractKey;
+
+			explicit extract_radix_key_encoded(const ExtractKey& extractKey)
+				: mExtractKey(extractKey) {}
+
+			template <typename Node>
+			radix_type operator()(const Node& x) const
+				{ return radix_key<typename ExtractKey::radix_type>::encode(mExtractKey(x)); }
+		};
+
 		// The radix_sort implementation uses two optimizations that are not part of a typical radix sort implementation.
 		// 1. Computing a histogram (i.e. finding the number of elements per bucket) for the next pass is done in parallel with the loop that "scatters"
 		//    elements in the current pass.  The advantage is that it avoids the memory traffic / cache pressure of reading keys in a separate operation.
@@ -1655,8 +2452,8 @@ namespace std
 			IntegerType)
 		{
 			RandomAccessIterator srcFirst = first;
-			EA_CONSTEXPR_OR_CONST size_t numBuckets = 1 << DigitBits;
-			EA_CONSTEXPR_OR_CONST IntegerType bucketMask = numBuckets - 1;
+			EA_CONSTEXPR_OR_CONST size_t numBuckets = size_t(1) << DigitBits;
+			EA_CONSTEXPR_OR_CONST IntegerType bucketMask = IntegerType(numBuckets - 1);
 
 			// The alignment of this variable isn't required; it merely allows the code below to be faster on some platforms.
 			uint32_t EA_PREFIX_ALIGN(EASTL_PLATFORM_PREFERRED_ALIGNMENT) bucketSize[numBuckets];
@@ -1690,7 +2487,7 @@ namespace std
 					doSeparateHistogramCalculation = false;
 
 					// If this is the last digit position, then don't calculate a histogram
-					if (j == (8 * sizeof(IntegerType) - DigitBits))
+					if ((j + DigitBits) >= (8 * sizeof(IntegerType)))
 					{
 						bucketPosition[0] = 0;
 						for (i = 0; i < numBuckets - 1; i++)
@@ -1747,9 +2544,170 @@ namespace std
 	template <typename RandomAccessIterator, typename ExtractKey, int DigitBits = 8>
 	void radix_sort(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator buffer)
 	{
+		typedef std::Internal::extract_radix_key_encoded<ExtractKey> EncodedKey;
+
 		static_assert(DigitBits > 0, "DigitBits must be > 0");
 		static_assert(DigitBits <= (sizeof(typename ExtractKey::radix_type) * 8), "DigitBits must be <= the size of the key (in bits)");
-		std::Internal::radix_sort_impl<RandomAccessIterator, ExtractKey, DigitBits>(first, last, buffer, ExtractKey(), typename ExtractKey::radix_type());
+
+		if((last - first) > 1)
+			std::Internal::radix_sort_impl<RandomAccessIterator, EncodedKey, DigitBits>(first, last, buffer, EncodedKey(ExtractKey()), typename EncodedKey::radix_type());
+	}
+
+	template <typename RandomAccessIterator>
+	inline void radix_sort(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator buffer)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		std::radix_sort<RandomAccessIterator, std::Internal::extract_radix_value<value_type> >(first, last, buffer);
+	}
+
+
+
+	/// in_place_radix_sort
+	///
+	/// MSD radix sort that permutes the elements in place (American flag sort,
+	/// McIlroy, Bostic and McIlroy), so it needs no buffer. Not stable.
+	/// Keys are read the same way as radix_sort. Each range is split into
+	/// 2^DigitBits buckets by its top digit and each bucket is sorted by the
+	/// next digit, down to ranges small enough for insertion sort. A digit that
+	/// is the same for the whole range is skipped without moving anything.
+	///
+	/// Recursion is one level per digit, and each level keeps two arrays of
+	/// 2^DigitBits size_t counters on the stack: 2 * 2^DigitBits * sizeof(size_t)
+	/// bytes, times up to key bits / DigitBits levels. With 8 bit digits that is
+	/// 1 KB per level on AVR and 4 KB on 64 bit targets.
+	///
+	/// EASTL_IN_PLACE_RADIX_SORT_DIGIT_BITS
+	/// The default DigitBits. 4 where pointers are narrower than 32 bits (AVR),
+	/// which keeps a level to 64 bytes, and 8 elsewhere.
+	///
+	/// Example usage:
+	///     int32_t counts[100];
+	///     in_place_radix_sort(counts, counts + 100);
+	///
+	///     in_place_radix_sort<Element*, extract_radix_key<Element>, 4>(elementArray, elementArray + 100);
+	///
+	#ifndef EASTL_IN_PLACE_RADIX_SORT_DIGIT_BITS
+		#if defined(__AVR__) || (EA_PLATFORM_PTR_SIZE < 4)
+			#define EASTL_IN_PLACE_RADIX_SORT_DIGIT_BITS 4
+		#else
+			#define EASTL_IN_PLACE_RADIX_SORT_DIGIT_BITS 8
+		#endif
+	#endif
+
+	namespace Internal
+	{
+		static const int kInPlaceRadixSortInsertionLimit = 32;
+
+		template <typename ExtractKey>
+		struct radix_key_less
+		{
+			ExtractKey mExtractKey;
+
+			explicit radix_key_less(const ExtractKey& extractKey)
+				: mExtractKey(extractKey) {}
+
+			template <typename Node>
+			bool operator()(const Node& a, const Node& b) const
+				{ return mExtractKey(a) < mExtractKey(b); }
+		};
+
+		template <typename RandomAccessIterator, typename ExtractKey, int DigitBits>
+		void in_place_radix_sort_impl(RandomAccessIterator first, RandomAccessIterator last, ExtractKey& extractKey, int shift)
+		{
+			typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+			typedef typename ExtractKey::radix_type                                 key_type;
+
+			EA_CONSTEXPR_OR_CONST size_t numBuckets = size_t(1) << DigitBits;
+			EA_CONSTEXPR_OR_CONST key_type bucketMask = key_type(numBuckets - 1);
+
+			size_t bucketNext[numBuckets];
+			size_t bucketEnd[numBuckets];
+
+			for(;;)
+			{
+				const size_t nCount = size_t(last - first);
+
+				if(nCount < size_t(kInPlaceRadixSortInsertionLimit))
+				{
+					std::insertion_sort(first, last, radix_key_less<ExtractKey>(extractKey));
+					return;
+				}
+
+				memset(bucketEnd, 0, sizeof(bucketEnd));
+				for(RandomAccessIterator i = first; i != last; ++i)
+					++bucketEnd[(extractKey(*i) >> shift) & bucketMask];
+
+				if(bucketEnd[(extractKey(*first) >> shift) & bucketMask] != nCount)
+				{
+					size_t position = 0;
+					for(size_t b = 0; b < numBuckets; ++b)
+					{
+						bucketNext[b] = position;
+						position += bucketEnd[b];
+						bucketEnd[b] = position;
+					}
+
+					// Each element is carried to the next free slot of its bucket, taking
+					// the element there along, until one belonging here comes back.
+					for(size_t b = 0; b < numBuckets; ++b)
+					{
+						while(bucketNext[b] != bucketEnd[b])
+						{
+							value_type value(std::move(first[bucketNext[b]]));
+							size_t     digit = size_t((extractKey(value) >> shift) & bucketMask);
+
+							while(digit != b)
+							{
+								std::swap(value, first[bucketNext[digit]++]);
+								digit = size_t((extractKey(value) >> shift) & bucketMask);
+							}
+
+							first[bucketNext[b]++] = std::move(value);
+						}
+					}
+
+					if(shift == 0)
+						return;
+
+					for(size_t b = 0, start = 0; b < numBuckets; start = bucketEnd[b++])
+					{
+						if((bucketEnd[b] - start) > 1)
+							in_place_radix_sort_impl<RandomAccessIterator, ExtractKey, DigitBits>(first + start, first + bucketEnd[b], extractKey, shift - DigitBits);
+					}
+					return;
+				}
+
+				if(shift == 0)
+					return;
+				shift -= DigitBits;
+			}
+		}
+	}
+
+	template <typename RandomAccessIterator, typename ExtractKey, int DigitBits = EASTL_IN_PLACE_RADIX_SORT_DIGIT_BITS>
+	void in_place_radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef std::Internal::extract_radix_key_encoded<ExtractKey> EncodedKey;
+		typedef typename EncodedKey::radix_type                      key_type;
+
+		static_assert(DigitBits > 0, "DigitBits must be > 0");
+		static_assert(DigitBits <= (sizeof(key_type) * 8), "DigitBits must be <= the size of the key (in bits)");
+
+		if((last - first) > 1)
+		{
+			// The top digit is the narrower one when DigitBits doesn't divide the key size.
+			EncodedKey extractKey((ExtractKey()));
+			std::Internal::in_place_radix_sort_impl<RandomAccessIterator, EncodedKey, DigitBits>(first, last, extractKey, ((int(sizeof(key_type) * 8) - 1) / DigitBits) * DigitBits);
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	inline void in_place_radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		std::in_place_radix_sort<RandomAccessIterator, std::Internal::extract_radix_value<value_type> >(first, last);
 	}
 
 
@@ -1885,10 +2843,11 @@ namespace std
 
 	/// sort
 	///
-	/// We use quick_sort by default. See quick_sort for details.
+	/// We use pdq_sort by default. See pdq_sort for details.
 	///
 	/// EASTL_DEFAULT_SORT_FUNCTION
-	/// If a default sort function is specified then call it, otherwise use EASTL's default quick_sort.
+	/// If a default sort function is specified then call it, otherwise use EASTL's default pdq_sort.
+	/// Defining it as std::quick_sort restores the previous default.
 	/// EASTL_DEFAULT_SORT_FUNCTION must be namespace-qualified and include any necessary template
 	/// parameters (e.g. std::comb_sort instead of just comb_sort), and it must be visible to this code.
 	/// The EASTL_DEFAULT_SORT_FUNCTION must be provided in two versions:
@@ -1904,7 +2863,7 @@ namespace std
 		#if defined(EASTL_DEFAULT_SORT_FUNCTION)
 			EASTL_DEFAULT_SORT_FUNCTION(first, last);
 		#else
-			std::quick_sort<RandomAccessIterator>(first, last);
+			std::pdq_sort<RandomAccessIterator>(first, last);
 		#endif
 	}
 
@@ -1914,7 +2873,7 @@ namespace std
 		#if defined(EASTL_DEFAULT_SORT_FUNCTION)
 			EASTL_DEFAULT_SORT_FUNCTION(first, last, compare);
 		#else
-			std::quick_sort<RandomAccessIterator, Compare>(first, last, compare);
+			std::pdq_sort<RandomAccessIterator, Compare>(first, last, compare);
 		#endif
 	}
 
@@ -1924,8 +2883,9 @@ namespace std
 	///
 	/// We use merge_sort by default. See merge_sort for details.
 	/// Beware that the used merge_sort -- and thus stable_sort -- allocates
-	/// memory during execution. Try using merge_sort_buffer if you want
-	/// to avoid memory allocation.
+	/// memory during execution. Try using merge_sort_buffer or in_place_merge_sort
+	/// if you want to avoid memory allocation, or define EASTL_MERGE_SORT_ALLOCATION_ENABLED
+	/// as 0 to make stable_sort use in_place_merge_sort.
 	///
 	/// EASTL_DEFAULT_STABLE_SORT_FUNCTION
 	/// If a default sort function is specified then call it, otherwise use EASTL's default merge_sort.
@@ -1947,6 +2907,8 @@ namespace std
 	{
 		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
 			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, *get_default_allocator(0), compare);
+		#elif !EASTL_MERGE_SORT_ALLOCATION_ENABLED
+			std::in_place_merge_sort<RandomAccessIterator, StrictWeakOrdering>(first, last, compare);
 		#else
 			std::merge_sort<RandomAccessIterator, EASTLAllocatorType, StrictWeakOrdering>
 							 (first, last, *get_default_allocator(0), compare);
@@ -1958,6 +2920,8 @@ namespace std
 	{
 		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
 			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, *get_default_allocator(0));
+		#elif !EASTL_MERGE_SORT_ALLOCATION_ENABLED
+			std::in_place_merge_sort<RandomAccessIterator>(first, last);
 		#else
 			std::merge_sort<RandomAccessIterator, EASTLAllocatorType>
 							 (first, last, *get_default_allocator(0));
@@ -132,6 +132,7 @@ EA_DISABLE_VC_WARNING(4530 4480 4571 4267 4702);
 
 #include <EASTL/internal/char_traits.h>
 #include <EASTL/string_view.h>
+#include <EASTL/charconv.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 // EASTL_STRING_EXPLICIT
@@ -4166,30 +4167,42 @@ namespace std
 
 	/// to_string
 	///
-	/// Converts integral types to an std::string with the same content that sprintf produces.  The following
-	/// implementation provides a type safe conversion mechanism which avoids the common bugs associated with sprintf
-	/// style format strings.
+	/// Converts numeric types to an std::string. The conversion is done by to_chars
+	/// rather than sprintf: integers produce the same text as sprintf's %d family,
+	/// and floating point values produce the shortest text that reads back to the
+	/// same value (e.g. "0.1" rather than "0.100000"), as specified for C++26.
 	///
 	/// http://en.cppreference.com/w/cpp/string/basic_string/to_string
 	///
+	namespace Internal
+	{
+		template <typename Value>
+		inline string ToString(Value value)
+		{
+			char buffer[32];
+			const to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), value);
+			return string(buffer, result.ptr);
+		}
+	}
+
 	inline string to_string(int value)
-		{ return string(string::CtorSprintf(), "%d", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(long value)
-		{ return string(string::CtorSprintf(), "%ld", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(long long value)
-		{ return string(string::CtorSprintf(), "%lld", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(unsigned value)
-		{ return string(string::CtorSprintf(), "%u", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(unsigned long value)
-		{ return string(string::CtorSprintf(), "%lu", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(unsigned long long value)
-		{ return string(string::CtorSprintf(), "%llu", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(float value)
-		{ return string(string::CtorSprintf(), "%f", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(double value)
-		{ return string(string::CtorSprintf(), "%f", value); }
+		{ return Internal::ToString(value); }
 	inline string to_string(long double value)
-		{ return string(string::CtorSprintf(), "%Lf", value); }
+		{ return Internal::ToString(value); }
 
 
 	/// to_wstring
@@ -4220,6 +4233,302 @@ namespace std
 		{ return wstring(wstring::CtorSprintf(), L"%Lf", value); }
 
 
+	/// stoi, stol, stoul, stoll, stoull
+	///
+	/// Parses an integer at the start of str the way strtol does: leading white space
+	/// is skipped, a sign is accepted, and with base 16 or 0 so is a "0x" prefix (base 0
+	/// also selects octal for a leading 0). If pos is non-null it receives the number
+	/// of characters consumed. If no number can be parsed, or it does not fit in the
+	/// result type, std::invalid_argument or std::out_of_range is thrown; without
+	/// exception support an assertion fires and 0 (or the clamped value) is returned.
+	///
+	/// http://en.cppreference.com/w/cpp/string/basic_string/stol
+	///
+	namespace Internal
+	{
+		inline void ThrowStringConversionException(bool bOutOfRange, const char* pMessage)
+		{
+			#if EASTL_EXCEPTIONS_ENABLED
+				if(bOutOfRange)
+					throw std::out_of_range(pMessage);
+				throw std::invalid_argument(pMessage);
+			#elif EASTL_ASSERT_ENABLED
+				EA_UNUSED(bOutOfRange);
+				EASTL_FAIL_MSG(pMessage);
+			#else
+				EA_UNUSED(bOutOfRange);
+				EA_UNUSED(pMessage);
+			#endif
+		}
+
+		inline const char* SkipStringSpace(const char* p, const char* pEnd)
+		{
+			while((p != pEnd) && isspace((unsigned char)*p))
+				++p;
+			return p;
+		}
+
+		template <typename Integer>
+		Integer StringToInteger(const string& str, size_t* pos, int base, const char* pMessage)
+		{
+			typedef typename make_unsigned<Integer>::type unsigned_type;
+
+			const char* const pBegin = str.data();
+			const char* const pEnd   = pBegin + str.size();
+			const char*       p      = SkipStringSpace(pBegin, pEnd);
+			bool              bNegative = false;
+
+			if((p != pEnd) && ((*p == '+') || (*p == '-')))
+				bNegative = (*p++ == '-');
+
+			if(((base == 0) || (base == 16)) && ((pEnd - p) >= 3) && (p[0] == '0') && ((p[1] | 0x20) == 'x') && (CharconvDigitValue(p[2]) < 16))
+			{
+				p   += 2;
+				base = 16;
+			}
+			else if(base == 0)
+				base = ((p != pEnd) && (*p == '0')) ? 8 : 10;
+
+			unsigned_type           magnitude = 0;
+			const from_chars_result result    = from_chars(p, pEnd, magnitude, base);
+
+			if(result.ec == errc::invalid_argument)
+			{
+				ThrowStringConversionException(false, pMessage);
+				if(pos)
+					*pos = 0;
+				return 0;
+			}
+
+			if(pos)
+				*pos = (size_t)(result.ptr - pBegin);
+
+			if(is_signed<Integer>::value)
+			{
+				const unsigned_type maxValue = (unsigned_type)((unsigned_type)~unsigned_type(0) >> 1);
+
+				if((result.ec == errc::result_out_of_range) || (magnitude > (unsigned_type)(maxValue + (bNegative ? 1u : 0u))))
+				{
+					ThrowStringConversionException(true, pMessage);
+					magnitude = (unsigned_type)(maxValue + (bNegative ? 1u : 0u));
+				}
+			}
+			else if(result.ec == errc::result_out_of_range)
+			{
+				ThrowStringConversionException(true, pMessage);
+				magnitude = (unsigned_type)~unsigned_type(0);
+			}
+
+			// Negative input to the unsigned conversions wraps, as with strtoul.
+			return bNegative ? (Integer)(unsigned_type)(unsigned_type(0) - magnitude) : (Integer)magnitude;
+		}
+
+		template <typename Float>
+		Float StringToFloat(const string& str, size_t* pos, const char* pMessage)
+		{
+			const char* const pBegin = str.data();
+			const char* const pEnd   = pBegin + str.size();
+			const char*       p      = SkipStringSpace(pBegin, pEnd);
+			bool              bNegative = false;
+			chars_format      fmt    = chars_format::general;
+
+			if((p != pEnd) && ((*p == '+') || (*p == '-')))
+				bNegative = (*p++ == '-');
+
+			if(((pEnd - p) >= 3) && (p[0] == '0') && ((p[1] | 0x20) == 'x') && ((CharconvDigitValue(p[2]) < 16) || (p[2] == '.')))
+			{
+				p  += 2;
+				fmt = chars_format::hex;
+			}
+
+			Float                   value  = 0;
+			const from_chars_result result = ((p != pEnd) && (*p == '-')) ? from_chars_result{ p, errc::invalid_argument }
+			                                                             : from_chars(p, pEnd, value, fmt);
+
+			if(result.ec == errc::invalid_argument)
+			{
+				ThrowStringConversionException(false, pMessage);
+				if(pos)
+					*pos = 0;
+				return 0;
+			}
+
+			if(result.ec == errc::result_out_of_range)
+				ThrowStringConversionException(true, pMessage);
+
+			if(pos)
+				*pos = (size_t)(result.ptr - pBegin);
+
+			return bNegative ? -value : value;
+		}
+	}
+
+	inline int stoi(const string& str, size_t* pos = NULL, int base = 10)
+		{ return Internal::StringToInteger<int>(str, pos, base, "stoi"); }
+	inline long stol(const string& str, size_t* pos = NULL, int base = 10)
+		{ return Internal::StringToInteger<long>(str, pos, base, "stol"); }
+	inline unsigned long stoul(const string& str, size_t* pos = NULL, int base = 10)
+		{ return Internal::StringToInteger<unsigned long>(str, pos, base, "stoul"); }
+	inline long long stoll(const string& str, size_t* pos = NULL, int base = 10)
+		{ return Internal::StringToInteger<long long>(str, pos, base, "stoll"); }
+	inline unsigned long long stoull(const string& str, size_t* pos = NULL, int base = 10)
+		{ return Internal::StringToInteger<unsigned long long>(str, pos, base, "stoull"); }
+
+
+	/// stof, stod, stold
+	///
+	/// Parses a floating point value at the start of str the way strtod does: leading
+	/// white space is skipped, a sign is accepted, and decimal, hexadecimal ("0x"),
+	/// inf and nan forms are recognized. Errors are reported as for stoi.
+	///
+	/// http://en.cppreference.com/w/cpp/string/basic_string/stof
+	///
+	inline float stof(const string& str, size_t* pos = NULL)
+		{ return Internal::StringToFloat<float>(str, pos, "stof"); }
+	inline double stod(const string& str, size_t* pos = NULL)
+		{ return Internal::StringToFloat<double>(str, pos, "stod"); }
+	inline long double stold(const string& str, size_t* pos = NULL)
+		{ return Internal::StringToFloat<long double>(str, pos, "stold"); }
+
+
+	namespace Internal
+	{
+		/// StrCatArg
+		///
+		/// One argument of str_cat / str_append. Text arguments keep a pointer and a
+		/// length; integer arguments keep their magnitude and sign so that the digits
+		/// can be written straight into the destination after the total size is known.
+		///
+		template <typename T>
+		class StrCatArg
+		{
+		public:
+			StrCatArg(const T* p)                                 : mpText(p), mnSize(CharStrlen(p)), mbInteger(false) {}
+			StrCatArg(basic_string_view<T> v)                     : mpText(v.data()), mnSize(v.size()), mbInteger(false) {}
+			template <typename Allocator>
+			StrCatArg(const basic_string<T, Allocator>& s)        : mpText(s.data()), mnSize(s.size()), mbInteger(false) {}
+			StrCatArg(T c)                                        : mpText(NULL), mnSize(1), mbInteger(false), mChar(c) {}
+
+			StrCatArg(int value)                                  { SetSigned(value); }
+			StrCatArg(long value)                                 { SetSigned(value); }
+			StrCatArg(long long value)                            { SetSigned(value); }
+			StrCatArg(unsigned value)                             { SetUnsigned(value, false); }
+			StrCatArg(unsigned long value)                        { SetUnsigned(value, false); }
+			StrCatArg(unsigned long long value)                   { SetUnsigned(value, false); }
+
+			size_t size() const { return mnSize; }
+
+			T* write(T* pDest) const
+			{
+				if(mbInteger)
+				{
+					T* p = WriteDecimalBackward(pDest + mnSize, (uint64_t)mnValue);
+
+					if(mbNegative)
+						*--p = (T)'-';
+				}
+				else if(mpText)
+					memcpy(pDest, mpText, mnSize * sizeof(T));
+				else
+					*pDest = mChar;
+
+				return pDest + mnSize;
+			}
+
+		protected:
+			void SetSigned(long long value)
+			{
+				// Negate in the unsigned domain so that LLONG_MIN is handled.
+				if(value < 0)
+					SetUnsigned(0ull - (unsigned long long)value, true);
+				else
+					SetUnsigned((unsigned long long)value, false);
+			}
+
+			void SetUnsigned(unsigned long long value, bool bNegative)
+			{
+				mpText     = NULL;
+				mnValue    = value;
+				mbInteger  = true;
+				mbNegative = bNegative;
+				mnSize     = (size_t)CountDecimalDigits((uint64_t)value) + (bNegative ? 1 : 0);
+			}
+
+			const T*           mpText;
+			size_t             mnSize;
+			bool               mbInteger;
+			bool               mbNegative;
+			T                  mChar;
+			unsigned long long mnValue;
+		};
+
+
+		template <typename T, typename Allocator, size_t N>
+		inline basic_string<T, Allocator>& StrCatAppend(basic_string<T, Allocator>& dest, const StrCatArg<T> (&args)[N])
+		{
+			typedef typename basic_string<T, Allocator>::size_type size_type;
+
+			size_type n = 0;
+			for(size_t i = 0; i < N; ++i)
+				n += (size_type)args[i].size();
+
+			const size_type nOldSize = dest.size();
+			dest.reserve(nOldSize + n);
+
+			T* p = dest.data() + nOldSize;
+			for(size_t i = 0; i < N; ++i)
+				p = args[i].write(p);
+			*p = 0;
+
+			dest.force_size(nOldSize + n);
+			return dest;
+		}
+	}
+
+
+	/// str_cat
+	///
+	/// Concatenates any number of strings, string_views, C strings, characters
+	/// and integers into a new string. Unlike a chain of operator+, which builds
+	/// a temporary string per '+', the total length is computed first and the
+	/// result is allocated and written exactly once. Integers are written in
+	/// decimal.
+	///
+	/// Example usage:
+	///     string path = str_cat(root, '/', topic, "/", index);
+	///
+	inline string str_cat()
+		{ return string(); }
+
+	template <typename... Args>
+	inline string str_cat(const Args&... args)
+	{
+		const Internal::StrCatArg<char> pieces[] = { Internal::StrCatArg<char>(args)... };
+		string result;
+		return std::move(Internal::StrCatAppend(result, pieces));
+	}
+
+
+	/// str_append
+	///
+	/// Appends any number of str_cat style arguments to dest, growing dest at most once.
+	/// The arguments must not refer to dest itself.
+	///
+	/// Example usage:
+	///     str_append(line, key, '=', value, "\r\n");
+	///
+	template <typename T, typename Allocator>
+	inline basic_string<T, Allocator>& str_append(basic_string<T, Allocator>& dest)
+		{ return dest; }
+
+	template <typename T, typename Allocator, typename... Args>
+	inline basic_string<T, Allocator>& str_append(basic_string<T, Allocator>& dest, const Args&... args)
+	{
+		const Internal::StrCatArg<T> pieces[] = { Internal::StrCatArg<T>(args)... };
+		return Internal::StrCatAppend(dest, pieces);
+	}
+
+
 	/// user defined literals
 	///
 	/// Converts a character array literal to a basic_string.
@@ -722,6 +722,269 @@ namespace std
 	typedef basic_string_view<char32_t> u32string_view;
 
 
+	/// split, tokenize
+	///
+	/// Lazy ranges of the pieces of a string_view, for use in range-for. Each
+	/// piece is a string_view into the original text; nothing is copied or
+	/// allocated, and the delimiters are searched for only as the range is
+	/// walked.
+	///
+	/// split(text, delimiter) yields the text between delimiters, including
+	/// empty pieces, unless split_skip_empty is given. nMaxSplits bounds the
+	/// number of splits; the last piece is then the rest of the text. The
+	/// delimiter may be:
+	///     a character               split(line, ',')
+	///     a string                  split(line, "::")
+	///     any of a set of chars     split(line, by_any_char(" \t"))
+	///
+	/// tokenize(text, chars) splits at any of chars and skips empty pieces,
+	/// like strtok but without modifying the text.
+	///
+	/// Example usage:
+	///    for(string_view field : split(csvLine, ','))
+	///        ...
+	///
+	///    for(string_view word : tokenize(commandLine, " \t"))
+	///        ...
+	///
+	///    auto kv = split(line, '=', split_keep_empty, 1);       // "key=a=b" -> "key", "a=b"
+	///
+	enum split_options
+	{
+		split_keep_empty,
+		split_skip_empty
+	};
+
+	/// The delimiters, made by by_char, by_string and by_any_char. Each has
+	/// find(text), which returns the first delimiter in text as a view into
+	/// it, or an empty view at text.end() if there is none.
+	template <typename CharT>
+	struct split_by_char
+	{
+		typedef CharT value_type;
+
+		explicit split_by_char(CharT c) : mChar(c) {}
+
+		basic_string_view<CharT> find(basic_string_view<CharT> text) const
+		{
+			const CharT* p = text.empty() ? NULL : Find(text.data(), mChar, text.size()); // memchr isn't given the NULL data of a default constructed view.
+			return p ? basic_string_view<CharT>(p, 1) : basic_string_view<CharT>(text.data() + text.size(), 0);
+		}
+
+		CharT mChar;
+	};
+
+	template <typename CharT>
+	struct split_by_string
+	{
+		typedef CharT value_type;
+
+		explicit split_by_string(basic_string_view<CharT> s) : mString(s) {}
+
+		/// An empty delimiter string never matches.
+		basic_string_view<CharT> find(basic_string_view<CharT> text) const
+		{
+			const CharT* const pEnd = text.data() + text.size();
+
+			if(!mString.empty())
+			{
+				for(const CharT* p = text.data(); size_t(pEnd - p) >= mString.size(); ++p)
+				{
+					p = Find(p, mString[0], size_t(pEnd - p) - mString.size() + 1);
+
+					if(!p)
+						break;
+					if(Compare(p + 1, mString.data() + 1, mString.size() - 1) == 0)
+						return basic_string_view<CharT>(p, mString.size());
+				}
+			}
+			return basic_string_view<CharT>(pEnd, 0);
+		}
+
+		basic_string_view<CharT> mString;
+	};
+
+	template <typename CharT>
+	struct split_by_any_char
+	{
+		typedef CharT value_type;
+
+		explicit split_by_any_char(basic_string_view<CharT> chars) : mChars(chars) {}
+
+		basic_string_view<CharT> find(basic_string_view<CharT> text) const
+		{
+			const CharT* const pEnd = text.data() + text.size();
+
+			for(const CharT* p = text.data(); p != pEnd; ++p)
+			{
+				for(const CharT* c = mChars.data(), *cEnd = mChars.data() + mChars.size(); c != cEnd; ++c)
+				{
+					if(*p == *c)
+						return basic_string_view<CharT>(p, 1);
+				}
+			}
+			return basic_string_view<CharT>(pEnd, 0);
+		}
+
+		basic_string_view<CharT> mChars;
+	};
+
+	template <typename CharT>
+	inline split_by_char<CharT> by_char(CharT c) { return split_by_char<CharT>(c); }
+
+	template <typename CharT>
+	inline split_by_string<CharT> by_string(const CharT* s) { return split_by_string<CharT>(basic_string_view<CharT>(s)); }
+
+	template <typename CharT>
+	inline split_by_string<CharT> by_string(basic_string_view<CharT> s) { return split_by_string<CharT>(s); }
+
+	template <typename CharT>
+	inline split_by_any_char<CharT> by_any_char(const CharT* s) { return split_by_any_char<CharT>(basic_string_view<CharT>(s)); }
+
+	template <typename CharT>
+	inline split_by_any_char<CharT> by_any_char(basic_string_view<CharT> s) { return split_by_any_char<CharT>(s); }
+
+
+	/// split_view
+	///
+	/// The range returned by split and tokenize. Its iterators are forward
+	/// iterators and refer to the view, which must outlive them.
+	///
+	template <typename Delimiter>
+	class split_view
+	{
+	public:
+		typedef typename Delimiter::value_type char_type;
+		typedef basic_string_view<char_type>   value_type;
+		typedef size_t                         size_type;
+
+		class iterator
+		{
+		public:
+			typedef EASTL_ITC_NS::forward_iterator_tag iterator_category;
+			typedef basic_string_view<char_type>       value_type;
+			typedef ptrdiff_t                          difference_type;
+			typedef const value_type*                  pointer;
+			typedef const value_type&                  reference;
+
+			iterator() : mpView(NULL), mpNext(NULL), mToken(), mnSplitsLeft(0), mbDone(true) {}
+
+			reference operator*() const  { return mToken; }
+			pointer   operator->() const { return &mToken; }
+
+			iterator& operator++()
+			{
+				Advance();
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator temp(*this);
+				Advance();
+				return temp;
+			}
+
+			bool operator==(const iterator& x) const { return (mpView == x.mpView) && (mToken.data() == x.mToken.data()); }
+			bool operator!=(const iterator& x) const { return !(*this == x); }
+
+		protected:
+			friend class split_view;
+
+			explicit iterator(const split_view* pView)
+				: mpView(pView), mpNext(pView->mText.data()), mToken(), mnSplitsLeft(pView->mnMaxSplits), mbDone(false)
+			{
+				Advance();
+			}
+
+			void Advance()
+			{
+				do
+				{
+					if(mbDone)   // There was no delimiter after the last piece.
+					{
+						mpView = NULL;
+						mToken = value_type();
+						return;
+					}
+
+					const char_type* const pEnd = mpView->mText.data() + mpView->mText.size();
+					const value_type       rest(mpNext, size_t(pEnd - mpNext));
+					const value_type       delimiter = mnSplitsLeft ? mpView->mDelimiter.find(rest) : value_type(pEnd, 0);
+
+					mToken = value_type(mpNext, size_t(delimiter.data() - mpNext));
+
+					if(delimiter.data() == pEnd)
+						mbDone = true;
+					else
+					{
+						mpNext = delimiter.data() + delimiter.size();
+						--mnSplitsLeft;
+					}
+				}
+				while(mToken.empty() && (mpView->mOptions == split_skip_empty));
+			}
+
+			const split_view* mpView;        // NULL once past the last piece.
+			const char_type*  mpNext;
+			value_type        mToken;
+			size_type         mnSplitsLeft;
+			bool              mbDone;        // True once mToken is the last piece.
+		};
+
+		typedef iterator const_iterator;
+
+		split_view(value_type text, const Delimiter& delimiter, split_options options = split_keep_empty, size_type nMaxSplits = size_type(-1))
+			: mText(text), mDelimiter(delimiter), mOptions(options), mnMaxSplits(nMaxSplits) {}
+
+		iterator begin() const { return iterator(this); }
+		iterator end() const   { return iterator(); }
+
+		/// True if there are no pieces, which is only possible with split_skip_empty.
+		bool empty() const { return begin() == end(); }
+
+	protected:
+		value_type    mText;
+		Delimiter     mDelimiter;
+		split_options mOptions;
+		size_type     mnMaxSplits;
+	};
+
+
+	template <typename CharT>
+	inline split_view<split_by_char<CharT> > split(type_identity_t<basic_string_view<CharT> > text, CharT delimiter,
+	                                           split_options options = split_keep_empty, size_t nMaxSplits = size_t(-1))
+	{
+		return split_view<split_by_char<CharT> >(text, split_by_char<CharT>(delimiter), options, nMaxSplits);
+	}
+
+	template <typename CharT>
+	inline split_view<split_by_string<CharT> > split(type_identity_t<basic_string_view<CharT> > text, const CharT* delimiter,
+	                                             split_options options = split_keep_empty, size_t nMaxSplits = size_t(-1))
+	{
+		return split_view<split_by_string<CharT> >(text, by_string(delimiter), options, nMaxSplits);
+	}
+
+	template <typename Delimiter>
+	inline split_view<Delimiter> split(basic_string_view<typename Delimiter::value_type> text, const Delimiter& delimiter,
+	                                   split_options options = split_keep_empty, size_t nMaxSplits = size_t(-1))
+	{
+		return split_view<Delimiter>(text, delimiter, options, nMaxSplits);
+	}
+
+	template <typename CharT>
+	inline split_view<split_by_any_char<CharT> > tokenize(type_identity_t<basic_string_view<CharT> > text, const CharT* delimiters)
+	{
+		return split_view<split_by_any_char<CharT> >(text, split_by_any_char<CharT>(delimiters), split_skip_empty);
+	}
+
+	template <typename CharT>
+	inline split_view<split_by_any_char<CharT> > tokenize(type_identity_t<basic_string_view<CharT> > text, basic_string_view<CharT> delimiters)
+	{
+		return split_view<split_by_any_char<CharT> >(text, split_by_any_char<CharT>(delimiters), split_skip_empty);
+	}
+
+
 	/// hash<string_view>
 	///
 	/// We provide EASTL hash function objects for use in hash table containers.
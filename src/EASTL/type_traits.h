@@ -861,7 +861,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_add_lvalue_reference_CONFORMANCE 1    // add_lvalue_reference is conforming.
 
-	namespace internal
+	namespace Internal
 	{
 		template <typename T>
 		auto try_add_lvalue_reference(int)->type_identity<T&>;
@@ -870,7 +870,7 @@ namespace std
 		auto try_add_lvalue_reference(...)->type_identity<T>;
 	}
 
-	template <typename T> struct add_lvalue_reference : decltype(internal::try_add_lvalue_reference<T>(0)) {};
+	template <typename T> struct add_lvalue_reference : decltype(Internal::try_add_lvalue_reference<T>(0)) {};
 
 	template <typename T>
 	using add_lvalue_reference_t = typename add_lvalue_reference<T>::type;
@@ -896,7 +896,7 @@ namespace std
 
 	#define EASTL_TYPE_TRAIT_add_rvalue_reference_CONFORMANCE 1
 
-	namespace internal
+	namespace Internal
 	{
 		template <typename T>
 		auto try_add_rvalue_reference(int)->type_identity<T&&>;
@@ -905,7 +905,7 @@ namespace std
 		auto try_add_rvalue_reference(...)->type_identity<T>;
 	}
 
-	template <typename T> struct add_rvalue_reference : decltype(internal::try_add_rvalue_reference<T>(0)) {};
+	template <typename T> struct add_rvalue_reference : decltype(Internal::try_add_rvalue_reference<T>(0)) {};
 
 	template <typename T>
 	using add_rvalue_reference_t = typename add_rvalue_reference<T>::type;
@@ -85,7 +85,7 @@ EA_DISABLE_VC_WARNING(4625) // copy constructor was implicitly defined as delete
 
 namespace std
 {
-	namespace internal
+	namespace Internal
 	{
 		///////////////////////////////////////////////////////////////////////////
 		// default_construct_if_supported<T>
@@ -178,7 +178,7 @@ namespace std
 		{
 			static void call(T*, T*) {} // intentionally blank
 		};
-	} // namespace internal
+	} // namespace Internal
 
 
 	///////////////////////////////////////////////////////////////////////////
@@ -302,25 +302,25 @@ namespace std
 			{
 				case StorageOp::DEFAULT_CONSTRUCT:
 				{
-					internal::default_construct_if_supported<T>::call(pThis);
+					Internal::default_construct_if_supported<T>::call(pThis);
 				}
 				break;
 
 				case StorageOp::DESTROY:
 				{
-					internal::destroy_if_supported<T>::call(pThis);
+					Internal::destroy_if_supported<T>::call(pThis);
 				}
 				break;
 
 				case StorageOp::COPY:
 				{
-					internal::copy_if_supported<T>::call(pThis, pOther);
+					Internal::copy_if_supported<T>::call(pThis, pOther);
 				}
 				break;
 
 				case StorageOp::MOVE:
 				{
-					internal::move_if_supported<T>::call(pThis, pOther);
+					Internal::move_if_supported<T>::call(pThis, pOther);
 				}
 				break;
 
@@ -712,7 +712,7 @@ namespace std
 		// Conversion constructor
 		template <typename T,
 		          typename T_j = meta::overload_resolution_t<T, meta::overload_set<Types...>>,
-		          typename = enable_if_t<!is_same<decay_t<T>::value, variant>>,
+		          typename = enable_if_t<!is_same<decay_t<T>, variant>::value>,
 		          size_t I = meta::get_type_index<decay_t<T_j>, Types...>::value>
 		EA_CONSTEXPR variant(T&& t) EA_NOEXCEPT(is_nothrow_constructible<T_j, T>::value)
 		   : mIndex(variant_npos), mStorage()
@@ -748,7 +748,7 @@ namespace std
 		template <size_t I,
 		          class... Args,
 		          class = enable_if_t<conjunction<integral_constant<bool, (I < sizeof...(Types))>,
-		                                            is_constructible<meta::get_type_at_t<I, Types...>, Args...>>>::value>
+		                                            is_constructible<meta::get_type_at_t<I, Types...>, Args...>>::value>>
 		EA_CPP14_CONSTEXPR explicit variant(in_place_index_t<I>, Args&&... args)
 		    : mIndex(I)
 		{
@@ -759,7 +759,7 @@ namespace std
 		          class U,
 		          class... Args,
 		          class = enable_if_t<conjunction<integral_constant<bool, (I < sizeof...(Types))>,
-		                                            is_constructible<meta::get_type_at_t<I, Types...>, Args...>>>::value>
+		                                            is_constructible<meta::get_type_at_t<I, Types...>, Args...>>::value>>
 		EA_CPP14_CONSTEXPR explicit variant(in_place_index_t<I>, std::initializer_list<U> il, Args&&... args)
 		    : mIndex(I)
 		{
@@ -784,7 +784,7 @@ namespace std
 		    class T,
 		    class... Args,
 		    size_t I = meta::get_type_index<T, Types...>::value,
-		    typename = enable_if_t<conjunction<is_constructible<T, Args...>::value, meta::duplicate_type_check<T, Types...>>>>
+		    typename = enable_if_t<conjunction<is_constructible<T, Args...>, meta::duplicate_type_check<T, Types...>>::value>>
 		decltype(auto) emplace(Args&&... args)
 		{
 			return emplace<I>(std::forward<Args>(args)...);
@@ -886,7 +886,7 @@ namespace std
 		// Only participates in overload resolution if is_copy_constructible_v<T_i> && is_copy_assignable_v<T_i> is true
 		// for all T_i in Types....
 		template <bool enable = conjunction<conjunction<is_copy_constructible<Types>...>,
-		                                      conjunction<is_copy_assignable<Types>...>::value>,
+		                                      conjunction<is_copy_assignable<Types>...>>::value,
 		          typename = enable_if_t<enable>> // add a dependent type to enable sfinae
 		variant& operator=(const variant& other)
 		{
@@ -900,7 +900,7 @@ namespace std
 
 		// Only participates in overload resolution if is_move_constructible_v<T_i> && is_move_assignable_v<T_i> is true for all T_i in Types....
 		template <bool enable = conjunction<conjunction<is_move_constructible<Types>...>,
-		                                      conjunction<is_move_assignable<Types>...>::value>,
+		                                      conjunction<is_move_assignable<Types>...>>::value,
 		          typename = enable_if_t<enable>> // add a dependent type to enable sfinae
 		variant& operator=(variant&& other)
 		    EA_NOEXCEPT(conjunction<conjunction<is_nothrow_move_constructible<Types>...>,
@@ -1144,22 +1144,22 @@ namespace std
 		}
 
 
-		template <typename VariantArgIndexSequence, enable_if_t<internal::index_sequence_size<VariantArgIndexSequence>::value + 1 == sizeof...(Variants), int> = 0>
+		template <typename VariantArgIndexSequence, enable_if_t<Internal::index_sequence_size<VariantArgIndexSequence>::value + 1 == sizeof...(Variants), int> = 0>
 		static EA_CPP14_CONSTEXPR decltype(auto) call(VariantArgIndexSequence, Visitor&& visitor, Variants&&... variants)
 		{
 			EA_CPP14_CONSTEXPR auto callers = make_visitor_array(make_invoke_visitor_leaf(meta::double_pack_expansion_t<VariantArgIndexSequence, VariantIndices>{})...);
 
-			return call_visitor_at<internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
+			return call_visitor_at<Internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
 																							 std::forward<Visitor>(visitor),
 																							 std::forward<Variants>(variants)...);
 		}
 
-		template <typename VariantArgIndexSequence, enable_if_t<internal::index_sequence_size<VariantArgIndexSequence>::value + 1 != sizeof...(Variants), int> = 0>
+		template <typename VariantArgIndexSequence, enable_if_t<Internal::index_sequence_size<VariantArgIndexSequence>::value + 1 != sizeof...(Variants), int> = 0>
 		static EA_CPP14_CONSTEXPR decltype(auto) call(VariantArgIndexSequence, Visitor&& visitor, Variants&&... variants)
 		{
 			EA_CPP14_CONSTEXPR auto callers = make_visitor_array(make_invoke_visitor_recurse(meta::double_pack_expansion_t<VariantArgIndexSequence, VariantIndices>{})...);
 
-			return call_visitor_at<internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
+			return call_visitor_at<Internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
 																							 std::forward<Visitor>(visitor),
 																							 std::forward<Variants>(variants)...);
 		}
@@ -1229,22 +1229,22 @@ namespace std
 		}
 
 
-		template <typename VariantArgIndexSequence, enable_if_t<internal::index_sequence_size<VariantArgIndexSequence>::value + 1 == sizeof...(Variants), int> = 0>
+		template <typename VariantArgIndexSequence, enable_if_t<Internal::index_sequence_size<VariantArgIndexSequence>::value + 1 == sizeof...(Variants), int> = 0>
 		static EA_CPP14_CONSTEXPR decltype(auto) call_r(VariantArgIndexSequence, Visitor&& visitor, Variants&&... variants)
 		{
 			EA_CPP14_CONSTEXPR auto callers = make_visitor_array(make_invoke_visitor_leaf_r<R>(meta::double_pack_expansion_t<VariantArgIndexSequence, VariantIndices>{})...);
 
-			return call_visitor_at<internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
+			return call_visitor_at<Internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
 																							 std::forward<Visitor>(visitor),
 																							 std::forward<Variants>(variants)...);
 		}
 
-		template <typename VariantArgIndexSequence, enable_if_t<internal::index_sequence_size<VariantArgIndexSequence>::value + 1 != sizeof...(Variants), int> = 0>
+		template <typename VariantArgIndexSequence, enable_if_t<Internal::index_sequence_size<VariantArgIndexSequence>::value + 1 != sizeof...(Variants), int> = 0>
 		static EA_CPP14_CONSTEXPR decltype(auto) call_r(VariantArgIndexSequence, Visitor&& visitor, Variants&&... variants)
 		{
 			EA_CPP14_CONSTEXPR auto callers = make_visitor_array(make_invoke_visitor_recurse_r<R>(meta::double_pack_expansion_t<VariantArgIndexSequence, VariantIndices>{})...);
 
-			return call_visitor_at<internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
+			return call_visitor_at<Internal::index_sequence_size<VariantArgIndexSequence>::value>(std::move(callers),
 																							 std::forward<Visitor>(visitor),
 																							 std::forward<Variants>(variants)...);
 		}
@@ -1431,7 +1431,7 @@ namespace std
 	///////////////////////////////////////////////////////////////////////////
 	// 20.7.5, relational operators
 	//
-	namespace internal
+	namespace Internal
 	{
 
 		// For relational operators we do not need to create the NxN matrix of comparisons since we know already
@@ -1501,7 +1501,7 @@ namespace std
 		}
 #endif
 
-	} // namespace internal
+	} // namespace Internal
 
 
 	///////////////////////////////////////////////////////////////////////////
@@ -1513,7 +1513,7 @@ namespace std
 		if (lhs.index() != rhs.index()) return false;
 		if (lhs.valueless_by_exception()) return true;
 
-		return internal::CompareVariantRelational<std::equal_to<>>(lhs, rhs);
+		return Internal::CompareVariantRelational<std::equal_to<>>(lhs, rhs);
 	}
 
 	template <class... Types>
@@ -1522,7 +1522,7 @@ namespace std
 		if (lhs.index() != rhs.index()) return true;
 		if (lhs.valueless_by_exception()) return false;
 
-		return internal::CompareVariantRelational<std::not_equal_to<>>(lhs, rhs);
+		return Internal::CompareVariantRelational<std::not_equal_to<>>(lhs, rhs);
 	}
 
 	template <class... Types>
@@ -1533,7 +1533,7 @@ namespace std
 		if (lhs.index() < rhs.index()) return true;
 		if (lhs.index() > rhs.index()) return false;
 
-		return internal::CompareVariantRelational<std::less<>>(lhs, rhs);
+		return Internal::CompareVariantRelational<std::less<>>(lhs, rhs);
 	}
 
 	template <class... Types>
@@ -1544,7 +1544,7 @@ namespace std
 		if (lhs.index() > rhs.index()) return true;
 		if (lhs.index() < rhs.index()) return false;
 
-		return internal::CompareVariantRelational<std::greater<>>(lhs, rhs);
+		return Internal::CompareVariantRelational<std::greater<>>(lhs, rhs);
 	}
 
 	template <class... Types>
@@ -1555,7 +1555,7 @@ namespace std
 		if (lhs.index() < rhs.index()) return true;
 		if (lhs.index() > rhs.index()) return false;
 
-		return internal::CompareVariantRelational<std::less_equal<>>(lhs, rhs);
+		return Internal::CompareVariantRelational<std::less_equal<>>(lhs, rhs);
 	}
 
 	template <class... Types>
@@ -1566,7 +1566,7 @@ namespace std
 		if (lhs.index() > rhs.index()) return true;
 		if (lhs.index() < rhs.index()) return false;
 
-		return internal::CompareVariantRelational<std::greater_equal<>>(lhs, rhs);
+		return Internal::CompareVariantRelational<std::greater_equal<>>(lhs, rhs);
 	}
 
 #if defined(EA_COMPILER_HAS_THREE_WAY_COMPARISON)
@@ -1578,7 +1578,7 @@ namespace std
 		if (rhs.valueless_by_exception()) return std::strong_ordering::greater;
 		if (auto result = (lhs.index() <=> rhs.index()); result != 0) return result;
 
-		return internal::CompareVariantRelationalThreeWay<std::compare_three_way>(lhs, rhs);
+		return Internal::CompareVariantRelationalThreeWay<std::compare_three_way>(lhs, rhs);
 
 	}
 #endif
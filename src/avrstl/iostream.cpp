@@ -0,0 +1,90 @@
+/*
+ * iostream.cpp
+ * Storage and start-up for cin, cout, cerr and clog
+ *
+ * The streams are built in place by the first ios_base::Init, and every file
+ * that includes iostream holds one of those. Nothing here has a static
+ * constructor of its own, so when no file includes iostream the linker drops
+ * all of it.
+ */
+
+#if defined(__AVR__)
+
+#include "ios"
+#include "istream"
+#include "ostream"
+#include "consolebuf"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+namespace std{
+
+	namespace{
+		alignas(consolebuf) char consolebuf_storage[sizeof(consolebuf)];
+		alignas(istream) char cin_storage[sizeof(istream)];
+		alignas(ostream) char cout_storage[sizeof(ostream)];
+		alignas(ostream) char cerr_storage[sizeof(ostream)];
+		alignas(ostream) char clog_storage[sizeof(ostream)];
+
+#if defined(HAVE_HWSERIAL0) || defined(HAVE_CDCSERIAL)
+		serial_sink<decltype(Serial)> default_sink(Serial);
+#elif !defined(ARDUINO)
+		stdio_sink default_sink;
+#endif
+
+		consolebuf& console(){
+			return reinterpret_cast<consolebuf&>(consolebuf_storage);
+		}
+	}
+
+	istream& cin = reinterpret_cast<istream&>(cin_storage);
+	ostream& cout = reinterpret_cast<ostream&>(cout_storage);
+	ostream& cerr = reinterpret_cast<ostream&>(cerr_storage);
+	ostream& clog = reinterpret_cast<ostream&>(clog_storage);
+
+	int ios_base::Init::init_cnt = 0;
+
+	ios_base::Init::Init(){
+		if(init_cnt++ != 0){
+			return;
+		}
+
+#if defined(HAVE_HWSERIAL0) || defined(HAVE_CDCSERIAL) || !defined(ARDUINO)
+		consolebuf* buf = new (consolebuf_storage) consolebuf(&default_sink);
+#else
+		consolebuf* buf = new (consolebuf_storage) consolebuf();
+#endif
+
+		new (cin_storage) istream(buf);
+		new (cout_storage) ostream(buf);
+		new (cerr_storage) ostream(buf);
+		new (clog_storage) ostream(buf);
+
+		cin.tie(&cout);
+		cerr.tie(&cout);
+		cerr.setf(ios_base::unitbuf);
+	}
+
+	ios_base::Init::~Init(){
+		if(--init_cnt == 0){
+			cout.flush();
+		}
+	}
+
+	void set_console_sink(console_sink* sink){
+		console().sink(sink);
+	}
+
+	console_sink* get_console_sink(){
+		return console().sink();
+	}
+
+	void set_console_flush(console_flush policy, size_t threshold){
+		console().flush_policy(policy, threshold);
+	}
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 // https://en.cppreference.com/w/cpp/algorithm
 
 #include <algorithm>
+#include <numeric>
 #include <random>
 
 inline void TestNonModifyingSequenceOperations()
@@ -49,6 +50,13 @@ inline void TestNonModifyingSequenceOperations()
     // adjacent_find https://en.cppreference.com/w/cpp/algorithm/adjacent_find
     std::adjacent_find(begin, end);
 
+    // 64 bit elements, wider than the word find, count and adjacent_find compare on 32 bit targets
+    int64_t array64[100];
+    std::find(std::begin(array64), std::end(array64), 0);
+    std::count(std::begin(array64), std::end(array64), 0);
+    std::adjacent_find(std::begin(array64), std::end(array64));
+    std::mismatch(std::begin(array64), std::end(array64), std::begin(array64));
+
     // search https://en.cppreference.com/w/cpp/algorithm/search
     std::search(begin, end, begin, end);
 
@@ -269,42 +277,42 @@ inline void TestNonModifyingSequenceOperations()
     // std::prev_permutation(begin, end);
 
     // iota https://en.cppreference.com/w/cpp/algorithm/iota
-    // std::iota(begin, end, 0);
+    std::iota(begin, end, 0);
 
     // accumulate https://en.cppreference.com/w/cpp/algorithm/accumulate
-    // std::accumulate(begin, end, 0);
-    // std::accumulate(begin, end, 0, [](const int&, const int&){ return true; });
+    std::accumulate(begin, end, 0);
+    std::accumulate(begin, end, 0, [](const int&, const int&){ return true; });
 
     // inner_product https://en.cppreference.com/w/cpp/algorithm/inner_product
-    // std::inner_product(begin, end, begin, 0);
-    // std::inner_product(begin, end, begin, 0, [](const int&, const int&){ return true; }, [](const int&, const int&){ return true; });
+    std::inner_product(begin, end, begin, 0);
+    std::inner_product(begin, end, begin, 0, [](const int&, const int&){ return true; }, [](const int&, const int&){ return true; });
 
     // adjacent_difference https://en.cppreference.com/w/cpp/algorithm/adjacent_difference
-    // std::adjacent_difference(begin, end, begin);
-    // std::adjacent_difference(begin, end, begin, [](const int&, const int&){ return true; });
+    std::adjacent_difference(begin, end, begin);
+    std::adjacent_difference(begin, end, begin, [](const int&, const int&){ return true; });
 
     // partial_sum https://en.cppreference.com/w/cpp/algorithm/partial_sum
-    // std::partial_sum(begin, end, begin);
-    // std::partial_sum(begin, end, begin, [](const int&, const int&){ return true; });
+    std::partial_sum(begin, end, begin);
+    std::partial_sum(begin, end, begin, [](const int&, const int&){ return true; });
 
     // reduce https://en.cppreference.com/w/cpp/algorithm/reduce
-    // std::reduce(begin, end, 0);
-    // std::reduce(begin, end, 0, [](const int&, const int&){ return true; });
+    std::reduce(begin, end, 0);
+    std::reduce(begin, end, 0, [](const int&, const int&){ return true; });
 
     // transform_reduce https://en.cppreference.com/w/cpp/algorithm/transform_reduce
-    // std::transform_reduce(begin, end, begin, 0);
-    // std::transform_reduce(begin, end, begin, 0, [](const int&, const int&){ return true; });
-    // std::transform_reduce(begin, end, begin, 0, [](const int&, const int&){ return true; }, [](const int&, const int&){ return true; });
+    std::transform_reduce(begin, end, begin, 0);
+    std::transform_reduce(begin, end, 0, [](const int&, const int&){ return true; }, [](const int&){ return true; });
+    std::transform_reduce(begin, end, begin, 0, [](const int&, const int&){ return true; }, [](const int&, const int&){ return true; });
 
     // exclusive_scan https://en.cppreference.com/w/cpp/algorithm/exclusive_scan
-    // std::exclusive_scan(begin, end, begin, 0);
-    // std::exclusive_scan(begin, end, begin, 0, [](const int&, const int&){ return true; });
+    std::exclusive_scan(begin, end, begin, 0);
+    std::exclusive_scan(begin, end, begin, 0, [](const int&, const int&){ return true; });
 
     // inclusive_scan https://en.cppreference.com/w/cpp/algorithm/inclusive_scan
-    // std::inclusive_scan(begin, end, begin);
-    // std::inclusive_scan(begin, end, begin, [](const int&, const int&){ return true; });
+    std::inclusive_scan(begin, end, begin);
+    std::inclusive_scan(begin, end, begin, [](const int&, const int&){ return true; });
 
     // transform_exclusive_scan https://en.cppreference.com/w/cpp/algorithm/transform_exclusive_scan
-    // std::transform_exclusive_scan(begin, end, begin, 0, [](const int&, const int&){ return true; }, [](const int&, const int&){ return true; });
-    // std::transform_inclusive_scan(begin, end, begin, [](const int&, const int&){ return true; }, [](const int&, const int&){ return true; });
+    std::transform_exclusive_scan(begin, end, begin, 0, [](const int&, const int&){ return true; }, [](const int&){ return true; });
+    std::transform_inclusive_scan(begin, end, begin, [](const int&, const int&){ return true; }, [](const int&){ return true; });
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+// Branchless binary searches and interpolation_lower_bound in EASTL/algorithm.h
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+inline void TestAlgorithmBound()
+{
+    uint8_t bytes[32];
+    int16_t samples[32];
+    uint32_t keys[64];
+    int64_t wide[8];
+    float values[16];
+    std::vector<double> readings(16);
+
+    // lower_bound https://en.cppreference.com/w/cpp/algorithm/lower_bound
+    std::lower_bound(std::begin(bytes), std::end(bytes), 7);
+    std::lower_bound(std::begin(samples), std::end(samples), int16_t(-3));
+    std::lower_bound(std::begin(keys), std::end(keys), 1000u, std::less<uint32_t>());
+    std::lower_bound(std::begin(wide), std::end(wide), int64_t(1));
+    std::lower_bound(std::begin(values), std::end(values), 0.5f, std::greater<float>());
+    std::lower_bound(readings.begin(), readings.end(), 2.5);
+
+    // upper_bound https://en.cppreference.com/w/cpp/algorithm/upper_bound
+    std::upper_bound(std::begin(samples), std::end(samples), int16_t(-3));
+    std::upper_bound(std::begin(keys), std::end(keys), 1000u, std::less<>());
+    std::upper_bound(std::begin(values), std::end(values), 0.5f, std::greater<float>());
+
+    // equal_range and binary_search, which are built on the two above
+    std::equal_range(std::begin(keys), std::end(keys), 1000u);
+    std::binary_search(std::begin(samples), std::end(samples), int16_t(4));
+
+    // interpolation_lower_bound
+    std::interpolation_lower_bound(std::begin(keys), std::end(keys), 1000u);
+    std::interpolation_lower_bound(std::begin(samples), std::end(samples), int16_t(-3));
+    std::interpolation_lower_bound(std::begin(values), std::end(values), 0.5f);
+    std::interpolation_lower_bound(readings.begin(), readings.end(), 2.5);
+}
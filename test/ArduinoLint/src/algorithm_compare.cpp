@@ -0,0 +1,45 @@
+// memcmp paths of equal and lexicographical_compare in EASTL/algorithm.h
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class CompareColor : uint8_t { red, green };
+
+inline void TestAlgorithmCompare()
+{
+    uint8_t bytes[32];
+    char text[16];
+    signed char signedText[16];
+    int16_t words[16];
+    int64_t wide[8];
+    CompareColor colors[4];
+    const char* pointers[4];
+
+    // equal https://en.cppreference.com/w/cpp/algorithm/equal
+    std::equal(std::begin(bytes), std::end(bytes), std::begin(bytes));
+    std::equal(std::begin(words), std::end(words), std::begin(words));
+    std::equal(std::begin(wide), std::end(wide), std::begin(wide));
+    std::equal(std::begin(colors), std::end(colors), std::begin(colors));
+    std::equal(std::begin(pointers), std::end(pointers), std::begin(pointers));
+    std::equal(std::begin(text), std::end(text), std::begin(signedText)); // Mixed types keep the loop.
+
+    // lexicographical_compare https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
+    std::lexicographical_compare(std::begin(bytes), std::end(bytes), std::begin(bytes), std::end(bytes));
+    std::lexicographical_compare(std::begin(text), std::end(text), std::begin(text), std::end(text));
+    std::lexicographical_compare(std::begin(signedText), std::end(signedText), std::begin(signedText), std::end(signedText));
+    std::lexicographical_compare(std::begin(words), std::end(words), std::begin(words), std::end(words));
+    std::lexicographical_compare(std::begin(wide), std::end(wide), std::begin(wide), std::end(wide));
+
+    // container comparisons
+    std::vector<int32_t> a(8), b(8);
+    std::array<uint16_t, 4> c = {}, d = {};
+    std::string e("abc"), f("abd");
+    std::string_view g(e), h(f);
+    (void)(a == b && a < b);
+    (void)(c == d && c < d);
+    (void)(e == f && e < f);
+    (void)(g == h && g < h);
+}
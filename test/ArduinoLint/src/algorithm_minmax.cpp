@@ -0,0 +1,42 @@
+// Vectorized min/max element searches and clamp_transform in EASTL/algorithm.h
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+inline void TestAlgorithmMinmax()
+{
+    int8_t bytes[32];
+    int16_t samples[32];
+    uint32_t counts[16];
+    int64_t wide[8];
+    float values[16];
+    double readings[8];
+    std::vector<int16_t> vector(16);
+
+    // min_element https://en.cppreference.com/w/cpp/algorithm/min_element
+    std::min_element(std::begin(bytes), std::end(bytes));
+    std::min_element(std::begin(samples), std::end(samples));
+    std::min_element(std::begin(wide), std::end(wide));
+    std::min_element(std::begin(readings), std::end(readings));
+
+    // max_element https://en.cppreference.com/w/cpp/algorithm/max_element
+    std::max_element(std::begin(counts), std::end(counts));
+    std::max_element(std::begin(values), std::end(values));
+    std::max_element(vector.begin(), vector.end());
+
+    // minmax_element https://en.cppreference.com/w/cpp/algorithm/minmax_element
+    std::minmax_element(std::begin(bytes), std::end(bytes));
+    std::minmax_element(std::begin(samples), std::end(samples));
+    std::minmax_element(std::begin(wide), std::end(wide));
+    std::minmax_element(std::begin(values), std::end(values));
+    std::minmax_element(std::begin(readings), std::end(readings));
+
+    // clamp_transform
+    std::clamp_transform(std::begin(samples), std::end(samples), std::begin(samples), int16_t(-512), int16_t(511));
+    std::clamp_transform(std::begin(values), std::end(values), std::begin(values), -1.0f, 1.0f);
+    std::clamp_transform(std::begin(readings), std::end(readings), std::begin(readings), 0.0, 5.0, std::less<double>());
+    std::clamp_transform(vector.begin(), vector.end(), std::begin(samples), int16_t(0), int16_t(100));
+    std::clamp_transform(std::begin(counts), std::end(counts), std::back_inserter(vector), 0u, 1000u);
+}
@@ -0,0 +1,77 @@
+// Binary serialization in EASTL/archive.h
+
+#include <EASTL/archive.h>
+#include <EASTL/fixed_string.h>
+#include <EASTL/fixed_vector.h>
+#include <array>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct ArchiveSample
+{
+    uint32_t time;
+    float value;
+    std::fixed_string<char, 16> name;
+
+    template <typename Archive>
+    void serialize(Archive& ar) { ar(time, value, name); }
+};
+
+enum class ArchiveMode : uint8_t { idle, run };
+
+struct StreamStub
+{
+    size_t readBytes(uint8_t*, size_t) { return 0; }
+};
+
+inline void TestArchive()
+{
+    std::vector<ArchiveSample> samples(2);
+    std::map<uint16_t, std::string> names;
+    std::fixed_vector<int16_t, 8, false> readings;
+    std::array<uint8_t, 4> address = {};
+    std::pair<ArchiveMode, bool> state(ArchiveMode::run, true);
+    std::tuple<int32_t, float> pid(1, 0.5f);
+    std::optional<uint16_t> limit(uint16_t(100));
+    uint8_t frame[128];
+
+    // binary_oarchive
+    std::buffer_writer out(frame, sizeof(frame));
+    std::binary_oarchive<std::buffer_writer> oa(out);
+    oa << samples << names;
+    oa(readings, address, state, pid, limit);
+    oa.write_length(300).write_array(address.data(), address.size());
+    (void)(oa.good() && out.size() <= out.capacity());
+
+    std::vector<uint8_t> bytes;
+    std::container_writer<std::vector<uint8_t>> appender(bytes);
+    std::binary_oarchive<std::container_writer<std::vector<uint8_t>>, std::endian::big> be(appender);
+    be << readings << pid;
+
+    std::counting_writer counter;
+    std::binary_oarchive<std::counting_writer> sizer(counter);
+    sizer << samples;
+    (void)counter.size();
+
+    // binary_iarchive
+    std::buffer_reader in(frame, out.size());
+    std::binary_iarchive<std::buffer_reader> ia(in);
+    ia >> samples >> names;
+    ia(readings, address, state, pid, limit);
+    size_t length;
+    ia.read_length(length).read_array(address.data(), address.size());
+    if(!ia)
+        ia.set_fail();
+
+    std::buffer_reader bein(bytes.data(), bytes.size());
+    std::binary_iarchive<std::buffer_reader, std::endian::big> bia(bein);
+    bia >> readings >> pid;
+
+    StreamStub stream;
+    std::stream_reader<StreamStub> streamIn(stream);
+    std::binary_iarchive<std::stream_reader<StreamStub>> sia(streamIn);
+    sia >> limit;
+    (void)sia.fail();
+}
@@ -0,0 +1,40 @@
+// Deferred formatting log in EASTL/bonus/binary_log.h
+
+#include <EASTL/bonus/binary_log.h>
+
+struct BinaryLogWriter
+{
+    size_t write(const uint8_t*, size_t n) { return n; }
+};
+
+// One site, logged to either log
+inline void LogFromHelper(std::binary_log<128>& log, int value)
+{
+    EASTL_BINARY_LOG(log, "helper %d", value);
+}
+
+inline void TestBinaryLog()
+{
+    std::binary_log<128> log, other;
+    std::binary_log<64, std::log_drop_newest> dropping;
+
+    // EASTL_BINARY_LOG
+    EASTL_BINARY_LOG(log, "no arguments");
+    EASTL_BINARY_LOG(log, "pid e=%d u=%.3f", 42, 1.5f);
+    EASTL_BINARY_LOG(log, "state %s %c %lu", "idle", 'x', 7ul);
+    EASTL_BINARY_LOG(dropping, "%u", 1u);
+    LogFromHelper(log, 1);
+    LogFromHelper(other, 2);
+
+    // format_next
+    char line[64];
+    while(log.format_next(line, sizeof(line)))
+        (void)line;
+
+    // drain
+    BinaryLogWriter writer;
+    dropping.drain(writer);
+    other.drain(writer);
+    other.reset_stream();
+    other.drain(writer, 1);
+}
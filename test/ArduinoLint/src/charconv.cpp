@@ -0,0 +1,43 @@
+// https://en.cppreference.com/w/cpp/header/charconv
+
+#include <charconv>
+
+inline void TestToChars()
+{
+    char buffer[32];
+
+    // to_chars https://en.cppreference.com/w/cpp/utility/to_chars
+    std::to_chars(buffer, buffer + sizeof(buffer), 42);
+    std::to_chars(buffer, buffer + sizeof(buffer), -42L, 16);
+    std::to_chars(buffer, buffer + sizeof(buffer), 42ULL, 2);
+    std::to_chars(buffer, buffer + sizeof(buffer), 1.5f);
+    std::to_chars(buffer, buffer + sizeof(buffer), 1.5);
+    std::to_chars(buffer, buffer + sizeof(buffer), 1.5, std::chars_format::scientific);
+    std::to_chars(buffer, buffer + sizeof(buffer), 1.5, std::chars_format::fixed);
+    std::to_chars(buffer, buffer + sizeof(buffer), 1.5, std::chars_format::general);
+    std::to_chars(buffer, buffer + sizeof(buffer), 1.5, std::chars_format::hex);
+
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), 42);
+    (void)(result.ec == std::errc());
+    (void)(result.ptr - buffer);
+}
+
+inline void TestFromChars()
+{
+    const char* str = "42";
+    int i;
+    unsigned long ul;
+    float f;
+    double d;
+
+    // from_chars https://en.cppreference.com/w/cpp/utility/from_chars
+    std::from_chars(str, str + 2, i);
+    std::from_chars(str, str + 2, ul, 16);
+    std::from_chars(str, str + 2, f);
+    std::from_chars(str, str + 2, d, std::chars_format::fixed);
+
+    std::from_chars_result result = std::from_chars(str, str + 2, i);
+    (void)(result.ec == std::errc::invalid_argument);
+    (void)(result.ec == std::errc::result_out_of_range);
+    (void)(result.ptr - str);
+}
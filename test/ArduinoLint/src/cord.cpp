@@ -0,0 +1,54 @@
+// Chunked string in EASTL/cord.h
+
+#include <EASTL/cord.h>
+#include <string>
+
+struct CordSink
+{
+    size_t sputn(const char*, size_t n) { return n; }
+};
+
+inline void TestCord()
+{
+    std::cord frame;
+    std::basic_cord<char, 16> small("header");
+
+    // append
+    frame += "{\"id\":";
+    frame += std::string("42");
+    frame += std::string_view(",\"v\":");
+    frame.append("1234", 2);
+    frame.append(3, ' ');
+    frame.push_back('}');
+    frame.append(std::cord(frame));
+
+    // element access
+    (void)(frame[0] + frame.front() + frame.back());
+    (void)(frame.size() + frame.length());
+    (void)frame.empty();
+
+    // substr, copy and flatten
+    std::cord header = frame.substr(0, 4);
+    char buffer[8];
+    (void)header.copy(buffer, sizeof(buffer));
+    std::string text = frame.flatten();
+    frame.flatten(text);
+    (void)(header == frame);
+    (void)(header != frame);
+
+    // chunks
+    for(std::cord::const_chunk_iterator it = frame.chunk_begin(); it != frame.chunk_end(); ++it)
+        (void)(*it).size();
+    frame.for_each_chunk([](std::string_view piece){ (void)piece; });
+    (void)frame.chunk_count();
+    CordSink sink;
+    (void)frame.write_to(sink);
+
+    // modifiers
+    std::cord other("other");
+    other.swap(header);
+    small += "!";
+    header = std::string_view("reset");
+    frame.clear();
+    (void)frame.validate();
+}
@@ -0,0 +1,53 @@
+// https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag
+
+#include <execution>
+#include <algorithm>
+#include <numeric>
+
+inline void TestExecutionPolicies()
+{
+    int array[100];
+    int result[100];
+    auto begin = std::begin(array);
+    auto end = std::end(array);
+
+    // fill https://en.cppreference.com/w/cpp/algorithm/fill
+    std::fill(std::execution::seq, begin, end, 0);
+
+    // copy https://en.cppreference.com/w/cpp/algorithm/copy
+    std::copy(std::execution::par, begin, end, result);
+
+    // for_each https://en.cppreference.com/w/cpp/algorithm/for_each
+    std::for_each(std::execution::par_unseq, begin, end, [](int& value){ ++value; });
+
+    // transform https://en.cppreference.com/w/cpp/algorithm/transform
+    std::transform(std::execution::unseq, begin, end, result, [](const int& value){ return value * 2; });
+    std::transform(std::execution::par, begin, end, result, result, [](const int& a, const int& b){ return a + b; });
+
+    // find https://en.cppreference.com/w/cpp/algorithm/find
+    std::find(std::execution::par, begin, end, 0);
+
+    // count https://en.cppreference.com/w/cpp/algorithm/count
+    std::count(std::execution::par, begin, end, 0);
+
+    // minmax_element https://en.cppreference.com/w/cpp/algorithm/minmax_element
+    std::minmax_element(std::execution::par, begin, end);
+
+    // sort https://en.cppreference.com/w/cpp/algorithm/sort
+    std::sort(std::execution::par, begin, end);
+    std::sort(std::execution::par, begin, end, [](const int& a, const int& b){ return a > b; });
+
+    // stable_sort https://en.cppreference.com/w/cpp/algorithm/stable_sort
+    std::stable_sort(std::execution::par, begin, end);
+
+    // reduce https://en.cppreference.com/w/cpp/algorithm/reduce
+    std::reduce(std::execution::par, begin, end);
+    std::reduce(std::execution::par, begin, end, 0L, [](long a, int b){ return a + b; });
+
+    // transform_reduce https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+    std::transform_reduce(std::execution::par, begin, end, result, 0L);
+    std::transform_reduce(std::execution::par, begin, end, 0L, std::plus<long>(), [](const int& value){ return long(value); });
+
+    // inclusive_scan https://en.cppreference.com/w/cpp/algorithm/inclusive_scan
+    std::inclusive_scan(std::execution::par, begin, end, result);
+}
@@ -0,0 +1,54 @@
+// https://en.cppreference.com/w/cpp/header/format
+
+#include <format>
+#include <chrono>
+#include <vector>
+#include <EASTL/fixed_string.h>
+
+struct Point
+{
+    int x, y;
+};
+
+namespace std
+{
+    template <>
+    struct formatter<Point>
+    {
+        format_parse_context::iterator parse(format_parse_context& ctx) { return ctx.begin(); }
+
+        format_context::iterator format(const Point& p, format_context& ctx) const
+        {
+            return format_to(ctx.out(), "({}, {})", p.x, p.y);
+        }
+    };
+}
+
+inline void TestFormat()
+{
+    char buffer[64];
+
+    // format_to https://en.cppreference.com/w/cpp/utility/format/format_to
+    std::format_to(buffer, "{} {:>8.3f} {:#x}", 42, 3.14159, 255u);
+
+    std::fixed_string<char, 32, false> str;
+    std::format_to(std::back_inserter(str), "{:*^10}", "center");
+
+    // format_to_n https://en.cppreference.com/w/cpp/utility/format/format_to_n
+    std::format_to_n_result<char*> result = std::format_to_n(buffer, sizeof(buffer) - 1, "{1}{0}", 'a', true);
+    *result.out = '\0';
+    (void)result.size;
+
+    // formatted_size https://en.cppreference.com/w/cpp/utility/format/formatted_size
+    (void)std::formatted_size("{:{}}", 1, 10);
+
+    // format https://en.cppreference.com/w/cpp/utility/format/format
+    std::string s = std::format("{} {}", Point{ 1, 2 }, std::chrono::milliseconds(5));
+
+    std::vector<int> v(3, 1);
+    std::format_to(buffer, "{} {::02x}", v, v);
+
+    // vformat https://en.cppreference.com/w/cpp/utility/format/vformat
+    int i = 1;
+    s = std::vformat("{}", std::make_format_args(i));
+}
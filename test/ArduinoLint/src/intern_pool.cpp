@@ -0,0 +1,31 @@
+// String interning in EASTL/intern_pool.h
+
+#include <EASTL/intern_pool.h>
+
+inline void TestInternPool()
+{
+    std::intern_pool<> pool;
+    std::intern_pool<uint32_t, 64> pool32;
+
+    // find_or_insert, find, contains
+    std::atom gain = pool.find_or_insert("motor.gain");
+    std::atom same = pool.find_or_insert(std::string_view("motor.gain"));
+    (void)(gain == same);
+    (void)pool.find("motor.gain").valid();
+    (void)pool.contains("motor.limit");
+    (void)pool32.find_or_insert("topic").index();
+    (void)(pool.find_or_insert(std::string_view()) == pool.find_or_insert(""));
+
+    // reverse lookup
+    std::string_view name = pool.str(gain);
+    const char* pName = pool.c_str(gain);
+    (void)pool[gain];
+    (void)name;
+    (void)pName;
+
+    // capacity
+    pool.reserve(16);
+    (void)(pool.size() + pool.bytes_used());
+    (void)pool.empty();
+    pool.clear();
+}
@@ -1 +1,43 @@
-#include <iostream>
\ No newline at end of file
+// https://en.cppreference.com/w/cpp/header/iostream
+
+#include <iostream>
+#include <iomanip>
+#include <avrstl/fast_ostream>
+#include <string>
+#include <EASTL/fixed_string.h>
+
+inline void TestIostream()
+{
+    // cout https://en.cppreference.com/w/cpp/io/cout
+    std::cout << "value: " << 42 << ' ' << std::hex << 255 << std::dec << std::endl;
+    std::cout << std::setw(8) << std::string("right") << '\n';
+    std::cout << std::left << std::setw(8) << -1 << std::internal << std::setw(8) << -1 << std::right << '\n';
+    std::cerr << "error" << '\n';
+    std::clog << "log" << std::endl;
+
+    // cin https://en.cppreference.com/w/cpp/io/cin
+    int value;
+    std::string word, line;
+    std::cin >> value >> word;
+    double reading;
+    long long count;
+    std::cin >> reading >> std::hex >> count >> std::dec;
+    std::getline(std::cin, line);
+
+    // sink and flush policy
+    std::fixed_string<char, 64, false> captured;
+    std::container_sink<std::fixed_string<char, 64, false>> sink(captured);
+    std::console_sink* previous = std::get_console_sink();
+    std::set_console_sink(&sink);
+    std::set_console_flush(std::console_flush_size, 16);
+    std::cout << "captured" << std::flush;
+    std::set_console_flush(std::console_flush_newline);
+    std::set_console_sink(previous);
+
+    // fast_ostream over a sink known at compile time
+    char buffer[32];
+    std::fast_ostream<std::array_fast_sink> fast(buffer);
+    fast << "t=" << 12 << ' ' << std::fixed << std::setprecision(1) << 2.5 << std::endl;
+    std::fast_ostream<std::streambuf_fast_sink<> > fastcout(std::cout.rdbuf());
+    fastcout << std::hex << 255 << ' ' << std::string("hex") << '\n';
+}
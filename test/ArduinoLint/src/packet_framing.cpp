@@ -0,0 +1,30 @@
+// COBS/SLIP framing in EASTL/bonus/packet_framing.h
+
+#include <EASTL/bonus/packet_framing.h>
+#include <EASTL/bonus/fixed_ring_buffer.h>
+
+inline void TestPacketFraming()
+{
+    uint8_t payload[8] = {};
+    uint8_t frame[64];
+    uint8_t out[std::cobs_encoder<>::max_frame_size(sizeof(payload))];
+
+    // encode
+    size_t n = std::cobs_encoder<>::encode(payload, sizeof(payload), out, sizeof(out));
+
+    // consume from an array
+    std::cobs_decoder<> decoder(frame, sizeof(frame));
+    decoder.consume(out, n);
+
+    // consume from a ring buffer
+    std::fixed_ring_buffer<uint8_t, 128> rx(128);
+    rx.insert(rx.end(), out, out + n);
+    while(decoder.consume(rx) != std::frame_incomplete)
+    {
+        if(decoder.status() == std::frame_ok)
+            (void)(decoder.data() + decoder.size());
+    }
+
+    std::slip_decoder<std::crc32> slip(frame, sizeof(frame));
+    slip.consume(rx);
+}
@@ -0,0 +1,17 @@
+// https://en.cppreference.com/w/cpp/header/regex
+
+#include <regex>
+#include <string>
+
+inline void TestStaticRegex()
+{
+    typedef EASTL_STATIC_REGEX("set ([a-z]+) (-?\\d+)") SetCommand;
+
+    // match, search, starts_with
+    SetCommand::results_type m = SetCommand::match("set speed -42");
+    std::string_view name = m.get<1>();
+    std::string_view value = m[2];
+    bool found = bool(EASTL_STATIC_REGEX("\\d+")::search(std::string("G1 X20")));
+    bool prefix = bool(EASTL_STATIC_REGEX("G(\\d+)")::starts_with("G1 X20"));
+    (void)name; (void)value; (void)found; (void)prefix;
+}
@@ -0,0 +1,48 @@
+// Serial streams in avrstl/serstream
+
+#include <avrstl/serstream>
+#include <string>
+
+struct SerialStub
+{
+    void begin(long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    size_t readBytes(char*, size_t) { return 0; }
+    size_t write(uint8_t) { return 1; }
+    size_t write(const uint8_t*, size_t n) { return n; }
+};
+
+inline void TestSerstream()
+{
+    SerialStub serial;
+    typedef std::basic_serialbuf<char, std::char_traits<char>, SerialStub> serialbuf;
+    typedef std::basic_buffered_serialbuf<char, std::char_traits<char>, SerialStub> bufserialbuf;
+    typedef std::basic_buffered_serialbuf<char, std::char_traits<char>, SerialStub, 64, 0> putbufserialbuf;
+
+    // unbuffered streams
+    std::basic_oserialstream<char, std::char_traits<char>, SerialStub> out(serial);
+    std::basic_iserialstream<char, std::char_traits<char>, SerialStub, serialbuf> in(serial);
+    out.begin(115200);
+    out << "temp=" << 21 << '\n';
+
+    // buffered streams
+    std::basic_oserialstream<char, std::char_traits<char>, SerialStub, bufserialbuf> bout(serial);
+    std::basic_iserialstream<char, std::char_traits<char>, SerialStub, bufserialbuf> bin(serial);
+    std::basic_ioserialstream<char, std::char_traits<char>, SerialStub, putbufserialbuf> bio(serial);
+    bout << "temp=" << 21 << std::endl;
+    bout.write("0123456789abcdef0123456789abcdef0123456789", 42);
+    bout.flush();
+    bio << "ok" << std::flush;
+
+    // input
+    int value;
+    std::string word;
+    char buffer[24];
+    in >> value;
+    bin >> value >> word;
+    (void)bin.readsome(buffer, sizeof(buffer));
+    bin.read(buffer, sizeof(buffer));
+    (void)bin.rdbuf()->in_avail();
+}
@@ -0,0 +1,69 @@
+// Sorting algorithms in EASTL/sort.h
+
+#include <EASTL/sort.h>
+#include <functional>
+#include <vector>
+
+struct SortRecord
+{
+    int16_t key;
+    uint8_t id;
+};
+
+struct RadixRecord
+{
+    typedef int32_t radix_type;
+    int32_t mKey;
+    uint8_t id;
+};
+
+inline void TestSort()
+{
+    int array[64];
+    float values[16];
+    SortRecord records[8];
+    std::vector<uint32_t> vector(32);
+    auto begin = std::begin(array);
+    auto end = std::end(array);
+    auto byKey = [](const SortRecord& a, const SortRecord& b){ return a.key < b.key; };
+
+    // sort, which is pdq_sort unless EASTL_DEFAULT_SORT_FUNCTION says otherwise
+    std::sort(begin, end);
+    std::sort(begin, end, std::greater<int>());
+
+    // pdq_sort
+    std::pdq_sort(begin, end);
+    std::pdq_sort(begin, end, std::less<>());
+    std::pdq_sort(begin, end, std::greater<int>());
+    std::pdq_sort(std::begin(values), std::end(values));
+    std::pdq_sort(vector.begin(), vector.end());
+    std::pdq_sort(std::begin(records), std::end(records), byKey);
+
+    // quick_sort
+    std::quick_sort(begin, end);
+
+    // in_place_merge_sort, stable and allocation free
+    std::in_place_merge_sort(begin, end);
+    std::in_place_merge_sort(std::begin(records), std::end(records), byKey);
+    std::in_place_merge_sort(vector.begin(), vector.end(), std::greater<uint32_t>());
+
+    // merge_sort, which falls back to in_place_merge_sort when it cannot allocate
+    std::allocator allocator;
+    std::merge_sort(begin, end, allocator);
+    std::merge_sort(std::begin(records), std::end(records), allocator, byKey);
+
+    // radix_sort on integral and floating point keys
+    int array2[64];
+    float values2[16];
+    RadixRecord radixRecords[8], radixBuffer[8];
+    std::radix_sort(begin, end, std::begin(array2));
+    std::radix_sort(std::begin(values), std::end(values), std::begin(values2));
+    std::radix_sort<RadixRecord*, std::Internal::extract_radix_key<RadixRecord> >(std::begin(radixRecords), std::end(radixRecords), radixBuffer);
+    std::radix_sort<RadixRecord*, std::Internal::extract_radix_key<RadixRecord>, 11>(std::begin(radixRecords), std::end(radixRecords), radixBuffer);
+
+    // in_place_radix_sort
+    std::in_place_radix_sort(begin, end);
+    std::in_place_radix_sort(std::begin(values), std::end(values));
+    std::in_place_radix_sort(vector.begin(), vector.end());
+    std::in_place_radix_sort<RadixRecord*, std::Internal::extract_radix_key<RadixRecord>, 4>(std::begin(radixRecords), std::end(radixRecords));
+}
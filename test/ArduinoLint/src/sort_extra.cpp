@@ -0,0 +1,38 @@
+// Sorting networks in EASTL/bonus/sort_extra.h
+
+#include <EASTL/bonus/sort_extra.h>
+#include <array>
+#include <functional>
+
+struct StaticSortPoint
+{
+    int16_t x, y;
+};
+
+inline void TestStaticSort()
+{
+    int samples[5];
+    uint8_t bytes[16];
+    double readings[3];
+    const char* names[4];
+    std::array<float, 8> values;
+    StaticSortPoint points[6];
+    int* pointers[2];
+
+    // C arrays, N deduced
+    std::static_sort(samples);
+    std::static_sort(bytes);
+    std::static_sort(readings, std::greater<double>());
+    std::static_sort(names);
+    std::static_sort(points, [](const StaticSortPoint& a, const StaticSortPoint& b){ return a.x < b.x; });
+    std::static_sort(pointers);
+
+    // std::array
+    std::static_sort(values);
+    std::static_sort(values, std::greater<float>());
+
+    // iterators, N given
+    std::static_sort<1>(samples);
+    std::static_sort<3>(samples + 1);
+    std::static_sort<4>(values.begin(), std::greater<float>());
+}
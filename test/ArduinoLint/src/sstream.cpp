@@ -1 +1,35 @@
-#include <sstream>
\ No newline at end of file
+// https://en.cppreference.com/w/cpp/header/sstream
+
+#include <sstream>
+#include <spanstream>
+#include <string>
+
+inline void TestSstream()
+{
+    // ostringstream https://en.cppreference.com/w/cpp/io/basic_ostringstream
+    std::ostringstream out;
+    out << "id=" << 7 << ' ' << 2.5f;
+    std::string text = out.str();
+    std::string_view view = out.str_view();
+
+    // istringstream https://en.cppreference.com/w/cpp/io/basic_istringstream
+    std::istringstream in("12 34.5 word");
+    int number;
+    double real;
+    std::string word;
+    in >> number >> real >> word;
+
+    // stringstream https://en.cppreference.com/w/cpp/io/basic_stringstream
+    std::stringstream both;
+    both << 42;
+    both >> number;
+
+    // spanstream https://en.cppreference.com/w/cpp/io/basic_spanstream
+    char buffer[16];
+    std::ospanstream span(std::span<char>(buffer, sizeof(buffer)));
+    span << number;
+    std::fixed_ostringstream<32> fixed;
+    fixed << "t=" << 12;
+    const char* line = fixed.c_str();
+    (void)text; (void)view; (void)line;
+}
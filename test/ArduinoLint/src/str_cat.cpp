@@ -0,0 +1,22 @@
+// str_cat and str_append in EASTL/string.h
+
+#include <string>
+#include <string_view>
+
+inline void TestStrCat()
+{
+    std::string name("motor");
+    std::string_view unit("rpm");
+    const int8_t channel = 3;
+    const uint16_t id = 513;
+
+    // str_cat
+    std::string empty = std::str_cat();
+    std::string line = std::str_cat(name, '[', channel, "] ", -1200, ' ', unit);
+    std::string wide = std::str_cat(id, ' ', 4000000000ul, ' ', -9000000000ll, ' ', 18000000000000000000ull);
+
+    // str_append
+    std::str_append(line);
+    std::str_append(line, " id=", id, ' ', name, ' ', unit);
+    (void)(empty.size() + wide.size());
+}
@@ -0,0 +1,28 @@
+// https://en.cppreference.com/w/cpp/header/string_view
+
+#include <string_view>
+
+inline void TestSplit()
+{
+    std::string_view line("key=a,,b");
+
+    // split by a character, a string or any of a set of characters
+    for(std::string_view field : std::split(line, ','))
+        (void)field;
+    for(std::string_view field : std::split(line, "=a"))
+        (void)field;
+    for(std::string_view field : std::split(line, std::by_any_char("=,"), std::split_skip_empty))
+        (void)field;
+
+    // nMaxSplits
+    auto kv = std::split(line, '=', std::split_keep_empty, 1);
+    (void)kv.empty();
+
+    // tokenize
+    for(std::string_view word : std::tokenize(std::string_view("run  fast\t"), " \t"))
+        (void)word;
+
+    // An empty and a default constructed view both give one empty piece.
+    (void)std::split(std::string_view(), ',').begin()->size();
+    (void)std::split(std::string_view(""), ',').begin()->size();
+}
@@ -0,0 +1,25 @@
+// Timing comparisons for the library's containers and algorithms.
+// Upload, then read the results from the serial monitor at 115200 baud.
+
+#include "src/benchmark.h"
+
+void setup()
+{
+    Serial.begin(115200);
+    while(!Serial) {}
+
+    BenchmarkCord();
+    BenchmarkStrCat();
+    BenchmarkSerstream();
+    BenchmarkSort();
+    BenchmarkStableSort();
+    BenchmarkRadixSort();
+    BenchmarkStaticSort();
+    BenchmarkCompare();
+    BenchmarkMinmax();
+    BenchmarkBound();
+
+    Serial.println("done");
+}
+
+void loop() {}
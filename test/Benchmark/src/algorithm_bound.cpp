@@ -0,0 +1,62 @@
+// lower_bound against its loop and interpolation_lower_bound
+//
+// A lambda comparator keeps the loop; less and greater take the branchless
+// search where it is enabled, which is not on AVR. Each query draws a new
+// random key in the range of the table, and that cost is counted in every
+// variant.
+
+#include "benchmark.h"
+#include <algorithm>
+#include <EASTL/sort.h>
+#include <vector>
+
+namespace
+{
+    template <typename Search>
+    void TimeQueries(const char* key, const char* name, const std::vector<uint32_t>& table, Search search)
+    {
+        const size_t queries = BENCHMARK_N;
+        const uint32_t lo = table.front();
+        const uint32_t span = table.back() - lo + 1;
+
+        benchmark::report(key, name, queries, benchmark::best_us([]{ benchmark::seed(2); }, [&]{
+            for(size_t i = 0; i < queries; ++i)
+            {
+                const uint32_t value = span ? lo + benchmark::random() % span : lo;
+                benchmark::keep((uint32_t)(search(table.data(), table.data() + table.size(), value) - table.data()));
+            }
+        }));
+    }
+
+    void TimeTable(const char* key, const std::vector<uint32_t>& table)
+    {
+        TimeQueries(key, "lower_bound(loop)", table, [](const uint32_t* first, const uint32_t* last, uint32_t value){
+            return std::lower_bound(first, last, value, [](uint32_t a, uint32_t b){ return a < b; });
+        });
+        TimeQueries(key, "lower_bound", table, [](const uint32_t* first, const uint32_t* last, uint32_t value){
+            return std::lower_bound(first, last, value);
+        });
+        TimeQueries(key, "interpolation_lower_bound", table, [](const uint32_t* first, const uint32_t* last, uint32_t value){
+            return std::interpolation_lower_bound(first, last, value);
+        });
+    }
+}
+
+void BenchmarkBound()
+{
+    std::vector<uint32_t> table(BENCHMARK_N);
+
+    benchmark::seed(1);
+    for(size_t i = 0; i < table.size(); ++i)
+        table[i] = benchmark::random();
+    std::sort(table.begin(), table.end());
+    TimeTable("uniform", table);
+
+    // Cubic keys crowd at the low end, which interpolation guesses badly.
+    for(size_t i = 0; i < table.size(); ++i)
+    {
+        const uint32_t x = table[i] >> 22; // 10 bits, so x^3 fits in 32.
+        table[i] = x * x * x;
+    }
+    TimeTable("cubic", table);
+}
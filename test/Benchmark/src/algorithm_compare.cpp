@@ -0,0 +1,49 @@
+// equal and lexicographical_compare against the plain loops they replace
+//
+// Passing a predicate keeps the element by element loop. Both ranges are
+// equal up to the last element, so every variant reads all of them.
+
+#include "benchmark.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    void TimeCompare(const char* key)
+    {
+        const size_t n = 2 * BENCHMARK_N / sizeof(T); // The same number of bytes for every T.
+        const size_t repeat = 16;
+        std::vector<T> a(n), b(n);
+
+        benchmark::seed(1);
+        for(size_t i = 0; i < n; ++i)
+            a[i] = b[i] = (T)benchmark::random();
+        b[n - 1] = (T)(a[n - 1] + 1);
+
+        benchmark::report(key, "equal", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep(std::equal(a.begin(), a.end(), b.begin()));
+        }));
+        benchmark::report(key, "equal(loop)", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep(std::equal(a.begin(), a.end(), b.begin(), std::equal_to<T>()));
+        }));
+        benchmark::report(key, "lexicographical_compare", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep(std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+        }));
+        benchmark::report(key, "lexicographical_compare(loop)", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep(std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), std::less<T>()));
+        }));
+    }
+}
+
+void BenchmarkCompare()
+{
+    TimeCompare<uint8_t>("uint8");
+    TimeCompare<int16_t>("int16");
+    TimeCompare<int32_t>("int32");
+}
@@ -0,0 +1,59 @@
+// min_element, minmax_element and clamp_transform against their scalar loops
+//
+// Passing a comparator keeps the scalar loop. The kernels are only used on
+// targets with a vector unit, so on AVR and Cortex-M both columns match.
+
+#include "benchmark.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    void TimeMinmax(const char* key, T lo, T hi)
+    {
+        const size_t n = BENCHMARK_N;
+        const size_t repeat = 16;
+        std::vector<T> data(n);
+
+        benchmark::seed(1);
+        for(size_t i = 0; i < n; ++i)
+            data[i] = (T)(int16_t)benchmark::random();
+
+        benchmark::report(key, "min_element", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep((uint32_t)(std::min_element(data.begin(), data.end()) - data.begin()));
+        }));
+        benchmark::report(key, "min_element(loop)", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep((uint32_t)(std::min_element(data.begin(), data.end(), std::less<T>()) - data.begin()));
+        }));
+        benchmark::report(key, "minmax_element", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep((uint32_t)(std::minmax_element(data.begin(), data.end()).second - data.begin()));
+        }));
+        benchmark::report(key, "minmax_element(loop)", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                benchmark::keep((uint32_t)(std::minmax_element(data.begin(), data.end(), std::less<T>()).second - data.begin()));
+        }));
+
+        // Clamping in place is idempotent, so every repeat does the same work.
+        benchmark::report(key, "clamp_transform", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                std::clamp_transform(data.begin(), data.end(), data.begin(), lo, hi);
+            benchmark::keep((uint32_t)data[0]);
+        }));
+        benchmark::report(key, "clamp_transform(loop)", n * repeat, benchmark::best_us([&]{
+            for(size_t r = 0; r < repeat; ++r)
+                std::clamp_transform(data.begin(), data.end(), data.begin(), lo, hi, std::less<T>());
+            benchmark::keep((uint32_t)data[0]);
+        }));
+    }
+}
+
+void BenchmarkMinmax()
+{
+    TimeMinmax<int16_t>("int16", -1000, 1000);
+    TimeMinmax<float>("float", -1000.0f, 1000.0f);
+}
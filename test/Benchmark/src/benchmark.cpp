@@ -0,0 +1,40 @@
+// Shared helpers for the Benchmark sketch
+
+#include "benchmark.h"
+
+namespace benchmark
+{
+    static uint32_t state = 2463534242u;
+    static volatile uint32_t sink;
+
+    void report(const char* name, const char* variant, size_t n, uint32_t value, const char* unit)
+    {
+        Serial.print(name);
+        Serial.print(' ');
+        Serial.print(variant);
+        Serial.print(" n=");
+        Serial.print((unsigned long)n);
+        Serial.print(' ');
+        Serial.print((unsigned long)value);
+        Serial.print(' ');
+        Serial.println(unit);
+    }
+
+    void seed(uint32_t value)
+    {
+        state = value ? value : 2463534242u;
+    }
+
+    uint32_t random()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    void keep(uint32_t value)
+    {
+        sink = sink + value;
+    }
+}
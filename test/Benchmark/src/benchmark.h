@@ -0,0 +1,76 @@
+// Shared helpers for the Benchmark sketch
+//
+// Each benchmark times the same work done two or more ways and prints one
+// line per variant on Serial (115200 baud):
+//
+//     <name> <variant> n=<elements> <value> <unit>
+//
+// The value is a time in microseconds unless another unit is given.
+// Times are the best of BENCHMARK_RUNS runs. Define BENCHMARK_N to change
+// the problem size; the default fits the RAM of an ATmega328P.
+
+#pragma once
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef BENCHMARK_N
+    #if defined(__AVR__)
+        #define BENCHMARK_N 256
+    #else
+        #define BENCHMARK_N 4096
+    #endif
+#endif
+
+#ifndef BENCHMARK_RUNS
+    #define BENCHMARK_RUNS 5
+#endif
+
+namespace benchmark
+{
+    // Prints one result line.
+    void report(const char* name, const char* variant, size_t n, uint32_t value, const char* unit = "us");
+
+    // xorshift32, so every run and every board sees the same data.
+    void seed(uint32_t value);
+    uint32_t random();
+
+    // Keeps a result alive so the timed work is not optimized away.
+    void keep(uint32_t value);
+
+    // Best time of BENCHMARK_RUNS calls to function. setup runs before each
+    // call, outside the timed region.
+    template <typename Setup, typename Function>
+    uint32_t best_us(Setup setup, Function function)
+    {
+        uint32_t best = UINT32_MAX;
+        for(int run = 0; run < BENCHMARK_RUNS; ++run)
+        {
+            setup();
+            const uint32_t start = micros();
+            function();
+            const uint32_t us = micros() - start;
+            if(us < best)
+                best = us;
+        }
+        return best;
+    }
+
+    template <typename Function>
+    uint32_t best_us(Function function)
+    {
+        return best_us([]{}, function);
+    }
+}
+
+void BenchmarkCord();
+void BenchmarkStrCat();
+void BenchmarkSerstream();
+void BenchmarkSort();
+void BenchmarkStableSort();
+void BenchmarkRadixSort();
+void BenchmarkStaticSort();
+void BenchmarkCompare();
+void BenchmarkMinmax();
+void BenchmarkBound();
@@ -0,0 +1,31 @@
+// basic_cord against basic_string, building one payload from small fragments
+
+#include "benchmark.h"
+#include <EASTL/cord.h>
+#include <string>
+
+namespace
+{
+    const char* const kFragments[] = { "{\"t\":", "21.5", ",\"ok\":", "true", "}\n" };
+}
+
+void BenchmarkCord()
+{
+    const size_t n = BENCHMARK_N; // Payload length in characters.
+
+    benchmark::report("append", "string", n, benchmark::best_us([&]{
+        std::string payload;
+        while(payload.size() < n)
+            for(const char* fragment : kFragments)
+                payload += fragment;
+        benchmark::keep(payload.size());
+    }));
+
+    benchmark::report("append", "cord", n, benchmark::best_us([&]{
+        std::cord payload;
+        while(payload.size() < n)
+            for(const char* fragment : kFragments)
+                payload += fragment;
+        benchmark::keep(payload.size());
+    }));
+}
@@ -0,0 +1,61 @@
+// Unbuffered against buffered serial streams, writing short telemetry lines
+//
+// The serial object here only counts what it is given, so the times measure
+// the stream and the number of calls into the driver, not the baud rate.
+
+#include "benchmark.h"
+#include <avrstl/serstream>
+
+namespace
+{
+    struct CountingSerial
+    {
+        uint32_t calls;
+        uint32_t sum;
+
+        CountingSerial() : calls(0), sum(0) {}
+
+        void begin(long) {}
+        int available() { return 0; }
+        int read() { return -1; }
+        int peek() { return -1; }
+        size_t readBytes(char*, size_t) { return 0; }
+
+        size_t write(uint8_t c)
+        {
+            ++calls;
+            sum += c;
+            return 1;
+        }
+
+        size_t write(const uint8_t* p, size_t n)
+        {
+            ++calls;
+            for(size_t i = 0; i < n; ++i)
+                sum += p[i];
+            return n;
+        }
+    };
+
+    template <typename Tbuf>
+    void WriteLines(const char* variant, size_t n)
+    {
+        CountingSerial serial;
+        uint32_t us = benchmark::best_us([&]{
+            std::basic_oserialstream<char, std::char_traits<char>, CountingSerial, Tbuf> os(serial);
+            for(size_t i = 0; i < n; ++i)
+                os << "temp=" << (unsigned)i << " ok " << (unsigned)(i & 7) << '\n';
+        });
+        benchmark::report("serial", variant, n, us);
+        benchmark::report("serial", variant, n, serial.calls / BENCHMARK_RUNS, "writes");
+        benchmark::keep(serial.sum);
+    }
+}
+
+void BenchmarkSerstream()
+{
+    typedef std::char_traits<char> traits;
+
+    WriteLines<std::basic_serialbuf<char, traits, CountingSerial> >("unbuffered", BENCHMARK_N);
+    WriteLines<std::basic_buffered_serialbuf<char, traits, CountingSerial, 32, 0> >("buffered32", BENCHMARK_N);
+}
@@ -0,0 +1,127 @@
+// Sorting algorithms in EASTL/sort.h on random and patterned input
+
+#include "benchmark.h"
+#include <EASTL/sort.h>
+#include <vector>
+
+// Two arrays of 2^DigitBits uint32_t counters go on the stack, which with
+// 8 bit digits is all the RAM an ATmega328P has.
+#if defined(__AVR__)
+    #define BENCHMARK_RADIX_DIGIT_BITS 4
+    #define BENCHMARK_RADIX_NAME "radix_sort(4)"
+#else
+    #define BENCHMARK_RADIX_DIGIT_BITS 8
+    #define BENCHMARK_RADIX_NAME "radix_sort(8)"
+#endif
+
+namespace
+{
+    enum Pattern { kRandom, kSorted, kReversed, kSawtooth, kFewUnique, kPatternCount };
+
+    const char* const kPatternNames[] = { "random", "sorted", "reversed", "sawtooth", "few-unique" };
+
+    // A key with the index it started at, for the stable sorts.
+    struct Record
+    {
+        int key;
+        int id;
+
+        bool operator<(const Record& x) const { return key < x.key; }
+    };
+
+    void Set(int& value, int key, size_t)       { value = key; }
+    void Set(Record& value, int key, size_t i)  { value.key = key; value.id = (int)i; }
+    uint32_t Get(const int& value)              { return (uint32_t)value; }
+    uint32_t Get(const Record& value)           { return (uint32_t)value.id; }
+
+    template <typename T>
+    void Fill(std::vector<T>& data, Pattern pattern)
+    {
+        const size_t n = data.size();
+        benchmark::seed(1);
+
+        for(size_t i = 0; i < n; ++i)
+        {
+            switch(pattern)
+            {
+                case kRandom:    Set(data[i], (int)benchmark::random(), i);       break;
+                case kSorted:    Set(data[i], (int)i, i);                         break;
+                case kReversed:  Set(data[i], (int)(n - i), i);                   break;
+                case kSawtooth:  Set(data[i], (int)(i % 32), i);                  break;
+                default:         Set(data[i], (int)(benchmark::random() % 8), i); break;
+            }
+        }
+    }
+
+    template <typename T, typename Sort>
+    void TimeRandom(const char* name, const char* key, std::vector<T>& data, Sort sort)
+    {
+        uint32_t us = benchmark::best_us([&]{
+            benchmark::seed(1);
+            for(size_t i = 0; i < data.size(); ++i)
+                data[i] = (T)(int32_t)benchmark::random();
+        }, [&]{ sort(data.begin(), data.end()); });
+        benchmark::report(key, name, data.size(), us);
+        benchmark::keep((uint32_t)data[data.size() / 2]);
+    }
+
+    template <typename T>
+    void TimeRadix(const char* key)
+    {
+        typedef typename std::vector<T>::iterator iterator;
+        typedef std::Internal::extract_radix_value<T> extract;
+
+        // Half as many elements as BenchmarkSort, as keys are 32 bits and radix_sort needs a buffer.
+        std::vector<T> data(BENCHMARK_N / 2);
+        std::vector<T> buffer(BENCHMARK_N / 2);
+
+        TimeRandom("std::sort", key, data, [](iterator first, iterator last){ std::sort(first, last); });
+        TimeRandom(BENCHMARK_RADIX_NAME, key, data, [&](iterator first, iterator last){
+            std::radix_sort<iterator, extract, BENCHMARK_RADIX_DIGIT_BITS>(first, last, buffer.begin());
+        });
+        TimeRandom("in_place_radix_sort", key, data, [](iterator first, iterator last){ std::in_place_radix_sort(first, last); });
+    }
+
+    template <typename T, typename Sort>
+    void Time(const char* name, std::vector<T>& data, Sort sort)
+    {
+        for(int pattern = 0; pattern < kPatternCount; ++pattern)
+        {
+            uint32_t us = benchmark::best_us([&]{ Fill(data, (Pattern)pattern); }, [&]{ sort(data.begin(), data.end()); });
+            benchmark::report(kPatternNames[pattern], name, data.size(), us);
+            benchmark::keep(Get(data[data.size() / 2]));
+        }
+    }
+}
+
+void BenchmarkSort()
+{
+    typedef std::vector<int>::iterator iterator;
+
+    std::vector<int> data(BENCHMARK_N);
+    std::vector<int> buffer(BENCHMARK_N / 2);
+
+    Time("quick_sort", data, [](iterator first, iterator last){ std::quick_sort(first, last); });
+    Time("tim_sort_buffer", data, [&](iterator first, iterator last){ std::tim_sort_buffer(first, last, buffer.data()); });
+    Time("pdq_sort", data, [](iterator first, iterator last){ std::pdq_sort(first, last); });
+}
+
+void BenchmarkStableSort()
+{
+    typedef std::vector<Record>::iterator iterator;
+
+    // Half as many elements as BenchmarkSort, as records are twice the size.
+    std::vector<Record> data(BENCHMARK_N / 2);
+    std::vector<Record> buffer(BENCHMARK_N / 4);
+    std::allocator allocator;
+
+    Time("merge_sort", data, [&](iterator first, iterator last){ std::merge_sort(first, last, allocator); });
+    Time("tim_sort_buffer", data, [&](iterator first, iterator last){ std::tim_sort_buffer(first, last, buffer.data()); });
+    Time("in_place_merge_sort", data, [](iterator first, iterator last){ std::in_place_merge_sort(first, last); });
+}
+
+void BenchmarkRadixSort()
+{
+    TimeRadix<uint32_t>("uint32");
+    TimeRadix<float>("float");
+}
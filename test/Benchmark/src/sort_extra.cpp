@@ -0,0 +1,61 @@
+// static_sort against insertion_sort and std::sort on small fixed-size arrays
+//
+// Every variant copies the same random N elements into place before sorting
+// them, so that copy is part of each time.
+
+#include "benchmark.h"
+#include <EASTL/bonus/sort_extra.h>
+#include <string.h>
+
+namespace
+{
+    const size_t kSourceSize = 64;
+
+    template <size_t N>
+    void TimeStaticSort(const int* source, const char* name)
+    {
+        const size_t n = BENCHMARK_N; // Sorts per run.
+        int work[N];
+
+        benchmark::report(name, "static_sort", n, benchmark::best_us([&]{
+            for(size_t i = 0; i < n; ++i)
+            {
+                memcpy(work, source + (i * 7) % (kSourceSize - N), sizeof(work));
+                std::static_sort(work);
+                benchmark::keep((uint32_t)work[0]);
+            }
+        }));
+
+        benchmark::report(name, "insertion_sort", n, benchmark::best_us([&]{
+            for(size_t i = 0; i < n; ++i)
+            {
+                memcpy(work, source + (i * 7) % (kSourceSize - N), sizeof(work));
+                std::insertion_sort(work, work + N);
+                benchmark::keep((uint32_t)work[0]);
+            }
+        }));
+
+        benchmark::report(name, "std::sort", n, benchmark::best_us([&]{
+            for(size_t i = 0; i < n; ++i)
+            {
+                memcpy(work, source + (i * 7) % (kSourceSize - N), sizeof(work));
+                std::sort(work, work + N);
+                benchmark::keep((uint32_t)work[0]);
+            }
+        }));
+    }
+}
+
+void BenchmarkStaticSort()
+{
+    int source[kSourceSize];
+
+    benchmark::seed(1);
+    for(size_t i = 0; i < kSourceSize; ++i)
+        source[i] = (int)benchmark::random();
+
+    TimeStaticSort<3>(source, "N=3");
+    TimeStaticSort<4>(source, "N=4");
+    TimeStaticSort<8>(source, "N=8");
+    TimeStaticSort<16>(source, "N=16");
+}
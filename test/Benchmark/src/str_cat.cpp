@@ -0,0 +1,37 @@
+// str_cat against an operator+ chain, joining 2, 4 and 8 pieces
+
+#include "benchmark.h"
+#include <string>
+
+void BenchmarkStrCat()
+{
+    const size_t n = BENCHMARK_N; // Joins per run.
+    const std::string a("sensor"), b("."), c("temperature"), d("=");
+
+    benchmark::report("join2", "operator+", n, benchmark::best_us([&]{
+        for(size_t i = 0; i < n; ++i)
+            benchmark::keep((a + c).size());
+    }));
+    benchmark::report("join2", "str_cat", n, benchmark::best_us([&]{
+        for(size_t i = 0; i < n; ++i)
+            benchmark::keep(std::str_cat(a, c).size());
+    }));
+
+    benchmark::report("join4", "operator+", n, benchmark::best_us([&]{
+        for(size_t i = 0; i < n; ++i)
+            benchmark::keep((a + b + c + d).size());
+    }));
+    benchmark::report("join4", "str_cat", n, benchmark::best_us([&]{
+        for(size_t i = 0; i < n; ++i)
+            benchmark::keep(std::str_cat(a, b, c, d).size());
+    }));
+
+    benchmark::report("join8", "operator+", n, benchmark::best_us([&]{
+        for(size_t i = 0; i < n; ++i)
+            benchmark::keep((a + b + c + d + a + b + c + d).size());
+    }));
+    benchmark::report("join8", "str_cat", n, benchmark::best_us([&]{
+        for(size_t i = 0; i < n; ++i)
+            benchmark::keep(std::str_cat(a, b, c, d, a, b, c, d).size());
+    }));
+}